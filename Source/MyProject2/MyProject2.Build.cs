@@ -28,7 +28,12 @@ public class MyProject2 : ModuleRules
 			"UnrealEd",
 			"DatasmithCore",
 			"DatasmithContent",
-			"DatasmithImporter"
+			"DatasmithImporter",
+			"DatasmithTranslator",
+			"DesktopPlatform",
+			"DirectoryWatcher",
+			"Json",
+			"MeshMergeUtilities"
 		});
 
 		// Uncomment if you are using online features
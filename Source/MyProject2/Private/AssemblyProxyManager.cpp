@@ -0,0 +1,412 @@
+﻿// AssemblyProxyManager.cpp
+// 어셈블리 병합 프록시 관리 클래스 구현
+
+#include "AssemblyProxyManager.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/MeshMerging.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "FileHelpers.h"
+#include "IMeshMergeUtilities.h"
+#include "Materials/MaterialInterface.h"
+#include "MeshMergeModule.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "ObjectTools.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+
+#define LOCTEXT_NAMESPACE "AssemblyProxyManager"
+
+// 정적 멤버 초기화
+FAssemblyProxyManager* FAssemblyProxyManager::Instance = nullptr;
+const FName FAssemblyProxyManager::ProxyTag = FName("AssemblyProxy");
+
+namespace AssemblyProxy
+{
+	/** 프록시 에셋 저장 경로 */
+	static const TCHAR* ProxyRootPath = TEXT("/Game/Proxies");
+
+	/** 생성할 LOD 수 (LOD0 포함) */
+	static const int32 NumLODs = 4;
+
+	/** 해시 계산 시 위치 양자화 단위 (cm) */
+	static const double LocationQuantum = 0.01;
+
+	/** 기준 액터 대비 프록시 변환을 저장하는 에셋 메타데이터 키 */
+	static const FName RelativeTransformKey = FName("ProxyRelativeTransform");
+
+	/** 취소된 병합으로 만들어진 저장되지 않은 에셋 삭제 (확인 대화상자 없이) */
+	static void DiscardMergedAssets(const TArray<UObject*>& Assets)
+	{
+		TArray<UObject*> ObjectsToDelete;
+		for (UObject* Asset : Assets)
+		{
+			if (Asset)
+			{
+				ObjectsToDelete.Add(Asset);
+			}
+		}
+		
+		if (ObjectsToDelete.Num() > 0)
+		{
+			const int32 DeletedCount = ObjectTools::ForceDeleteObjects(ObjectsToDelete, false);
+			UE_LOG(LogTemp, Display, TEXT("프록시 생성 취소: 병합 에셋 %d개 삭제"), DeletedCount);
+		}
+	}
+}
+
+FAssemblyProxyManager& FAssemblyProxyManager::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FAssemblyProxyManager();
+	}
+	return *Instance;
+}
+
+bool FAssemblyProxyManager::BuildProxy(const FString& PartNo, const TArray<AActor*>& SourceRootActors)
+{
+	check(IsInGameThread());
+	
+	UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!EditorWorld || SourceRootActors.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("프록시 생성 실패: 임포트된 액터가 없습니다 - %s"), *PartNo);
+		return false;
+	}
+	
+	// 기존 프록시가 있으면 원본을 다시 표시하고 제거
+	RemoveProxy(PartNo);
+	
+	FScopedSlowTask SlowTask(4.0f, FText::Format(LOCTEXT("BuildingProxy", "Building merged proxy for {0}..."), FText::FromString(PartNo)));
+	SlowTask.MakeDialog(true);
+	
+	// 1. 병합 대상 수집 및 내용 해시 계산
+	SlowTask.EnterProgressFrame(1.0f, LOCTEXT("CollectingComponents", "Collecting meshes..."));
+	
+	TArray<AActor*> SourceActors;
+	CollectActorHierarchy(SourceRootActors, SourceActors);
+	
+	TArray<UPrimitiveComponent*> Components;
+	CollectMergeComponents(SourceActors, Components);
+	if (Components.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("프록시 생성 실패: 병합할 메시가 없습니다 - %s"), *PartNo);
+		return false;
+	}
+	
+	const FTransform ReferenceTransform = SourceRootActors[0]->GetActorTransform();
+	const FString ContentHash = ComputeContentHash(Components, ReferenceTransform);
+	
+	FString SafePartNo = PartNo;
+	SafePartNo.ReplaceInline(TEXT(" "), TEXT("_"));
+	SafePartNo.ReplaceInline(TEXT("/"), TEXT("_"));
+	SafePartNo.ReplaceInline(TEXT("."), TEXT("_"));
+	const FString AssetName = FString::Printf(TEXT("Proxy_%s_%s"), *SafePartNo, *ContentHash.Left(12));
+	const FString PackageName = FString::Printf(TEXT("%s/%s"), AssemblyProxy::ProxyRootPath, *AssetName);
+	
+	if (SlowTask.ShouldCancel())
+		return false;
+	
+	// 2. 같은 해시의 프록시 에셋이 있으면 재사용, 없으면 병합
+	SlowTask.EnterProgressFrame(1.0f, LOCTEXT("MergingMeshes", "Merging meshes..."));
+	
+	// 병합 유틸리티가 에셋 이름에 SM_ 접두사를 붙일 수 있으므로 두 이름 모두 확인
+	UStaticMesh* ProxyMesh = nullptr;
+	for (const FString& CandidateName : { AssetName, FString::Printf(TEXT("SM_%s"), *AssetName) })
+	{
+		const FString CandidatePath = FString::Printf(TEXT("%s/%s.%s"), AssemblyProxy::ProxyRootPath, *CandidateName, *CandidateName);
+		ProxyMesh = LoadObject<UStaticMesh>(nullptr, *CandidatePath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		if (ProxyMesh)
+			break;
+	}
+	FTransform ProxyTransform;
+	
+	FTransform RelativeTransform;
+	if (ProxyMesh && RelativeTransform.InitFromString(ProxyMesh->GetOutermost()->GetMetaData()->GetValue(ProxyMesh, AssemblyProxy::RelativeTransformKey)))
+	{
+		// 캐시된 에셋은 기준 액터 대비 변환을 메타데이터로 가지고 있음 (어셈블리를 옮겨도 재사용 가능)
+		ProxyTransform = RelativeTransform * ReferenceTransform;
+		SlowTask.EnterProgressFrame(1.0f, LOCTEXT("ReusingProxy", "Reusing cached proxy..."));
+		UE_LOG(LogTemp, Display, TEXT("프록시 캐시 사용: %s (%s)"), *PartNo, *PackageName);
+	}
+	else
+	{
+		ProxyMesh = nullptr;
+		
+		FMeshMergingSettings MergeSettings;
+		MergeSettings.LODSelectionType = EMeshLODSelectionType::SpecificLOD;
+		MergeSettings.SpecificLOD = 0;
+		MergeSettings.bMergePhysicsData = false;
+		MergeSettings.bMergeMaterials = false;
+		MergeSettings.bBakeVertexDataToMesh = false;
+		MergeSettings.bGenerateLightMapUV = false;
+		MergeSettings.bPivotPointAtZero = false;
+		
+		const IMeshMergeUtilities& MeshMergeUtilities = FModuleManager::LoadModuleChecked<IMeshMergeModule>("MeshMergeUtilities").GetUtilities();
+		
+		TArray<UObject*> AssetsToSync;
+		FVector MergedLocation = FVector::ZeroVector;
+		MeshMergeUtilities.MergeComponentsToStaticMesh(Components, EditorWorld, MergeSettings, nullptr, nullptr,
+			PackageName, AssetsToSync, MergedLocation, TNumericLimits<float>::Max(), true);
+		
+		for (UObject* Asset : AssetsToSync)
+		{
+			if (UStaticMesh* MergedMesh = Cast<UStaticMesh>(Asset))
+			{
+				ProxyMesh = MergedMesh;
+				break;
+			}
+		}
+		
+		if (!ProxyMesh)
+		{
+			UE_LOG(LogTemp, Error, TEXT("프록시 생성 실패: 메시 병합 결과가 없습니다 - %s"), *PartNo);
+			return false;
+		}
+		
+		ProxyTransform = FTransform(MergedLocation);
+		ProxyMesh->GetOutermost()->GetMetaData()->SetValue(ProxyMesh, AssemblyProxy::RelativeTransformKey,
+			*ProxyTransform.GetRelativeTransform(ReferenceTransform).ToString());
+		
+		// 병합 후 취소하면 이미 만든 에셋이 저장되지 않은 채 남으므로 삭제
+		if (SlowTask.ShouldCancel())
+		{
+			AssemblyProxy::DiscardMergedAssets(AssetsToSync);
+			return false;
+		}
+		
+		// 3. LOD 생성 및 저장
+		SlowTask.EnterProgressFrame(1.0f, LOCTEXT("GeneratingLODs", "Generating LODs..."));
+		GenerateLODs(ProxyMesh);
+		
+		TArray<UPackage*> PackagesToSave;
+		PackagesToSave.Add(ProxyMesh->GetOutermost());
+		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
+	}
+	
+	// 4. 프록시 액터 스폰 후 원본 숨김
+	SlowTask.EnterProgressFrame(1.0f, LOCTEXT("SpawningProxy", "Swapping in proxy..."));
+	
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AStaticMeshActor* ProxyActor = EditorWorld->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), ProxyTransform, SpawnParams);
+	if (!ProxyActor)
+		return false;
+	
+	ProxyActor->GetStaticMeshComponent()->SetStaticMesh(ProxyMesh);
+	ProxyActor->SetActorLabel(FString::Printf(TEXT("%s_Proxy"), *PartNo));
+	ProxyActor->Tags.AddUnique(ProxyTag);
+	ProxyActor->Tags.AddUnique(FName(*FString::Printf(TEXT("ProxyOf_%s"), *PartNo)));
+	
+	FAssemblyProxyInfo& Info = Proxies.Add(PartNo);
+	Info.ProxyActor = ProxyActor;
+	Info.ContentHash = ContentHash;
+	for (AActor* RootActor : SourceRootActors)
+	{
+		Info.SourceRootActors.Add(RootActor);
+	}
+	
+	SetProxyShown(PartNo, true);
+	
+	UE_LOG(LogTemp, Display, TEXT("프록시 생성 완료: %s (액터 %d개, 메시 컴포넌트 %d개 -> 1개, 해시 %s)"),
+		*PartNo, SourceActors.Num(), Components.Num(), *ContentHash);
+	return true;
+}
+
+bool FAssemblyProxyManager::HasProxy(const FString& PartNo) const
+{
+	const FAssemblyProxyInfo* Info = Proxies.Find(PartNo);
+	return Info && Info->ProxyActor.IsValid();
+}
+
+bool FAssemblyProxyManager::IsProxyShown(const FString& PartNo) const
+{
+	const FAssemblyProxyInfo* Info = Proxies.Find(PartNo);
+	return Info && Info->ProxyActor.IsValid() && Info->bProxyShown;
+}
+
+void FAssemblyProxyManager::SetProxyShown(const FString& PartNo, bool bShowProxy)
+{
+	FAssemblyProxyInfo* Info = Proxies.Find(PartNo);
+	if (!Info || !Info->ProxyActor.IsValid())
+		return;
+	
+	TArray<AActor*> RootActors;
+	for (const TWeakObjectPtr<AActor>& WeakActor : Info->SourceRootActors)
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			RootActors.Add(Actor);
+		}
+	}
+	
+	TArray<AActor*> SourceActors;
+	CollectActorHierarchy(RootActors, SourceActors);
+	
+	SetActorsHidden(SourceActors, bShowProxy);
+	SetActorsHidden({ Info->ProxyActor.Get() }, !bShowProxy);
+	Info->bProxyShown = bShowProxy;
+	
+	if (GEditor)
+	{
+		GEditor->RedrawLevelEditingViewports();
+	}
+	
+	UE_LOG(LogTemp, Display, TEXT("프록시 전환: %s -> %s"), *PartNo, bShowProxy ? TEXT("프록시") : TEXT("원본"));
+}
+
+void FAssemblyProxyManager::RemoveProxy(const FString& PartNo)
+{
+	if (!Proxies.Contains(PartNo))
+		return;
+	
+	SetProxyShown(PartNo, false);
+	
+	if (AStaticMeshActor* ProxyActor = Proxies[PartNo].ProxyActor.Get())
+	{
+		ProxyActor->Destroy();
+	}
+	Proxies.Remove(PartNo);
+}
+
+void FAssemblyProxyManager::CollectActorHierarchy(const TArray<AActor*>& RootActors, TArray<AActor*>& OutActors)
+{
+	TSet<AActor*> Visited;
+	TArray<AActor*> Stack(RootActors);
+	
+	while (Stack.Num() > 0)
+	{
+		AActor* Actor = Stack.Pop(EAllowShrinking::No);
+		if (!Actor || Visited.Contains(Actor))
+			continue;
+		
+		Visited.Add(Actor);
+		OutActors.Add(Actor);
+		
+		TArray<AActor*> AttachedActors;
+		Actor->GetAttachedActors(AttachedActors, false);
+		Stack.Append(AttachedActors);
+	}
+}
+
+void FAssemblyProxyManager::CollectMergeComponents(const TArray<AActor*>& Actors, TArray<UPrimitiveComponent*>& OutComponents)
+{
+	for (AActor* Actor : Actors)
+	{
+		TArray<UStaticMeshComponent*> MeshComponents;
+		Actor->GetComponents(MeshComponents);
+		
+		for (UStaticMeshComponent* MeshComp : MeshComponents)
+		{
+			if (MeshComp && MeshComp->GetStaticMesh() && MeshComp->IsVisible())
+			{
+				OutComponents.Add(MeshComp);
+			}
+		}
+	}
+}
+
+FString FAssemblyProxyManager::ComputeContentHash(const TArray<UPrimitiveComponent*>& Components, const FTransform& ReferenceTransform)
+{
+	// 컴포넌트별 서명 문자열을 만든 뒤 정렬하여 순서와 무관한 해시 생성
+	TArray<FString> Signatures;
+	Signatures.Reserve(Components.Num());
+	
+	auto AppendTransform = [](FString& Out, const FTransform& Transform)
+	{
+		const FVector Location = Transform.GetLocation() / AssemblyProxy::LocationQuantum;
+		const FRotator Rotation = Transform.Rotator();
+		const FVector Scale = Transform.GetScale3D();
+		Out += FString::Printf(TEXT("|%lld,%lld,%lld|%.3f,%.3f,%.3f|%.4f,%.4f,%.4f"),
+			FMath::RoundToInt64(Location.X), FMath::RoundToInt64(Location.Y), FMath::RoundToInt64(Location.Z),
+			Rotation.Pitch, Rotation.Yaw, Rotation.Roll, Scale.X, Scale.Y, Scale.Z);
+	};
+	
+	for (UPrimitiveComponent* Component : Components)
+	{
+		UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(Component);
+		if (!MeshComp)
+			continue;
+		
+		FString Signature = MeshComp->GetStaticMesh()->GetPathName();
+		for (int32 i = 0; i < MeshComp->GetNumMaterials(); ++i)
+		{
+			UMaterialInterface* Material = MeshComp->GetMaterial(i);
+			Signature += TEXT(";");
+			Signature += Material ? Material->GetPathName() : TEXT("None");
+		}
+		
+		// 인스턴스 컴포넌트는 인스턴스 변환을 모두 포함
+		if (UInstancedStaticMeshComponent* InstancedComp = Cast<UInstancedStaticMeshComponent>(MeshComp))
+		{
+			for (int32 InstanceIndex = 0; InstanceIndex < InstancedComp->GetInstanceCount(); ++InstanceIndex)
+			{
+				FTransform InstanceTransform;
+				InstancedComp->GetInstanceTransform(InstanceIndex, InstanceTransform, true);
+				AppendTransform(Signature, InstanceTransform.GetRelativeTransform(ReferenceTransform));
+			}
+		}
+		else
+		{
+			AppendTransform(Signature, MeshComp->GetComponentTransform().GetRelativeTransform(ReferenceTransform));
+		}
+		
+		Signatures.Add(MoveTemp(Signature));
+	}
+	
+	Signatures.Sort();
+	
+	FMD5 Md5;
+	for (const FString& Signature : Signatures)
+	{
+		FTCHARToUTF8 Utf8(*Signature);
+		Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+	
+	FMD5Hash Hash;
+	Hash.Set(Md5);
+	return LexToString(Hash);
+}
+
+void FAssemblyProxyManager::GenerateLODs(UStaticMesh* StaticMesh)
+{
+	if (!StaticMesh || StaticMesh->GetNumSourceModels() == 0)
+		return;
+	
+	// LOD마다 삼각형 수를 절반으로 줄이고 화면 크기는 자동 계산
+	StaticMesh->SetNumSourceModels(AssemblyProxy::NumLODs);
+	const FMeshBuildSettings BaseBuildSettings = StaticMesh->GetSourceModel(0).BuildSettings;
+	
+	for (int32 LODIndex = 1; LODIndex < AssemblyProxy::NumLODs; ++LODIndex)
+	{
+		FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LODIndex);
+		SourceModel.BuildSettings = BaseBuildSettings;
+		SourceModel.ReductionSettings.PercentTriangles = FMath::Pow(0.5f, static_cast<float>(LODIndex));
+		SourceModel.ReductionSettings.PercentVertices = SourceModel.ReductionSettings.PercentTriangles;
+	}
+	
+	StaticMesh->bAutoComputeLODScreenSize = true;
+	StaticMesh->Build(true);
+	StaticMesh->PostEditChange();
+	StaticMesh->MarkPackageDirty();
+}
+
+void FAssemblyProxyManager::SetActorsHidden(const TArray<AActor*>& Actors, bool bHidden)
+{
+	for (AActor* Actor : Actors)
+	{
+		if (!Actor)
+			continue;
+		
+		Actor->SetIsTemporarilyHiddenInEditor(bHidden);
+		Actor->SetActorHiddenInGame(bHidden);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,365 @@
+﻿// AssemblyStreamingManager.cpp
+// 상위 어셈블리별 스트리밍 서브레벨 관리 구현
+
+#include "AssemblyStreamingManager.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UI/PartTreeItem.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EditorLevelUtils.h"
+#include "FileHelpers.h"
+#endif
+
+FAssemblyStreamingManager* FAssemblyStreamingManager::Instance = nullptr;
+
+namespace AssemblyStreaming
+{
+	/** 셀 서브레벨 패키지 폴더 */
+	static const TCHAR* CellPackageRoot = TEXT("/Game/Datasmith/Streaming");
+
+	/** 에디터 월드 */
+	UWorld* GetEditorWorld()
+	{
+#if WITH_EDITOR
+		return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+#else
+		return nullptr;
+#endif
+	}
+}
+
+FAssemblyStreamingManager::FAssemblyStreamingManager()
+{
+#if WITH_EDITOR
+	MapOpenedHandle = FEditorDelegates::OnMapOpened.AddRaw(this, &FAssemblyStreamingManager::OnMapOpened);
+#endif
+}
+
+FAssemblyStreamingManager::~FAssemblyStreamingManager()
+{
+#if WITH_EDITOR
+	FEditorDelegates::OnMapOpened.Remove(MapOpenedHandle);
+#endif
+	if (UWorld* World = BoundWorld.Get())
+	{
+		World->OnLevelsChanged().Remove(LevelsChangedHandle);
+	}
+}
+
+FAssemblyStreamingManager& FAssemblyStreamingManager::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FAssemblyStreamingManager();
+	}
+	return *Instance;
+}
+
+void FAssemblyStreamingManager::Shutdown()
+{
+	delete Instance;
+	Instance = nullptr;
+}
+
+void FAssemblyStreamingManager::SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems)
+{
+	TreeRootItems = RootItems;
+	RebuildCellMap();
+}
+
+void FAssemblyStreamingManager::SetCellLevel(int32 InCellLevel)
+{
+	InCellLevel = FMath::Clamp(InCellLevel, 1, 2);
+	if (CellLevel == InCellLevel)
+		return;
+
+	CellLevel = InCellLevel;
+	RebuildCellMap();
+}
+
+void FAssemblyStreamingManager::RebuildCellMap()
+{
+	PartToCell.Empty();
+	CellParts.Empty();
+
+	// 트리를 한 번 순회하며 셀 레벨 노드를 만나면 하위 전체를 그 셀로 기록
+	TArray<TPair<FPartTreeItem*, FString>> Stack;
+	for (const TSharedPtr<FPartTreeItem>& Root : TreeRootItems)
+	{
+		if (Root.IsValid())
+		{
+			Stack.Emplace(Root.Get(), FString());
+		}
+	}
+
+	while (Stack.Num() > 0)
+	{
+		TPair<FPartTreeItem*, FString> Entry = Stack.Pop(EAllowShrinking::No);
+		FPartTreeItem* Item = Entry.Key;
+		FString CellPartNo = MoveTemp(Entry.Value);
+
+		if (CellPartNo.IsEmpty() && Item->Level == CellLevel)
+		{
+			CellPartNo = Item->PartNo;
+			CellParts.Add(CellPartNo);
+		}
+
+		// 같은 파트가 여러 어셈블리에 있으면 처음 만난 셀에 배치
+		if (!CellPartNo.IsEmpty() && !PartToCell.Contains(Item->PartNo))
+		{
+			PartToCell.Add(Item->PartNo, CellPartNo);
+		}
+
+		for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+		{
+			if (Child.IsValid())
+			{
+				Stack.Emplace(Child.Get(), CellPartNo);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("어셈블리 스트리밍 셀 구성: 레벨 %d, 셀 %d개, 파트 %d개"),
+		CellLevel, CellParts.Num(), PartToCell.Num());
+
+	// 셀이 바뀌었으므로 스트리밍 레벨 대응 다시 계산
+	RefreshStreamingLevelCache();
+}
+
+void FAssemblyStreamingManager::BindToEditorWorld()
+{
+	UWorld* World = AssemblyStreaming::GetEditorWorld();
+	if (BoundWorld.Get() == World)
+		return;
+
+	if (UWorld* PreviousWorld = BoundWorld.Get())
+	{
+		PreviousWorld->OnLevelsChanged().Remove(LevelsChangedHandle);
+	}
+	LevelsChangedHandle.Reset();
+
+	BoundWorld = World;
+	if (World)
+	{
+		LevelsChangedHandle = World->OnLevelsChanged().AddRaw(this, &FAssemblyStreamingManager::OnLevelsChanged);
+	}
+}
+
+void FAssemblyStreamingManager::RefreshStreamingLevelCache()
+{
+	BindToEditorWorld();
+	CellStreamingLevels.Reset();
+
+	UWorld* World = BoundWorld.Get();
+	if (!World || CellParts.Num() == 0)
+		return;
+
+	// 월드의 스트리밍 레벨을 패키지 이름으로 한 번 인덱싱한 뒤 셀마다 조회
+	TMap<FName, ULevelStreaming*> LevelsByPackage;
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		if (StreamingLevel)
+		{
+			LevelsByPackage.Add(StreamingLevel->GetWorldAssetPackageFName(), StreamingLevel);
+		}
+	}
+
+	if (LevelsByPackage.Num() == 0)
+		return;
+
+	for (const FString& CellPartNo : CellParts)
+	{
+		if (ULevelStreaming* const* StreamingLevel = LevelsByPackage.Find(FName(*GetCellPackageName(CellPartNo))))
+		{
+			CellStreamingLevels.Add(CellPartNo, *StreamingLevel);
+		}
+	}
+}
+
+void FAssemblyStreamingManager::OnLevelsChanged()
+{
+	RefreshStreamingLevelCache();
+}
+
+void FAssemblyStreamingManager::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+	// 새 월드의 레벨 목록 이벤트로 다시 구독
+	RefreshStreamingLevelCache();
+}
+
+FString FAssemblyStreamingManager::FindCellForPart(const FString& PartNo) const
+{
+	const FString* CellPartNo = PartToCell.Find(PartNo);
+	return CellPartNo ? *CellPartNo : FString();
+}
+
+FString FAssemblyStreamingManager::GetCellPackageName(const FString& CellPartNo)
+{
+	// 패키지 이름에 쓸 수 없는 문자 치환
+	FString SafeName = CellPartNo;
+	for (TCHAR& Char : SafeName)
+	{
+		if (!FChar::IsAlnum(Char) && Char != TEXT('_'))
+		{
+			Char = TEXT('_');
+		}
+	}
+	return FString::Printf(TEXT("%s/Cell_%s"), AssemblyStreaming::CellPackageRoot, *SafeName);
+}
+
+ULevelStreaming* FAssemblyStreamingManager::FindStreamingLevel(const FString& CellPartNo) const
+{
+	// 다른 월드의 캐시가 남아 있으면 무시 (맵 열기 이벤트 전)
+	if (BoundWorld.Get() != AssemblyStreaming::GetEditorWorld())
+		return nullptr;
+
+	const TWeakObjectPtr<ULevelStreaming>* StreamingLevel = CellStreamingLevels.Find(CellPartNo);
+	return StreamingLevel ? StreamingLevel->Get() : nullptr;
+}
+
+bool FAssemblyStreamingManager::HasCellLevel(const FString& CellPartNo) const
+{
+	return FindStreamingLevel(CellPartNo) != nullptr;
+}
+
+bool FAssemblyStreamingManager::IsCellLoaded(const FString& CellPartNo) const
+{
+	ULevelStreaming* StreamingLevel = FindStreamingLevel(CellPartNo);
+	return StreamingLevel && StreamingLevel->GetLoadedLevel() != nullptr;
+}
+
+ULevel* FAssemblyStreamingManager::GetOrCreateCellLevel(UWorld* World, const FString& CellPartNo)
+{
+#if WITH_EDITOR
+	if (!World || CellPartNo.IsEmpty())
+		return nullptr;
+
+	if (World->IsPartitionedWorld())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("World Partition 월드는 서브레벨을 지원하지 않아 퍼시스턴트 레벨에 임포트합니다: %s"), *CellPartNo);
+		return nullptr;
+	}
+
+	// 이미 월드에 있는 셀: 언로드 상태면 다시 로드
+	if (ULevelStreaming* StreamingLevel = FindStreamingLevel(CellPartNo))
+	{
+		if (!StreamingLevel->GetLoadedLevel())
+		{
+			SetCellLoaded(CellPartNo, true);
+		}
+		return StreamingLevel->GetLoadedLevel();
+	}
+
+	const FString PackageName = GetCellPackageName(CellPartNo);
+	ULevelStreaming* StreamingLevel = nullptr;
+
+	if (FPackageName::DoesPackageExist(PackageName))
+	{
+		// 이전 세션에서 만든 셀 서브레벨을 월드에 추가
+		StreamingLevel = UEditorLevelUtils::AddLevelToWorld(World, *PackageName, ULevelStreamingDynamic::StaticClass());
+	}
+	else
+	{
+		// 새 서브레벨 생성 및 저장 (저장 대화상자 없이 지정 경로 사용)
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetMapPackageExtension());
+		StreamingLevel = UEditorLevelUtils::CreateNewStreamingLevelForWorld(
+			*World, ULevelStreamingDynamic::StaticClass(), PackageFilename, false, nullptr, false);
+	}
+
+	// 레벨 목록 변경 이벤트가 오기 전에도 바로 조회되도록 캐시에 추가
+	if (StreamingLevel)
+	{
+		BindToEditorWorld();
+		CellStreamingLevels.Add(CellPartNo, StreamingLevel);
+	}
+
+	ULevel* CellLevel = StreamingLevel ? StreamingLevel->GetLoadedLevel() : nullptr;
+	if (!CellLevel)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("어셈블리 서브레벨을 만들 수 없습니다: %s"), *PackageName);
+		return nullptr;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("어셈블리 서브레벨 준비: %s -> %s"), *CellPartNo, *PackageName);
+	return CellLevel;
+#else
+	return nullptr;
+#endif
+}
+
+bool FAssemblyStreamingManager::SetCellLoaded(const FString& CellPartNo, bool bLoaded)
+{
+#if WITH_EDITOR
+	ULevelStreaming* StreamingLevel = FindStreamingLevel(CellPartNo);
+	UWorld* World = AssemblyStreaming::GetEditorWorld();
+	if (!StreamingLevel || !World)
+		return false;
+
+	const bool bCurrentlyLoaded = StreamingLevel->GetLoadedLevel() != nullptr;
+	if (bCurrentlyLoaded == bLoaded)
+		return false;
+
+	if (!bLoaded)
+	{
+		ULevel* CellLevel = StreamingLevel->GetLoadedLevel();
+
+		// 언로드하면 변경 사항이 사라지므로 먼저 저장
+		if (CellLevel->GetOutermost()->IsDirty() && !FEditorFileUtils::SaveLevel(CellLevel))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("어셈블리 서브레벨 저장 실패로 언로드를 취소합니다: %s"), *CellPartNo);
+			return false;
+		}
+
+		// 현재 레벨이면 퍼시스턴트 레벨로 되돌림
+		if (World->GetCurrentLevel() == CellLevel)
+		{
+			World->SetCurrentLevel(World->PersistentLevel);
+		}
+
+		// 선택된 액터가 언로드되는 레벨에 남지 않도록 선택 해제
+		GEditor->SelectNone(false, true, false);
+	}
+
+	StreamingLevel->SetShouldBeLoadedInEditor(bLoaded);
+	World->FlushLevelStreaming();
+
+	UE_LOG(LogTemp, Display, TEXT("어셈블리 서브레벨 %s: %s"), bLoaded ? TEXT("로드") : TEXT("언로드"), *CellPartNo);
+	return true;
+#else
+	return false;
+#endif
+}
+
+FScopedCurrentLevel::FScopedCurrentLevel(UWorld* InWorld)
+	: World(InWorld)
+	, PreviousLevel(InWorld ? InWorld->GetCurrentLevel() : nullptr)
+{
+}
+
+FScopedCurrentLevel::~FScopedCurrentLevel()
+{
+	UWorld* WorldPtr = World.Get();
+	ULevel* Level = PreviousLevel.Get();
+	if (WorldPtr && Level && WorldPtr->GetCurrentLevel() != Level)
+	{
+		WorldPtr->SetCurrentLevel(Level);
+	}
+}
+
+void FScopedCurrentLevel::SetLevel(ULevel* InLevel)
+{
+	if (UWorld* WorldPtr = World.Get())
+	{
+		if (InLevel && WorldPtr->GetCurrentLevel() != InLevel)
+		{
+			WorldPtr->SetCurrentLevel(InLevel);
+		}
+	}
+}
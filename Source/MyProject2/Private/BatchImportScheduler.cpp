@@ -0,0 +1,309 @@
+﻿// BatchImportScheduler.cpp
+// 여러 3DXML 파일을 한 번에 임포트하는 배치 스케줄러 구현
+
+#include "BatchImportScheduler.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+#include "DatasmithSceneFactory.h"
+#include "DatasmithSceneManager.h"
+#include "DatasmithTranslatableSource.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/ScopedSlowTask.h"
+
+#define LOCTEXT_NAMESPACE "BatchImportScheduler"
+
+namespace BatchImportScheduler
+{
+	/** 동시에 변환할 최대 파일 수 */
+	static const int32 MaxConcurrentTranslations = 8;
+
+	/** 완료 큐가 비었을 때 게임 스레드 대기 간격 (초) */
+	static const float CompletionPollInterval = 0.02f;
+
+	/** 동시에 변환할 파일 수 (코어 절반, 나머지는 파일별 번역기 워커 프로세스와 게임 스레드용) */
+	int32 GetConcurrentTranslationCount(int32 NumJobs)
+	{
+		const int32 Cores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+		return FMath::Clamp(FMath::Min(Cores / 2, NumJobs), 1, MaxConcurrentTranslations);
+	}
+}
+
+FBatchImportScheduler::FBatchImportScheduler(const FImportSettings& InSettings)
+	: ImportSettings(InSettings)
+{
+}
+
+void FBatchImportScheduler::AddJob(const FString& PartNo, const FString& FilePath)
+{
+	if (PartNo.IsEmpty() || FilePath.IsEmpty())
+		return;
+
+	bool bAlreadyQueued = false;
+	QueuedPartNos.Add(PartNo, &bAlreadyQueued);
+	if (bAlreadyQueued)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("배치 임포트: 중복 파트 번호 건너뜀 - %s"), *PartNo);
+		return;
+	}
+
+	Jobs.Emplace(PartNo, FilePath);
+}
+
+void FBatchImportScheduler::PreflightJobs(FBatchImportResult& OutResult)
+{
+	// 파일 크기 조회는 스레드 안전하므로 워커 스레드에서 병렬 수행
+	ParallelFor(Jobs.Num(), [this](int32 JobIndex)
+	{
+		FBatchImportJob& Job = Jobs[JobIndex];
+		Job.FileSize = IFileManager::Get().FileSize(*Job.FilePath);
+	});
+
+	// 누락/빈 파일은 실패로 분류하고 작업에서 제외
+	for (int32 JobIndex = Jobs.Num() - 1; JobIndex >= 0; --JobIndex)
+	{
+		if (Jobs[JobIndex].FileSize <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("배치 임포트: 파일을 읽을 수 없음 - %s (%s)"), *Jobs[JobIndex].PartNo, *Jobs[JobIndex].FilePath);
+			OutResult.FailedParts.Add(Jobs[JobIndex].PartNo);
+			Jobs.RemoveAt(JobIndex);
+		}
+	}
+}
+
+bool FBatchImportScheduler::ConfigureCADTranslatorWorkers(int32 ConcurrentTranslations)
+{
+	return FDatasmithSceneManager::ConfigureCADPreTranslation(ConcurrentTranslations, SavedConsoleVariables);
+}
+
+void FBatchImportScheduler::RestoreCADTranslatorWorkers()
+{
+	FDatasmithSceneManager::RestoreConsoleVariables(SavedConsoleVariables);
+}
+
+FBatchImportResult FBatchImportScheduler::Run()
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FBatchImportScheduler::Run);
+
+	FBatchImportResult Result;
+
+	PreflightJobs(Result);
+
+	if (Jobs.Num() == 0)
+	{
+		return Result;
+	}
+
+#if WITH_EDITOR
+	// 씬 매니저는 배치 전체에서 하나만 사용
+	FDatasmithSceneManager SceneManager;
+	SceneManager.SetImportSettings(ImportSettings);
+
+	// 배치 전체에 대한 단일 진행 대화상자 (개별 임포트 진행은 하위 단계로 표시됨)
+	FScopedSlowTask SlowTask(
+		static_cast<float>(Jobs.Num()),
+		FText::Format(LOCTEXT("BatchImportProgress", "3DXML 배치 임포트 ({0}개)"), FText::AsNumber(Jobs.Num())));
+	SlowTask.MakeDialog(true);
+
+	// 처리(임포트 또는 건너뜀)된 작업과 워커 스레드에서 변환을 시작한 작업
+	TBitArray<> HandledJobs(false, Jobs.Num());
+	TBitArray<> LaunchedJobs(false, Jobs.Num());
+
+	// 이미 레벨에 있는 파트는 건너뛰고, 임포트 결과 캐시가 있는 파트는 변환 없이 바로 처리
+	TArray<int32> ImportOrder;
+	TArray<int32> TranslateOrder;
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+	{
+		const FBatchImportJob& Job = Jobs[JobIndex];
+		if (SceneManager.IsAlreadyImportedInLevel(Job.PartNo))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("이미 임포트된 액터가 있음: %s"), *Job.PartNo);
+			Result.AlreadyImportedParts.Add(Job.PartNo);
+			HandledJobs[JobIndex] = true;
+			SlowTask.EnterProgressFrame(1.0f);
+		}
+		else if (SceneManager.HasImportCacheEntry(Job.FilePath))
+		{
+			ImportOrder.Add(JobIndex);
+		}
+		else
+		{
+			TranslateOrder.Add(JobIndex);
+		}
+	}
+
+	const int32 ConcurrentTranslations = MaxConcurrentTranslations > 0
+		? FMath::Clamp(TranslateOrder.Num(), 1, MaxConcurrentTranslations)
+		: BatchImportScheduler::GetConcurrentTranslationCount(TranslateOrder.Num());
+	const bool bPreTranslate = ConfigureCADTranslatorWorkers(ConcurrentTranslations) && TranslateOrder.Num() > 0;
+	if (!bPreTranslate)
+	{
+		// 사전 변환 없이 게임 스레드에서 순차 변환
+		ImportOrder.Append(TranslateOrder);
+		TranslateOrder.Reset();
+	}
+	else
+	{
+		Result.ConcurrentTranslations = ConcurrentTranslations;
+	}
+
+	// 변환 완료 큐 (워커 스레드가 작업 인덱스를 넣고 게임 스레드가 꺼냄)
+	TQueue<int32, EQueueMode::Mpsc> CompletedQueue;
+	TArray<TFuture<void>> TranslationFutures;
+	int32 NextTranslateIndex = 0;
+	int32 NumInFlight = 0;
+
+	// 게임 스레드가 처리할 작업 수 (건너뛴 작업 제외)
+	const int32 NumToImport = ImportOrder.Num() + TranslateOrder.Num();
+	int32 NumImportStarted = 0;
+	int32 ImportOrderIndex = 0;
+
+	while (NumImportStarted < NumToImport)
+	{
+		// 사용자 취소 시 새 변환은 시작하지 않고 처리되지 않은 작업은 취소 목록으로
+		if (SlowTask.ShouldCancel())
+		{
+			Result.bCancelled = true;
+			for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+			{
+				if (!HandledJobs[JobIndex])
+				{
+					Result.CancelledParts.Add(Jobs[JobIndex].PartNo);
+				}
+			}
+			UE_LOG(LogTemp, Warning, TEXT("배치 임포트 취소됨: %d개 미처리"), Result.CancelledParts.Num());
+			break;
+		}
+
+		// 동시 변환 수가 찰 때까지 다음 파일 변환 시작 (옵션 객체는 게임 스레드에서 준비)
+		while (NumInFlight < ConcurrentTranslations && NextTranslateIndex < TranslateOrder.Num())
+		{
+			const int32 JobIndex = TranslateOrder[NextTranslateIndex++];
+			TSharedPtr<FDatasmithTranslatableSceneSource> Source = SceneManager.CreatePreTranslationSource(Jobs[JobIndex].FilePath);
+			if (!Source.IsValid())
+			{
+				// 게임 스레드 임포트에서 다시 시도하여 실패 원인을 기록
+				CompletedQueue.Enqueue(JobIndex);
+				continue;
+			}
+
+			++NumInFlight;
+			LaunchedJobs[JobIndex] = true;
+			FBatchImportJob* Job = &Jobs[JobIndex];
+			TranslationFutures.Add(Async(EAsyncExecution::ThreadPool, [Source, Job, JobIndex, &CompletedQueue]()
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FBatchImportScheduler::PreTranslate);
+				const double StartTime = FPlatformTime::Seconds();
+
+				// 번역 결과 씬은 버리고 CAD 캐시에 남은 변환 결과만 사용
+				TSharedRef<IDatasmithScene> Scene = FDatasmithSceneFactory::CreateScene(*Job->PartNo);
+				Job->bPreTranslated = Source->Translate(Scene);
+				Job->PreTranslateSeconds = FPlatformTime::Seconds() - StartTime;
+
+				CompletedQueue.Enqueue(JobIndex);
+			}));
+		}
+
+		// 다음 처리할 작업: 캐시 파트가 남아 있으면 먼저, 아니면 변환 완료 순서대로
+		int32 JobIndex = INDEX_NONE;
+		if (ImportOrderIndex < ImportOrder.Num())
+		{
+			JobIndex = ImportOrder[ImportOrderIndex++];
+		}
+		else if (CompletedQueue.Dequeue(JobIndex))
+		{
+			if (LaunchedJobs[JobIndex])
+			{
+				--NumInFlight;
+			}
+		}
+		else
+		{
+			// 변환 중인 파일이 끝날 때까지 진행 대화상자를 갱신하며 대기
+			SlowTask.TickProgress();
+			FPlatformProcess::Sleep(BatchImportScheduler::CompletionPollInterval);
+			continue;
+		}
+
+		const FBatchImportJob& Job = Jobs[JobIndex];
+		HandledJobs[JobIndex] = true;
+		++NumImportStarted;
+
+		SlowTask.EnterProgressFrame(1.0f, FText::Format(
+			LOCTEXT("BatchImportJob", "{0} 임포트 중... ({1}/{2}, 변환 중 {3}개)"),
+			FText::FromString(Job.PartNo), FText::AsNumber(NumImportStarted), FText::AsNumber(NumToImport), FText::AsNumber(NumInFlight)));
+
+		// 게임 스레드에서 에셋 생성(CAD 캐시 사용), 액터 스폰 및 후처리
+		AActor* ResultActor = SceneManager.ImportAndProcessDatasmith(Job.FilePath, Job.PartNo, NumImportStarted, NumToImport);
+
+		// 정리 단계 시간을 보고서에 누적
+		const FActorCleanupStats& CleanupStats = SceneManager.GetLastCleanupStats();
+		Result.CleanupSeconds += CleanupStats.Seconds;
+		Result.CleanupRemovedActors += CleanupStats.RemovedCount;
+
+		FPartImportRecord& Record = Result.PartRecords.Add_GetRef(SceneManager.GetLastImportRecord());
+		Record.StageSeconds[static_cast<int32>(EImportStage::PreTranslate)] = Job.PreTranslateSeconds;
+		Result.PreTranslateSeconds += Job.PreTranslateSeconds;
+
+		if (ResultActor)
+		{
+			Result.ImportedParts.Add(Job.PartNo);
+			Result.LastImportedActor = ResultActor;
+		}
+		else
+		{
+			Result.FailedParts.Add(Job.PartNo);
+		}
+	}
+
+	// 취소된 경우에도 진행 중인 변환(워커 프로세스)은 중단할 수 없으므로 끝날 때까지 대기
+	for (TFuture<void>& Future : TranslationFutures)
+	{
+		Future.Wait();
+	}
+
+	RestoreCADTranslatorWorkers();
+
+	// 미뤄 둔 에셋 패키지를 한 번에 저장 (취소 전까지 임포트된 파트 포함)
+	if (SceneManager.GetNumPendingSavePackages() > 0)
+	{
+		SlowTask.EnterProgressFrame(0.0f, FText::Format(
+			LOCTEXT("BatchImportSave", "에셋 패키지 {0}개 저장 중..."), FText::AsNumber(SceneManager.GetNumPendingSavePackages())));
+
+		const double SaveStartTime = FPlatformTime::Seconds();
+		Result.SavedPackageCount = SceneManager.SavePendingPackages();
+		Result.SaveSeconds = FPlatformTime::Seconds() - SaveStartTime;
+
+		// 저장 후 파트 폴더 크기 기록
+		for (FPartImportRecord& Record : Result.PartRecords)
+		{
+			if (Record.bSucceeded && !Record.bFromCache)
+			{
+				Record.BytesWritten = FImportTelemetry::GetContentFolderSize(FString::Printf(TEXT("/Game/Datasmith/%s"), *Record.PartNo));
+			}
+		}
+	}
+
+	// 파트별 계측 기록을 배치 보고서로 저장
+	if (Result.PartRecords.Num() > 0)
+	{
+		FImportTelemetry::WriteBatchReport(Result.PartRecords, Result.ReportCsvPath, Result.ReportJsonPath, Result.SaveSeconds);
+	}
+#else
+	for (const FBatchImportJob& Job : Jobs)
+	{
+		Result.FailedParts.Add(Job.PartNo);
+	}
+#endif
+
+	UE_LOG(LogTemp, Display, TEXT("배치 임포트 완료: 성공 %d, 실패 %d, 건너뜀 %d, 취소 %d (액터 정리 %d개, %.3f초 / 패키지 저장 %d개, %.3f초)"),
+		Result.ImportedParts.Num(), Result.FailedParts.Num(), Result.AlreadyImportedParts.Num(), Result.CancelledParts.Num(),
+		Result.CleanupRemovedActors, Result.CleanupSeconds, Result.SavedPackageCount, Result.SaveSeconds);
+
+	return Result;
+}
+
+#undef LOCTEXT_NAMESPACE
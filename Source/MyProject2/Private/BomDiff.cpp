@@ -0,0 +1,333 @@
+﻿// BomDiff.cpp
+// BOM 개정판 비교 구현
+
+#include "BomDiff.h"
+
+#include "Async/ParallelFor.h"
+#include "TreeViewUtils.h"
+#include "UI/PartTreeItem.h"
+
+namespace BomDiffInternal
+{
+	/** 비교용 행 */
+	struct FRow
+	{
+		const FPartTreeItem* Item = nullptr;
+
+		/** 매칭 키 */
+		FString Key;
+
+		/** S/N 키 여부 */
+		bool bSerial = false;
+	};
+
+	/** 비어 있거나 "nan"/"-"인 값은 없는 것으로 취급 */
+	bool IsValidValue(const FString& Value)
+	{
+		return !Value.IsEmpty() && !Value.Equals(TEXT("nan"), ESearchCase::IgnoreCase) && Value != TEXT("-");
+	}
+
+	/** 레벨 순서로 모든 행 나열 (같은 파트 번호가 여러 행이어도 모두 포함) */
+	void FlattenRows(const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& LevelToItemsMap, TArray<FRow>& OutRows)
+	{
+		TArray<int32> Levels;
+		LevelToItemsMap.GetKeys(Levels);
+		Levels.Sort();
+
+		int32 TotalRows = 0;
+		for (const auto& LevelPair : LevelToItemsMap)
+		{
+			TotalRows += LevelPair.Value.Num();
+		}
+
+		OutRows.Reset(TotalRows);
+		for (int32 Level : Levels)
+		{
+			for (const TSharedPtr<FPartTreeItem>& Item : LevelToItemsMap[Level])
+			{
+				if (Item.IsValid())
+				{
+					FRow& Row = OutRows.AddDefaulted_GetRef();
+					Row.Item = Item.Get();
+				}
+			}
+		}
+	}
+
+	/** NextPart를 따라 올라간 상위 경로 (예: "/ASSY/SUB") */
+	FString BuildParentPath(const FPartTreeItem* Item, const TMap<FString, TSharedPtr<FPartTreeItem>>& PartNoToItemMap)
+	{
+		FString Path;
+		const FPartTreeItem* Current = Item;
+
+		// 순환 BOM 방지: 레벨 깊이만큼만 올라감
+		for (int32 Depth = 0; Current && Depth <= Item->Level; ++Depth)
+		{
+			if (!IsValidValue(Current->NextPart))
+				break;
+
+			Path += TEXT("/");
+			Path += Current->NextPart;
+
+			const TSharedPtr<FPartTreeItem>* Parent = PartNoToItemMap.Find(Current->NextPart);
+			Current = Parent ? Parent->Get() : nullptr;
+		}
+		return Path;
+	}
+
+	/** 행마다 매칭 키 계산 (S/N이 BOM 안에서 유일하면 S/N, 아니면 파트 번호 + 상위 경로) */
+	void ComputeKeys(TArray<FRow>& Rows, const TMap<FString, TSharedPtr<FPartTreeItem>>& PartNoToItemMap)
+	{
+		TMap<FString, int32> SerialCounts;
+		SerialCounts.Reserve(Rows.Num());
+		for (const FRow& Row : Rows)
+		{
+			if (IsValidValue(Row.Item->SN))
+			{
+				++SerialCounts.FindOrAdd(Row.Item->SN);
+			}
+		}
+
+		ParallelFor(Rows.Num(), [&Rows, &SerialCounts, &PartNoToItemMap](int32 RowIndex)
+		{
+			FRow& Row = Rows[RowIndex];
+			const FString& Serial = Row.Item->SN;
+			if (IsValidValue(Serial) && SerialCounts.FindRef(Serial) == 1)
+			{
+				Row.Key = TEXT("S:") + Serial;
+				Row.bSerial = true;
+			}
+			else
+			{
+				Row.Key = TEXT("P:") + Row.Item->PartNo + BuildParentPath(Row.Item, PartNoToItemMap);
+			}
+		});
+
+		// 같은 상위 아래 같은 파트가 여러 행이면 순번을 붙여 구분
+		TMap<FString, int32> KeyOccurrences;
+		KeyOccurrences.Reserve(Rows.Num());
+		for (FRow& Row : Rows)
+		{
+			int32& Occurrence = KeyOccurrences.FindOrAdd(Row.Key);
+			if (Occurrence > 0)
+			{
+				Row.Key += FString::Printf(TEXT("#%d"), Occurrence);
+			}
+			++Occurrence;
+		}
+	}
+
+	/** 매칭된 두 행의 변경 종류 */
+	EBomDiffFlags CompareRows(const FPartTreeItem& OldItem, const FPartTreeItem& NewItem)
+	{
+		EBomDiffFlags Flags = EBomDiffFlags::None;
+		if (OldItem.NextPart != NewItem.NextPart)
+		{
+			Flags |= EBomDiffFlags::Moved;
+		}
+		if (OldItem.PartRev != NewItem.PartRev)
+		{
+			Flags |= EBomDiffFlags::Revised;
+		}
+		if (OldItem.Qty != NewItem.Qty)
+		{
+			Flags |= EBomDiffFlags::QuantityChanged;
+		}
+		return Flags;
+	}
+}
+
+int32 FBomDiffResult::Count(EBomDiffFlags Kind) const
+{
+	int32 Result = 0;
+	for (const FBomDiffEntry& Entry : Entries)
+	{
+		if (EnumHasAnyFlags(Entry.Flags, Kind))
+		{
+			++Result;
+		}
+	}
+	return Result;
+}
+
+bool FBomDiff::DiffFiles(const FString& OldFilePath, const FString& NewFilePath, FBomDiffResult& OutResult)
+{
+	TMap<FString, TSharedPtr<FPartTreeItem>> OldPartNoToItemMap;
+	TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> OldLevelToItemsMap;
+	TArray<TSharedPtr<FPartTreeItem>> OldRootItems;
+	int32 OldMaxLevel = 0;
+	if (!FTreeViewUtils::LoadBomTree(OldFilePath, OldPartNoToItemMap, OldLevelToItemsMap, OldMaxLevel, OldRootItems))
+		return false;
+
+	TMap<FString, TSharedPtr<FPartTreeItem>> NewPartNoToItemMap;
+	TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> NewLevelToItemsMap;
+	TArray<TSharedPtr<FPartTreeItem>> NewRootItems;
+	int32 NewMaxLevel = 0;
+	if (!FTreeViewUtils::LoadBomTree(NewFilePath, NewPartNoToItemMap, NewLevelToItemsMap, NewMaxLevel, NewRootItems))
+		return false;
+
+	DiffTrees(OldLevelToItemsMap, OldPartNoToItemMap, NewLevelToItemsMap, NewPartNoToItemMap, OutResult);
+	return true;
+}
+
+void FBomDiff::DiffTrees(
+	const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& OldLevelToItemsMap,
+	const TMap<FString, TSharedPtr<FPartTreeItem>>& OldPartNoToItemMap,
+	const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& NewLevelToItemsMap,
+	const TMap<FString, TSharedPtr<FPartTreeItem>>& NewPartNoToItemMap,
+	FBomDiffResult& OutResult)
+{
+	using namespace BomDiffInternal;
+	TRACE_CPUPROFILER_EVENT_SCOPE(FBomDiff::DiffTrees);
+
+	const double StartTime = FPlatformTime::Seconds();
+	OutResult = FBomDiffResult();
+
+	// 1. 행 나열 및 키 계산 (병렬)
+	TArray<FRow> OldRows;
+	TArray<FRow> NewRows;
+	FlattenRows(OldLevelToItemsMap, OldRows);
+	FlattenRows(NewLevelToItemsMap, NewRows);
+	ComputeKeys(OldRows, OldPartNoToItemMap);
+	ComputeKeys(NewRows, NewPartNoToItemMap);
+
+	OutResult.OldRowCount = OldRows.Num();
+	OutResult.NewRowCount = NewRows.Num();
+
+	// 2. 이전 BOM 키 해시 맵 구성
+	TMap<FString, int32> OldKeyToIndex;
+	OldKeyToIndex.Reserve(OldRows.Num());
+	for (int32 OldIndex = 0; OldIndex < OldRows.Num(); ++OldIndex)
+	{
+		OldKeyToIndex.Add(OldRows[OldIndex].Key, OldIndex);
+	}
+
+	// 3. 새 BOM 행을 병렬 조회 (키가 유일하므로 이전 행마다 최대 한 번만 매칭되어 쓰기가 겹치지 않음)
+	TArray<int32> NewToOld;
+	NewToOld.Init(INDEX_NONE, NewRows.Num());
+	TArray<EBomDiffFlags> NewRowFlags;
+	NewRowFlags.Init(EBomDiffFlags::None, NewRows.Num());
+	TArray<uint8> OldMatched;
+	OldMatched.SetNumZeroed(OldRows.Num());
+
+	ParallelFor(NewRows.Num(), [&](int32 NewIndex)
+	{
+		const int32* OldIndex = OldKeyToIndex.Find(NewRows[NewIndex].Key);
+		if (!OldIndex)
+			return;
+
+		NewToOld[NewIndex] = *OldIndex;
+		OldMatched[*OldIndex] = 1;
+		NewRowFlags[NewIndex] = CompareRows(*OldRows[*OldIndex].Item, *NewRows[NewIndex].Item);
+	});
+
+	// 4. 매칭되지 않은 추가/삭제 중 파트 번호가 양쪽에 하나씩만 있으면 이동으로 분류
+	TMap<FString, TArray<int32>> UnmatchedOldByPart;
+	for (int32 OldIndex = 0; OldIndex < OldRows.Num(); ++OldIndex)
+	{
+		if (!OldMatched[OldIndex])
+		{
+			UnmatchedOldByPart.FindOrAdd(OldRows[OldIndex].Item->PartNo).Add(OldIndex);
+		}
+	}
+
+	TMap<FString, int32> UnmatchedNewCountByPart;
+	for (int32 NewIndex = 0; NewIndex < NewRows.Num(); ++NewIndex)
+	{
+		if (NewToOld[NewIndex] == INDEX_NONE)
+		{
+			++UnmatchedNewCountByPart.FindOrAdd(NewRows[NewIndex].Item->PartNo);
+		}
+	}
+
+	for (int32 NewIndex = 0; NewIndex < NewRows.Num(); ++NewIndex)
+	{
+		if (NewToOld[NewIndex] != INDEX_NONE)
+			continue;
+
+		const FPartTreeItem& NewItem = *NewRows[NewIndex].Item;
+		const TArray<int32>* OldCandidates = UnmatchedOldByPart.Find(NewItem.PartNo);
+		if (!OldCandidates || OldCandidates->Num() != 1 || UnmatchedNewCountByPart.FindRef(NewItem.PartNo) != 1)
+			continue;
+
+		const int32 OldIndex = (*OldCandidates)[0];
+		const FPartTreeItem& OldItem = *OldRows[OldIndex].Item;
+		NewToOld[NewIndex] = OldIndex;
+		OldMatched[OldIndex] = 1;
+
+		EBomDiffFlags Flags = CompareRows(OldItem, NewItem);
+		if (BuildParentPath(&OldItem, OldPartNoToItemMap) != BuildParentPath(&NewItem, NewPartNoToItemMap))
+		{
+			Flags |= EBomDiffFlags::Moved;
+		}
+		NewRowFlags[NewIndex] = Flags;
+	}
+
+	// 5. 변경 행과 파트별 오버레이 플래그 구성
+	auto AddEntry = [&OutResult](const FRow* OldRow, const FRow* NewRow, EBomDiffFlags Flags)
+	{
+		FBomDiffEntry& Entry = OutResult.Entries.AddDefaulted_GetRef();
+		const FRow& KeyRow = NewRow ? *NewRow : *OldRow;
+		Entry.Key = KeyRow.Key;
+		Entry.PartNo = KeyRow.Item->PartNo;
+		Entry.bMatchedBySerial = KeyRow.bSerial;
+		Entry.Flags = Flags;
+		if (OldRow)
+		{
+			Entry.OldParent = OldRow->Item->NextPart;
+			Entry.OldRev = OldRow->Item->PartRev;
+			Entry.OldQty = OldRow->Item->Qty;
+		}
+		if (NewRow)
+		{
+			Entry.NewParent = NewRow->Item->NextPart;
+			Entry.NewRev = NewRow->Item->PartRev;
+			Entry.NewQty = NewRow->Item->Qty;
+		}
+	};
+
+	for (int32 NewIndex = 0; NewIndex < NewRows.Num(); ++NewIndex)
+	{
+		const int32 OldIndex = NewToOld[NewIndex];
+		const EBomDiffFlags Flags = (OldIndex == INDEX_NONE) ? EBomDiffFlags::Added : NewRowFlags[NewIndex];
+		if (Flags == EBomDiffFlags::None)
+			continue;
+
+		AddEntry(OldIndex != INDEX_NONE ? &OldRows[OldIndex] : nullptr, &NewRows[NewIndex], Flags);
+		OutResult.PartFlags.FindOrAdd(NewRows[NewIndex].Item->PartNo) |= Flags;
+	}
+
+	for (int32 OldIndex = 0; OldIndex < OldRows.Num(); ++OldIndex)
+	{
+		if (OldMatched[OldIndex])
+			continue;
+
+		AddEntry(&OldRows[OldIndex], nullptr, EBomDiffFlags::Removed);
+
+		// 삭제된 노드는 새 트리에 없으므로 남아 있는 상위 노드에 표시
+		const FString& ParentPartNo = OldRows[OldIndex].Item->NextPart;
+		if (NewPartNoToItemMap.Contains(ParentPartNo))
+		{
+			OutResult.PartFlags.FindOrAdd(ParentPartNo) |= EBomDiffFlags::ChildRemoved;
+		}
+	}
+
+	OutResult.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogTemp, Display, TEXT("BOM 비교 완료: 이전 %d행, 새 %d행 -> 추가 %d, 삭제 %d, 이동 %d, 개정 %d, 수량 변경 %d (%.3f초)"),
+		OutResult.OldRowCount, OutResult.NewRowCount,
+		OutResult.Count(EBomDiffFlags::Added), OutResult.Count(EBomDiffFlags::Removed), OutResult.Count(EBomDiffFlags::Moved),
+		OutResult.Count(EBomDiffFlags::Revised), OutResult.Count(EBomDiffFlags::QuantityChanged), OutResult.Seconds);
+}
+
+FString FBomDiff::DescribeFlags(EBomDiffFlags Flags)
+{
+	TArray<FString> Names;
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::Added))           Names.Add(TEXT("Added"));
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::Removed))         Names.Add(TEXT("Removed"));
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::Moved))           Names.Add(TEXT("Moved"));
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::Revised))         Names.Add(TEXT("Revised"));
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::QuantityChanged)) Names.Add(TEXT("Quantity Changed"));
+	if (EnumHasAnyFlags(Flags, EBomDiffFlags::ChildRemoved))    Names.Add(TEXT("Child Removed"));
+	return FString::Join(Names, TEXT(", "));
+}
@@ -1,17 +1,31 @@
 ﻿// DatasmithSceneManager.cpp
 #include "DatasmithSceneManager.h"
 
+#include "AssemblyStreamingManager.h"
 #include "AssetImportTask.h"
 #include "AssetToolsModule.h"
 #include "DatasmithImportFactory.h"
 #include "DatasmithImportOptions.h"
+#include "DatasmithSceneSource.h"
+#include "DatasmithTranslatableSource.h"
+#include "DatasmithTranslator.h"
+#include "Engine/Level.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "EngineUtils.h"
 #include "Editor.h"
+#include "EditorLoadingAndSavingUtils.h"
 #include "ImportedNodeManager.h"
+#include "ImportResultCache.h"
+#include "ImportTelemetry.h"
+#include "MaterialClassificationCache.h"
 #include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
 #include "Materials/MaterialInstance.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
+#include "PartInstancedMeshComponent.h"
+#include "TreeViewUtils.h"
 #include "UObject/UObjectGlobals.h"
 
 FDatasmithSceneManager::FDatasmithSceneManager()
@@ -76,9 +90,9 @@ TArray<UMaterialInterface*> FDatasmithSceneManager::FindTransparentMaterials()
     return TransparentMaterials;
 }
 
-TArray<UStaticMesh*> FDatasmithSceneManager::FindMeshesWithTransparentMaterials()
+TSet<UStaticMesh*> FDatasmithSceneManager::FindMeshesWithTransparentMaterials()
 {
-    TArray<UStaticMesh*> TransparentMeshes;
+    TSet<UStaticMesh*> TransparentMeshes;
     
     // DatasmithScene이 유효한지 확인
     if (!DatasmithScene.IsValid())
@@ -90,37 +104,25 @@ TArray<UStaticMesh*> FDatasmithSceneManager::FindMeshesWithTransparentMaterials(
     // 스태틱 메시 맵 가져오기
     TMap<FName, UStaticMesh*> StaticMeshes = GetStaticMeshMap();
     
-    // 투명 메터리얼 목록 가져오기
-    TArray<UMaterialInterface*> TransparentMaterials = FindTransparentMaterials();
-    
-    // 각 메시의 메터리얼 확인
+    // 각 메시의 메터리얼 확인 (메터리얼 분류는 캐시에서 조회)
     for (const auto& Pair : StaticMeshes)
     {
         UStaticMesh* Mesh = Pair.Value;
         if (!Mesh)
             continue;
         
-        bool bHasTransparentMaterial = false;
-        
         // 메시의 모든 메터리얼 섹션 확인
-        for (int32 i = 0; i < Mesh->GetStaticMaterials().Num(); ++i)
+        for (const FStaticMaterial& StaticMaterial : Mesh->GetStaticMaterials())
         {
-            FStaticMaterial& StaticMaterial = Mesh->GetStaticMaterials()[i];
             UMaterialInterface* Material = StaticMaterial.MaterialInterface;
-            
-            if (TransparentMaterials.Contains(Material) || HasTransparency(Material))
+            if (HasTransparency(Material))
             {
-                bHasTransparentMaterial = true;
+                TransparentMeshes.Add(Mesh);
                 UE_LOG(LogTemp, Verbose, TEXT("투명 메터리얼이 있는 메시: %s, 메터리얼: %s"), 
-                       *Mesh->GetName(), Material ? *Material->GetName() : TEXT("None"));
+                       *Mesh->GetName(), *Material->GetName());
                 break;
             }
         }
-        
-        if (bHasTransparentMaterial)
-        {
-            TransparentMeshes.Add(Mesh);
-        }
     }
     
     UE_LOG(LogTemp, Display, TEXT("투명 메터리얼을 사용하는 메시: %d개"), TransparentMeshes.Num());
@@ -164,25 +166,14 @@ AActor* FDatasmithSceneManager::FindDatasmithSceneActor()
         return DatasmithSceneActor.Get();
     }
     
-    // 저장된 씬 액터가 없으면 에디터 월드에서 검색
-    UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
-    if (!EditorWorld)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("에디터 월드를 찾을 수 없습니다."));
-        return nullptr;
-    }
-    
-    for (TActorIterator<AActor> It(EditorWorld); It; ++It)
+    // 저장된 씬 액터가 없으면 임포트 노드 관리자의 인덱스에서 조회
+    if (AActor* Actor = FImportedNodeManager::Get().FindDatasmithSceneActor())
     {
-        AActor* Actor = *It;
-        if (Actor && Actor->GetClass()->GetName().Contains(TEXT("DatasmithSceneActor")))
-        {
-            UE_LOG(LogTemp, Display, TEXT("월드에서 DatasmithSceneActor 찾음: %s"), *Actor->GetName());
-            
-            // 찾은 액터를 멤버 변수에 저장
-            DatasmithSceneActor = Actor;
-            return Actor;
-        }
+        UE_LOG(LogTemp, Display, TEXT("레벨에서 DatasmithSceneActor 찾음: %s"), *Actor->GetName());
+        
+        // 찾은 액터를 멤버 변수에 저장
+        DatasmithSceneActor = Actor;
+        return Actor;
     }
     
     UE_LOG(LogTemp, Warning, TEXT("DatasmithSceneActor를 찾을 수 없습니다."));
@@ -236,7 +227,7 @@ void FDatasmithSceneManager::SeparateTransparentActors(const FString& PartNo)
         return;
         
     // 투명 메시 리스트 구하기
-    TArray<UStaticMesh*> TransparentMeshes = FindMeshesWithTransparentMaterials();
+    TSet<UStaticMesh*> TransparentMeshes = FindMeshesWithTransparentMaterials();
     if (TransparentMeshes.Num() == 0)
     {
         UE_LOG(LogTemp, Display, TEXT("투명 메시가 없습니다."));
@@ -308,48 +299,8 @@ AActor* FDatasmithSceneManager::GetFirstChildActor()
 
 bool FDatasmithSceneManager::HasTransparency(UMaterialInterface* Material)
 {
-    if (!Material)
-        return false;
-        
-    // 1. 메터리얼 블렌드 모드 확인
-    EBlendMode BlendMode = Material->GetBlendMode();
-    if (BlendMode != BLEND_Opaque)
-    {
-        return true;
-    }
-    
-    // 2. 이름에서 알파 값 확인
-    FString MaterialName = Material->GetName();
-    float Alpha = ExtractAlphaFromColorName(MaterialName);
-    
-    // 알파값이 1.0보다 작으면 투명도 있음
-    return Alpha < 1.0f;
-}
-
-float FDatasmithSceneManager::GetAlphaValue(const FString& AlphaHex)
-{
-    if (AlphaHex.Len() != 2)
-        return 1.0f;
-    
-    if (uint32 AlphaInt = FParse::HexNumber(*AlphaHex))
-    {
-        return AlphaInt / 255.0f;
-    }
-    
-    return 1.0f;
-}
-
-float FDatasmithSceneManager::ExtractAlphaFromColorName(const FString& ColorName)
-{
-    // 색상 이름이 "color_RRGGBBAA" 형식인지 확인
-    if (ColorName.StartsWith(TEXT("color_")) && ColorName.Len() >= 15)
-    {
-        // 마지막 2자리가 알파 값
-        FString AlphaHex = ColorName.Right(2);
-        return GetAlphaValue(AlphaHex);
-    }
-    
-    return 1.0f; // 기본값은 완전 불투명
+    // 머티리얼 경로별로 한 번만 분류 (배치 임포트 전체에서 공유)
+    return FMaterialClassificationCache::Get().IsTransparent(Material);
 }
 
 TMap<FName, UMaterialInterface*> FDatasmithSceneManager::GetMaterialMap()
@@ -453,7 +404,7 @@ TArray<AActor*> FDatasmithSceneManager::FindTransparentActorsInWorld()
     TArray<AActor*> TransparentActors;
     
     // 투명 메시 리스트 구하기
-    TArray<UStaticMesh*> TransparentMeshes = FindMeshesWithTransparentMaterials();
+    TSet<UStaticMesh*> TransparentMeshes = FindMeshesWithTransparentMaterials();
     if (TransparentMeshes.Num() == 0)
         return TransparentActors;
     
@@ -501,43 +452,26 @@ AActor* FDatasmithSceneManager::FindDatasmithSceneActorFromImport(UObject* InDat
         }
     }
     
-    // DatasmithSceneActor 찾기
-    UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
-    if (!EditorWorld)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("에디터 월드를 찾을 수 없습니다."));
-        return nullptr;
-    }
-    
+    // DatasmithSceneActor 찾기 (임포트 노드 관리자가 레벨에 추가된 씬 액터를 추적)
     AActor* SceneActor = nullptr;
     
     // 1. 임포트된 DatasmithScene의 이름으로 찾기
     if (!SceneActorName.IsEmpty())
     {
-        for (TActorIterator<AActor> It(EditorWorld); It; ++It)
+        SceneActor = FImportedNodeManager::Get().FindDatasmithSceneActor(SceneActorName);
+        if (SceneActor)
         {
-            AActor* Actor = *It;
-            if (Actor && Actor->GetName().Contains(SceneActorName))
-            {
-                SceneActor = Actor;
-                UE_LOG(LogTemp, Display, TEXT("임포트된 DatasmithScene의 이름으로 SceneActor 찾음: %s"), *SceneActor->GetName());
-                break;
-            }
+            UE_LOG(LogTemp, Display, TEXT("임포트된 DatasmithScene의 이름으로 SceneActor 찾음: %s"), *SceneActor->GetName());
         }
     }
     
-    // 2. 이름으로 찾지 못한 경우 타입으로 찾기
+    // 2. 이름으로 찾지 못한 경우 가장 최근에 추가된 씬 액터
     if (!SceneActor)
     {
-        for (TActorIterator<AActor> It(EditorWorld); It; ++It)
+        SceneActor = FImportedNodeManager::Get().FindDatasmithSceneActor();
+        if (SceneActor)
         {
-            AActor* Actor = *It;
-            if (Actor && Actor->GetClass()->GetName().Contains(TEXT("DatasmithSceneActor")))
-            {
-                SceneActor = Actor;
-                UE_LOG(LogTemp, Display, TEXT("타입으로 SceneActor 찾음: %s"), *SceneActor->GetName());
-                break;
-            }
+            UE_LOG(LogTemp, Display, TEXT("타입으로 SceneActor 찾음: %s"), *SceneActor->GetName());
         }
     }
     
@@ -577,7 +511,7 @@ UDatasmithImportOptions* FDatasmithSceneManager::CreateImportOptions(const FStri
     ImportOptions->OtherActorImportPolicy = EDatasmithImportActorPolicy::Update;
     ImportOptions->MaterialQuality = EDatasmithImportMaterialQuality::UseRealFresnelCurves;
     
-    // 스태틱 메시 옵션 설정
+    // 스태틱 메시 옵션 설정 (라이트맵/재질 품질은 ApplyImportSettingsToOptions에서 품질 단계로 덮어씀)
     ImportOptions->BaseOptions.StaticMeshOptions.MinLightmapResolution = EDatasmithImportLightmapMin::LIGHTMAP_64;
     ImportOptions->BaseOptions.StaticMeshOptions.MaxLightmapResolution = EDatasmithImportLightmapMax::LIGHTMAP_1024;
     ImportOptions->BaseOptions.StaticMeshOptions.bGenerateLightmapUVs = true;
@@ -595,6 +529,31 @@ UDatasmithImportOptions* FDatasmithSceneManager::CreateImportOptions(const FStri
 // Source/MyProject2/Private/DatasmithSceneManager.cpp 파일의 
 // ImportDatasmithFile 함수 수정
 
+namespace DatasmithSceneManagerCAD
+{
+    // Datasmith CAD 번역기 콘솔 변수 (엔진 버전에 없으면 무시됨)
+    static const TCHAR* EnableThreadedImportCVar = TEXT("ds.CADTranslator.EnableThreadedImport");
+    static const TCHAR* MaxImportThreadsCVar = TEXT("ds.CADTranslator.MaxImportThreads");
+    static const TCHAR* EnableCADCacheCVar = TEXT("ds.CADTranslator.EnableCADCache");
+}
+
+namespace DatasmithSceneManagerQuality
+{
+    /** 품질 단계별 CAD 테셀레이션 (코드 길이/법선 허용치, 최대 변 길이, 단위 cm/도) */
+    FDatasmithTessellationOptions GetTessellationOptions(int32 QualityTier)
+    {
+        switch (QualityTier)
+        {
+        case 0: // 미리보기: 배치 검토용 거친 형상
+            return FDatasmithTessellationOptions(1.0f, 0.0f, 45.0f);
+        case 2: // 고품질: 곡면 디테일 보존
+            return FDatasmithTessellationOptions(0.05f, 10.0f, 10.0f);
+        default: // 표준: Datasmith 기본값
+            return FDatasmithTessellationOptions(0.2f, 0.0f, 20.0f);
+        }
+    }
+}
+
 TArray<UObject*> FDatasmithSceneManager::ImportDatasmithFile(const FString& FilePath, const FString& DestinationPath)
 {
     TArray<UObject*> ImportedObjects;
@@ -623,7 +582,7 @@ TArray<UObject*> FDatasmithSceneManager::ImportDatasmithFile(const FString& File
     ImportTask->DestinationPath = DestinationPath;
     ImportTask->Options = ImportOptions;
     ImportTask->Factory = DatasmithFactory;
-    ImportTask->bSave = true;
+    ImportTask->bSave = !ImportSettings.bDeferAssetSaving && !ImportSettings.bSkipAssetSaving;
     ImportTask->bAutomated = true;
     ImportTask->bAsync = false;  // 동기 임포트로 설정
     
@@ -632,9 +591,17 @@ TArray<UObject*> FDatasmithSceneManager::ImportDatasmithFile(const FString& File
     TArray<UAssetImportTask*> ImportTasks;
     ImportTasks.Add(ImportTask);
     
+    // 품질 단계의 CAD 테셀레이션 적용 (CAD 번역기는 옵션 객체를 기본 객체에서 만들므로
+    // 임포트 동안만 기본 객체 값을 바꾸고 끝나면 사용자의 마지막 설정으로 복원)
+    UDatasmithCommonTessellationOptions* TessellationDefaults = GetMutableDefault<UDatasmithCommonTessellationOptions>();
+    const FDatasmithTessellationOptions SavedTessellation = TessellationDefaults->Options;
+    TessellationDefaults->Options = DatasmithSceneManagerQuality::GetTessellationOptions(ImportSettings.QualityTier);
+    
     // 임포트 수행 (동기적으로 실행)
     AssetToolsModule.Get().ImportAssetTasks(ImportTasks);
     
+    TessellationDefaults->Options = SavedTessellation;
+    
     UE_LOG(LogTemp, Display, TEXT("3DXML 파일 임포트 완료: %s"), *FilePath);
     
     // 임포트된 객체 반환
@@ -643,6 +610,77 @@ TArray<UObject*> FDatasmithSceneManager::ImportDatasmithFile(const FString& File
     return ImportedObjects;
 }
 
+void FDatasmithSceneManager::CollectDirtyPackages(const TArray<UObject*>& ImportedObjects, const FString& ContentPath)
+{
+    const int32 NumBefore = PendingSavePackages.Num();
+    
+    auto AddIfDirty = [this](const UObject* Object)
+    {
+        UPackage* Package = Object ? Object->GetOutermost() : nullptr;
+        if (Package && Package->IsDirty())
+        {
+            PendingSavePackages.AddUnique(Package);
+        }
+    };
+    
+    for (UObject* Object : ImportedObjects)
+    {
+        if (!Object)
+            continue;
+        
+        AddIfDirty(Object);
+        
+        // DatasmithScene 에셋은 이번 임포트로 만든 에셋을 맵(StaticMeshes, Materials, Textures 등)으로 참조하므로
+        // 리플렉션으로 모든 에셋 맵의 값을 확인 (로드된 객체만)
+        for (TFieldIterator<FMapProperty> PropIt(Object->GetClass()); PropIt; ++PropIt)
+        {
+            FMapProperty* MapProperty = *PropIt;
+            FObjectPropertyBase* ValueProp = CastField<FObjectPropertyBase>(MapProperty->ValueProp);
+            if (!ValueProp)
+                continue;
+            
+            FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(Object));
+            for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+            {
+                if (MapHelper.IsValidIndex(Index))
+                {
+                    AddIfDirty(ValueProp->GetObjectPropertyValue(MapHelper.GetValuePtr(Index)));
+                }
+            }
+        }
+    }
+    
+    UE_LOG(LogTemp, Verbose, TEXT("저장 대기 패키지 추가: %s (%d개)"), *ContentPath, PendingSavePackages.Num() - NumBefore);
+}
+
+int32 FDatasmithSceneManager::SavePendingPackages()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(SavePendingPackages);
+    
+    TArray<UPackage*> PackagesToSave;
+    PackagesToSave.Reserve(PendingSavePackages.Num());
+    for (const TWeakObjectPtr<UPackage>& Package : PendingSavePackages)
+    {
+        if (Package.IsValid())
+        {
+            PackagesToSave.Add(Package.Get());
+        }
+    }
+    PendingSavePackages.Reset();
+    
+    if (PackagesToSave.Num() == 0)
+        return 0;
+    
+    // 한 번의 호출로 모든 패키지 저장 (변경된 패키지만)
+    if (!UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("임포트 에셋 일괄 저장 중 일부 패키지 저장 실패 (%d개 중)"), PackagesToSave.Num());
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("임포트 에셋 일괄 저장: 패키지 %d개"), PackagesToSave.Num());
+    return PackagesToSave.Num();
+}
+
 // ImportSettings 설정 함수 구현
 void FDatasmithSceneManager::SetImportSettings(const FImportSettings& InSettings)
 {
@@ -655,8 +693,29 @@ void FDatasmithSceneManager::ApplyImportSettingsToOptions(UDatasmithImportOption
     if (!ImportOptions)
         return;
     
-    // 라이트맵 UV 생성은 LOD와 직접적인 관련이 없지만, 기본적으로 활성화
-    ImportOptions->BaseOptions.StaticMeshOptions.bGenerateLightmapUVs = true;
+    // 품질 단계에 따른 라이트맵 UV와 재질 품질 (테셀레이션은 ImportDatasmithFile에서 적용)
+    FDatasmithStaticMeshImportOptions& StaticMeshOptions = ImportOptions->BaseOptions.StaticMeshOptions;
+    switch (ImportSettings.QualityTier)
+    {
+    case 0: // 미리보기: 라이트맵 UV 생성 생략, 프레넬 커브 없는 단순 재질
+        StaticMeshOptions.bGenerateLightmapUVs = false;
+        StaticMeshOptions.MinLightmapResolution = EDatasmithImportLightmapMin::LIGHTMAP_64;
+        StaticMeshOptions.MaxLightmapResolution = EDatasmithImportLightmapMax::LIGHTMAP_64;
+        ImportOptions->MaterialQuality = EDatasmithImportMaterialQuality::UseNoFresnelCurves;
+        break;
+    case 2: // 고품질
+        StaticMeshOptions.bGenerateLightmapUVs = true;
+        StaticMeshOptions.MinLightmapResolution = EDatasmithImportLightmapMin::LIGHTMAP_128;
+        StaticMeshOptions.MaxLightmapResolution = EDatasmithImportLightmapMax::LIGHTMAP_2048;
+        ImportOptions->MaterialQuality = EDatasmithImportMaterialQuality::UseRealFresnelCurves;
+        break;
+    default: // 표준
+        StaticMeshOptions.bGenerateLightmapUVs = true;
+        StaticMeshOptions.MinLightmapResolution = EDatasmithImportLightmapMin::LIGHTMAP_64;
+        StaticMeshOptions.MaxLightmapResolution = EDatasmithImportLightmapMax::LIGHTMAP_1024;
+        ImportOptions->MaterialQuality = EDatasmithImportMaterialQuality::UseRealFresnelCurves;
+        break;
+    }
     
     // 재질 업데이트 정책 적용
     switch (ImportSettings.MaterialUpdatePolicy)
@@ -684,12 +743,74 @@ void FDatasmithSceneManager::ApplyImportSettingsToOptions(UDatasmithImportOption
 
 AActor* FDatasmithSceneManager::ImportAndProcessDatasmith(const FString& FilePath, const FString& PartNo, int32 CurrentIndex, int32 TotalCount)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(ImportAndProcessDatasmith);
+    
     // ImportSettings 가져오기
     FImportSettings Settings = ImportSettings;
     
+    // 이번 임포트의 정리 통계와 계측 기록 초기화 (캐시 스폰은 정리 단계를 거치지 않음)
+    LastCleanupStats = FActorCleanupStats();
+    LastImportRecord = FPartImportRecord(PartNo, FilePath);
+    FPartImportRecord& Record = LastImportRecord;
+    
+    const double ImportStartTime = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        Record.TotalSeconds = FPlatformTime::Seconds() - ImportStartTime;
+        UE_LOG(LogTemp, Display, TEXT("임포트 계측 [%s]: %.3f초 (변환 %.3f, 정리 %.3f, 피벗 %.3f), 삼각형 %lld, 액터 생성 %d/제거 %d, %lld바이트"),
+               *Record.PartNo, Record.TotalSeconds, Record.GetStageSeconds(EImportStage::Translate),
+               Record.GetStageSeconds(EImportStage::Cleanup), Record.GetStageSeconds(EImportStage::Pivot),
+               Record.TriangleCount, Record.ActorsCreated, Record.ActorsDestroyed, Record.BytesWritten);
+    };
+    
+    // 어셈블리 서브레벨 배치: 범위 동안 셀 서브레벨을 현재 레벨로 두어 임포트/캐시 스폰 액터가 그 레벨에 생성되도록 함
+    UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    FScopedCurrentLevel CellLevelScope(EditorWorld);
+    if (Settings.bStreamAssembliesToSubLevels)
+    {
+        FAssemblyStreamingManager& StreamingManager = FAssemblyStreamingManager::Get();
+        StreamingManager.SetCellLevel(Settings.StreamingCellLevel);
+        
+        const FString CellPartNo = StreamingManager.FindCellForPart(PartNo);
+        if (ULevel* CellLevel = StreamingManager.GetOrCreateCellLevel(EditorWorld, CellPartNo))
+        {
+            CellLevelScope.SetLevel(CellLevel);
+            
+            // 배치 끝 일괄 저장에 서브레벨 패키지 포함
+            if (Settings.bDeferAssetSaving && !Settings.bSkipAssetSaving)
+            {
+                PendingSavePackages.AddUnique(CellLevel->GetOutermost());
+                
+                // 스트리밍 레벨 추가는 퍼시스턴트 레벨을 바꾸므로 함께 저장해야 재시작 후에도 셀이 월드에 남음
+                // (아직 저장한 적 없는 임시 맵은 저장 대화상자가 뜨므로 제외)
+                UPackage* PersistentPackage = EditorWorld->PersistentLevel ? EditorWorld->PersistentLevel->GetOutermost() : nullptr;
+                if (PersistentPackage && PersistentPackage->IsDirty() && !FPackageName::IsTempPackage(PersistentPackage->GetName()))
+                {
+                    PendingSavePackages.AddUnique(PersistentPackage);
+                }
+            }
+        }
+    }
+    
+    // 같은 파일을 같은 설정으로 임포트한 적이 있으면 CAD 변환 없이 기존 에셋으로 스폰
+    {
+        IMPORT_STAGE_SCOPE(Record, Spawn);
+        if (AActor* CachedActor = SpawnFromImportCache(FilePath, PartNo))
+        {
+            Record.bSucceeded = true;
+            Record.bFromCache = true;
+            Record.ActorsCreated = FImportTelemetry::CountActors(CachedActor);
+            Record.TriangleCount = FImportTelemetry::CountTriangles(CachedActor);
+            return CachedActor;
+        }
+    }
+    
     // 파일 임포트
     FString DestinationPath = FString::Printf(TEXT("/Game/Datasmith/%s"), *PartNo);
     
+    // 임포트는 대상 경로의 에셋을 덮어쓰므로 기록 전에 실패해도 이전 파일 내용/설정의 캐시가 새 에셋을 스폰하지 않도록 먼저 제거
+    FImportResultCache::Get().RemoveEntriesForDestination(PartNo, DestinationPath);
+    
     // 진행 메시지 표시 (현재/전체)
     FString ProgressMessage;
     if (TotalCount > 1) {
@@ -698,14 +819,34 @@ AActor* FDatasmithSceneManager::ImportAndProcessDatasmith(const FString& FilePat
         ProgressMessage = TEXT("3DXML 파일 임포트 중...");
     }
     
-    // 프로그레스 대화상자 표시 - 현재/전체 노드 정보를 포함
-    GWarn->BeginSlowTask(FText::FromString(ProgressMessage), true);
-    
-    // 임포트 수행
-    TArray<UObject*> ImportedObjects = ImportDatasmithFile(FilePath, DestinationPath);
+    // 임포트 수행 (프로그레스 대화상자 표시 - 현재/전체 노드 정보를 포함)
+    TArray<UObject*> ImportedObjects;
+    {
+        IMPORT_STAGE_SCOPE(Record, Translate);
+        if (bShowProgressDialog)
+        {
+            GWarn->BeginSlowTask(FText::FromString(ProgressMessage), true);
+        }
+        ImportedObjects = ImportDatasmithFile(FilePath, DestinationPath);
+        if (bShowProgressDialog)
+        {
+            GWarn->EndSlowTask();
+        }
+    }
     
-    // 프로그레스 대화상자 종료
-    GWarn->EndSlowTask();
+    if (Settings.bSkipAssetSaving)
+    {
+        // 저장하지 않음 (패키지는 변경된 상태로 메모리에만 남음)
+    }
+    else if (Settings.bDeferAssetSaving)
+    {
+        // 배치 끝에 한 번에 저장 (디스크 크기는 저장 후 스케줄러가 기록)
+        CollectDirtyPackages(ImportedObjects, DestinationPath);
+    }
+    else
+    {
+        Record.BytesWritten = FImportTelemetry::GetContentFolderSize(DestinationPath);
+    }
     
     // DatasmithScene 객체 찾기
     for (UObject* Object : ImportedObjects)
@@ -717,54 +858,87 @@ AActor* FDatasmithSceneManager::ImportAndProcessDatasmith(const FString& FilePat
             {
                 UE_LOG(LogTemp, Display, TEXT("DatasmithScene 객체 찾음: %s"), *Object->GetName());
                 
-                // DatasmithSceneActor 찾기
-                AActor* SceneActor = FindDatasmithSceneActorFromImport(Object);
-                if (!SceneActor)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("DatasmithSceneActor를 찾을 수 없습니다."));
-                    return nullptr;
-                }
-                
-                // 자식 액터 찾기
+                AActor* SceneActor = nullptr;
                 AActor* TargetActor = nullptr;
-                TArray<AActor*> ChildActors;
-                SceneActor->GetAttachedActors(ChildActors);
-                
-                if (ChildActors.Num() > 0)
-                {
-                    TargetActor = ChildActors[0];
-                }
-                
-                if (!TargetActor)
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("자식 액터를 찾을 수 없습니다."));
-                    return nullptr;
+                    IMPORT_STAGE_SCOPE(Record, Spawn);
+                    
+                    // DatasmithSceneActor 찾기
+                    SceneActor = FindDatasmithSceneActorFromImport(Object);
+                    if (!SceneActor)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("DatasmithSceneActor를 찾을 수 없습니다."));
+                        return nullptr;
+                    }
+                    Record.ActorsCreated = FImportTelemetry::CountActors(SceneActor);
+                    
+                    // 자식 액터 찾기
+                    TArray<AActor*> ChildActors;
+                    SceneActor->GetAttachedActors(ChildActors);
+                    
+                    if (ChildActors.Num() > 0)
+                    {
+                        TargetActor = ChildActors[0];
+                    }
+                    
+                    if (!TargetActor)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("자식 액터를 찾을 수 없습니다."));
+                        return nullptr;
+                    }
+                    
+                    // 액터 이름 변경
+                    FString SafeActorName = PartNo;
+                    SafeActorName.ReplaceInline(TEXT(" "), TEXT("_"));
+                    SafeActorName.ReplaceInline(TEXT("-"), TEXT("_"));
+                    
+                    TargetActor->Rename(*SafeActorName);
+                    TargetActor->SetActorLabel(*PartNo);
+                    
+                    UE_LOG(LogTemp, Display, TEXT("액터 이름 변경 완료: %s"), *SafeActorName);
                 }
-                
-                // 액터 이름 변경
-                FString SafeActorName = PartNo;
-                SafeActorName.ReplaceInline(TEXT(" "), TEXT("_"));
-                SafeActorName.ReplaceInline(TEXT("-"), TEXT("_"));
-                
-                TargetActor->Rename(*SafeActorName);
-                TargetActor->SetActorLabel(*PartNo);
-                
-                UE_LOG(LogTemp, Display, TEXT("액터 이름 변경 완료: %s"), *SafeActorName);
 
                 // ImportSettings 적용 - 투명 메시 제거 옵션
                 if (Settings.bRemoveTransparentMeshes)
                 {
-                    RemoveTransparentMeshActors(TargetActor);
+                    IMPORT_STAGE_SCOPE(Record, Transparency);
+                    Record.ActorsDestroyed += RemoveTransparentMeshActors(TargetActor);
                 }
                 
                 // ImportSettings 적용 - StaticMesh만 유지 옵션
                 if (Settings.bCleanupNonStaticMeshActors)
                 {
-                    CleanupNonStaticMeshActors(TargetActor);
+                    {
+                        IMPORT_STAGE_SCOPE(Record, Cleanup);
+                        LastCleanupStats = CleanupNonStaticMeshActors(TargetActor);
+                        Record.ActorsDestroyed += LastCleanupStats.RemovedCount;
+                    }
 
-                    CenterActorPivot(TargetActor);
+                    {
+                        IMPORT_STAGE_SCOPE(Record, Pivot);
+                        CenterActorPivot(TargetActor);
+                    }
+                    
+                    // 루트 + 스태틱 메시 액터 구성이 확정되었으므로 임포트 결과 캐시에 기록
+                    // (에셋을 저장하지 않는 세션은 다음 세션에서 에셋을 찾을 수 없으므로 기록하지 않음)
+                    if (!Settings.bSkipAssetSaving)
+                    {
+                        IMPORT_STAGE_SCOPE(Record, CacheRecord);
+                        TArray<AStaticMeshActor*> MeshActors;
+                        FindAllStaticMeshActors(TargetActor, MeshActors);
+                        FImportResultCache::Get().RecordImport(FilePath, PartNo, Settings, TargetActor, MeshActors);
+                    }
+                    
+                    // 반복 메시를 인스턴스로 통합 (캐시에는 통합 전 구성이 기록됨)
+                    if (Settings.bConsolidateInstancedMeshes)
+                    {
+                        IMPORT_STAGE_SCOPE(Record, Consolidate);
+                        Record.ActorsDestroyed += ConsolidateInstancedMeshes(TargetActor);
+                    }
                 }
             	
+            	IMPORT_STAGE_SCOPE(Record, Finalize);
+            	
             	// Undo 시스템에 액터 등록 (CenterActorPivot 함수 호출 후)
             	TargetActor->SetFlags(RF_Transactional);
 
@@ -785,7 +959,10 @@ AActor* FDatasmithSceneManager::ImportAndProcessDatasmith(const FString& FilePat
                 // DatasmithSceneActor 제거
                 UE_LOG(LogTemp, Display, TEXT("DatasmithSceneActor 제거: %s"), *SceneActor->GetName());
                 SceneActor->Destroy();
+                Record.ActorsDestroyed++;
                 
+                Record.bSucceeded = true;
+                Record.TriangleCount = FImportTelemetry::CountTriangles(TargetActor);
                 return TargetActor;
             }
         }
@@ -796,10 +973,254 @@ AActor* FDatasmithSceneManager::ImportAndProcessDatasmith(const FString& FilePat
 }
 
 
-void FDatasmithSceneManager::RemoveTransparentMeshActors(AActor* RootActor)
+bool FDatasmithSceneManager::HasImportCacheEntry(const FString& FilePath)
+{
+    // SpawnFromImportCache와 같은 조건
+    return ImportSettings.bCleanupNonStaticMeshActors && FImportResultCache::Get().FindEntry(FilePath, ImportSettings) != nullptr;
+}
+
+TSharedPtr<FDatasmithTranslatableSceneSource> FDatasmithSceneManager::CreatePreTranslationSource(const FString& FilePath)
+{
+    check(IsInGameThread());
+    
+    FDatasmithSceneSource Source;
+    Source.SetSourceFile(FPaths::ConvertRelativePathToFull(FilePath));
+    
+    TSharedPtr<FDatasmithTranslatableSceneSource> TranslatableSource = MakeShared<FDatasmithTranslatableSceneSource>(Source);
+    TSharedPtr<IDatasmithTranslator> Translator = TranslatableSource->GetTranslator();
+    if (!TranslatableSource->IsTranslatable() || !Translator.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("사전 변환할 번역기를 찾을 수 없습니다: %s"), *FilePath);
+        return nullptr;
+    }
+    
+    // 옵션 객체 생성은 게임 스레드에서, 임포트와 같은 테셀레이션 값을 적용해야 CAD 캐시 키가 일치함
+    TArray<TObjectPtr<UDatasmithOptionsBase>> Options;
+    Translator->GetSceneImportOptions(Options);
+    for (UDatasmithOptionsBase* Option : Options)
+    {
+        if (UDatasmithCommonTessellationOptions* TessellationOptions = Cast<UDatasmithCommonTessellationOptions>(Option))
+        {
+            TessellationOptions->Options = DatasmithSceneManagerQuality::GetTessellationOptions(ImportSettings.QualityTier);
+        }
+    }
+    Translator->SetSceneImportOptions(Options);
+    
+    return TranslatableSource;
+}
+
+bool FDatasmithSceneManager::ConfigureCADPreTranslation(int32 ConcurrentTranslations, TMap<FString, FString>& OutSavedConsoleVariables)
+{
+    OutSavedConsoleVariables.Empty();
+    
+    // 코어 하나는 에디터(게임 스레드)용으로 남기고, 동시에 변환하는 파일끼리 워커 프로세스를 나눔
+    const int32 WorkerCount = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 1);
+    const int32 WorkersPerFile = FMath::Max(1, WorkerCount / FMath::Max(1, ConcurrentTranslations));
+    
+    const TPair<const TCHAR*, FString> Overrides[] = {
+        { DatasmithSceneManagerCAD::EnableThreadedImportCVar, TEXT("1") },
+        { DatasmithSceneManagerCAD::MaxImportThreadsCVar, FString::FromInt(WorkersPerFile) },
+        { DatasmithSceneManagerCAD::EnableCADCacheCVar, TEXT("1") },
+    };
+    
+    for (const TPair<const TCHAR*, FString>& Override : Overrides)
+    {
+        IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Override.Key);
+        if (!CVar)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("CAD 사전 변환: 콘솔 변수 없음 - %s"), Override.Key);
+            continue;
+        }
+        
+        OutSavedConsoleVariables.Add(Override.Key, CVar->GetString());
+        CVar->Set(*Override.Value, ECVF_SetByCode);
+    }
+    
+    // 번역기 내부 CAD 라이브러리는 스레드 안전하지 않으므로 워커 프로세스 변환일 때만 동시 변환,
+    // 변환 결과를 게임 스레드 임포트가 재사용하려면 CAD 캐시도 필요
+    const bool bCanPreTranslate = OutSavedConsoleVariables.Contains(DatasmithSceneManagerCAD::EnableThreadedImportCVar)
+        && OutSavedConsoleVariables.Contains(DatasmithSceneManagerCAD::EnableCADCacheCVar);
+    
+    UE_LOG(LogTemp, Display, TEXT("CAD 번역기 워커 %d개 (동시 변환 %d개 x 파일당 %d개)%s"),
+        WorkerCount, ConcurrentTranslations, WorkersPerFile, bCanPreTranslate ? TEXT("") : TEXT(" - 사전 변환 미지원, 게임 스레드에서 변환"));
+    
+    return bCanPreTranslate;
+}
+
+void FDatasmithSceneManager::RestoreConsoleVariables(TMap<FString, FString>& SavedConsoleVariables)
+{
+    for (const TPair<FString, FString>& Saved : SavedConsoleVariables)
+    {
+        if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*Saved.Key))
+        {
+            CVar->Set(*Saved.Value, ECVF_SetByCode);
+        }
+    }
+    SavedConsoleVariables.Empty();
+}
+
+AActor* FDatasmithSceneManager::SpawnFromImportCache(const FString& FilePath, const FString& PartNo)
+{
+    // 캐시는 루트 + 스태틱 메시 액터 구성만 재현하므로 정리 옵션이 꺼져 있으면 사용하지 않음
+    if (!ImportSettings.bCleanupNonStaticMeshActors || !GEditor)
+        return nullptr;
+    
+    const FImportCacheEntry* Entry = FImportResultCache::Get().FindEntry(FilePath, ImportSettings);
+    if (!Entry)
+        return nullptr;
+    
+    UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
+    AActor* RootActor = FImportResultCache::Get().SpawnFromCache(EditorWorld, *Entry);
+    if (!RootActor)
+        return nullptr;
+    
+    // 액터 이름 변경 (일반 임포트와 동일한 규칙)
+    FString SafeActorName = PartNo;
+    SafeActorName.ReplaceInline(TEXT(" "), TEXT("_"));
+    SafeActorName.ReplaceInline(TEXT("-"), TEXT("_"));
+    
+    RootActor->Rename(*SafeActorName);
+    RootActor->SetActorLabel(*PartNo);
+    
+    // 반복 메시를 인스턴스로 통합
+    if (ImportSettings.bConsolidateInstancedMeshes)
+    {
+        ConsolidateInstancedMeshes(RootActor);
+    }
+    
+    // Undo 시스템에 액터 등록
+    RootActor->SetFlags(RF_Transactional);
+    TArray<UActorComponent*> Components;
+    RootActor->GetComponents(Components);
+    for (UActorComponent* Component : Components)
+    {
+        if (Component)
+        {
+            Component->SetFlags(RF_Transactional);
+        }
+    }
+    
+    // 임포트된 노드 관리자에 등록
+    FImportedNodeManager::Get().RegisterImportedNode(PartNo, RootActor);
+    
+    UE_LOG(LogTemp, Display, TEXT("임포트 캐시 사용: %s (CAD 변환 생략)"), *PartNo);
+    return RootActor;
+}
+
+namespace
+{
+    /** 인스턴스 통합 그룹 키: 스태틱 메시 + 슬롯별 머티리얼 */
+    struct FInstanceGroupKey
+    {
+        UStaticMesh* StaticMesh = nullptr;
+        TArray<UMaterialInterface*> Materials;
+        
+        bool operator==(const FInstanceGroupKey& Other) const
+        {
+            return StaticMesh == Other.StaticMesh && Materials == Other.Materials;
+        }
+        
+        friend uint32 GetTypeHash(const FInstanceGroupKey& Key)
+        {
+            uint32 Hash = ::GetTypeHash(Key.StaticMesh);
+            for (UMaterialInterface* Material : Key.Materials)
+            {
+                Hash = HashCombine(Hash, ::GetTypeHash(Material));
+            }
+            return Hash;
+        }
+    };
+}
+
+int32 FDatasmithSceneManager::ConsolidateInstancedMeshes(AActor* RootActor)
+{
+    if (!RootActor || !RootActor->GetRootComponent())
+        return 0;
+    
+    // 루트 아래 스태틱 메시 액터를 그룹별로 분류
+    TArray<AStaticMeshActor*> StaticMeshActors;
+    FindAllStaticMeshActors(RootActor, StaticMeshActors);
+    
+    TMap<FInstanceGroupKey, TArray<AStaticMeshActor*>> Groups;
+    for (AStaticMeshActor* MeshActor : StaticMeshActors)
+    {
+        UStaticMeshComponent* MeshComp = MeshActor ? MeshActor->GetStaticMeshComponent() : nullptr;
+        if (!MeshComp || !MeshComp->GetStaticMesh())
+            continue;
+        
+        FInstanceGroupKey Key;
+        Key.StaticMesh = MeshComp->GetStaticMesh();
+        Key.Materials.Reserve(MeshComp->GetNumMaterials());
+        for (int32 i = 0; i < MeshComp->GetNumMaterials(); ++i)
+        {
+            Key.Materials.Add(MeshComp->GetMaterial(i));
+        }
+        
+        Groups.FindOrAdd(MoveTemp(Key)).Add(MeshActor);
+    }
+    
+    const int32 MinInstances = FMath::Max(2, ImportSettings.MinInstancesPerGroup);
+    int32 ReplacedCount = 0;
+    int32 ComponentCount = 0;
+    
+    for (TPair<FInstanceGroupKey, TArray<AStaticMeshActor*>>& Group : Groups)
+    {
+        TArray<AStaticMeshActor*>& GroupActors = Group.Value;
+        if (GroupActors.Num() < MinInstances)
+            continue;
+        
+        UStaticMeshComponent* TemplateComp = GroupActors[0]->GetStaticMeshComponent();
+        
+        // 인스턴스 컴포넌트 생성 (메시 이름 기준)
+        const FName ComponentName = MakeUniqueObjectName(RootActor, UPartInstancedMeshComponent::StaticClass(),
+            FName(*FString::Printf(TEXT("ISM_%s"), *Group.Key.StaticMesh->GetName())));
+        
+        UPartInstancedMeshComponent* InstancedComp = NewObject<UPartInstancedMeshComponent>(RootActor, ComponentName, RF_Transactional);
+        InstancedComp->SetMobility(RootActor->GetRootComponent()->Mobility);
+        InstancedComp->SetStaticMesh(Group.Key.StaticMesh);
+        for (int32 i = 0; i < Group.Key.Materials.Num(); ++i)
+        {
+            InstancedComp->SetMaterial(i, Group.Key.Materials[i]);
+        }
+        InstancedComp->SetCollisionProfileName(TemplateComp->GetCollisionProfileName());
+        InstancedComp->SetCastShadow(TemplateComp->CastShadow);
+        InstancedComp->SetupAttachment(RootActor->GetRootComponent());
+        RootActor->AddInstanceComponent(InstancedComp);
+        InstancedComp->RegisterComponent();
+        
+        // 인스턴스 변환과 라벨 수집 후 한 번에 추가
+        TArray<FTransform> InstanceTransforms;
+        InstanceTransforms.Reserve(GroupActors.Num());
+        InstancedComp->InstancePartLabels.Reserve(GroupActors.Num());
+        
+        for (AStaticMeshActor* MeshActor : GroupActors)
+        {
+            InstanceTransforms.Add(MeshActor->GetStaticMeshComponent()->GetComponentTransform());
+            InstancedComp->InstancePartLabels.Add(MeshActor->GetActorLabel());
+        }
+        
+        InstancedComp->AddInstances(InstanceTransforms, false, true);
+        
+        // 원래 액터 제거
+        for (AStaticMeshActor* MeshActor : GroupActors)
+        {
+            MeshActor->Destroy();
+        }
+        
+        FImportedNodeManager::Get().RegisterInstancedParts(InstancedComp);
+        
+        ReplacedCount += GroupActors.Num();
+        ComponentCount++;
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("인스턴스 통합 완료: 메시 액터 %d개 -> 인스턴스 컴포넌트 %d개"), ReplacedCount, ComponentCount);
+    return ReplacedCount;
+}
+
+int32 FDatasmithSceneManager::RemoveTransparentMeshActors(AActor* RootActor)
 {
 	if (!RootActor)
-		return;
+		return 0;
     
 	// 모든 StaticMesh 액터 찾기
 	TArray<AStaticMeshActor*> StaticMeshActors;
@@ -809,6 +1230,8 @@ void FDatasmithSceneManager::RemoveTransparentMeshActors(AActor* RootActor)
     
 	// 제거할 투명 메시 액터 목록
 	TArray<AStaticMeshActor*> ActorsToRemove;
+	FMaterialClassificationCache& MaterialCache = FMaterialClassificationCache::Get();
+	const int32 CachedBefore = MaterialCache.Num();
     
 	// 각 메시 액터에 대해 투명도 확인
 	for (AStaticMeshActor* MeshActor : StaticMeshActors)
@@ -816,27 +1239,14 @@ void FDatasmithSceneManager::RemoveTransparentMeshActors(AActor* RootActor)
 		if (!MeshActor || !MeshActor->GetStaticMeshComponent())
 			continue;
         
-		UStaticMeshComponent* MeshComp = MeshActor->GetStaticMeshComponent();
-		bool bHasTransparentMaterial = false;
-        
-		// 메시의 모든 머티리얼 확인
-		for (int32 i = 0; i < MeshComp->GetNumMaterials(); ++i)
-		{
-			UMaterialInterface* Material = MeshComp->GetMaterial(i);
-			if (HasTransparency(Material))
-			{
-				bHasTransparentMaterial = true;
-				UE_LOG(LogTemp, Verbose, TEXT("투명 머티리얼 발견: %s (액터: %s)"), 
-					  Material ? *Material->GetName() : TEXT("None"),
-					  *MeshActor->GetName());
-				break;
-			}
-		}
+		// 메시의 모든 머티리얼 확인 (분류 결과는 머티리얼 경로별 캐시에서 조회)
+		const TArray<UMaterialInterface*> Materials = MeshActor->GetStaticMeshComponent()->GetMaterials();
         
 		// 투명 머티리얼이 있는 메시 액터는 제거 목록에 추가
-		if (bHasTransparentMaterial)
+		if (MaterialCache.HasAnyTransparent(Materials))
 		{
 			ActorsToRemove.Add(MeshActor);
+			UE_LOG(LogTemp, Verbose, TEXT("투명 머티리얼 메시 액터: %s"), *MeshActor->GetName());
 		}
 	}
     
@@ -854,8 +1264,10 @@ void FDatasmithSceneManager::RemoveTransparentMeshActors(AActor* RootActor)
 		}
 	}
     
-	UE_LOG(LogTemp, Display, TEXT("투명 메시 액터 제거 완료: %d개 제거됨 (총 %d개 중)"), 
-		  RemovedCount, StaticMeshActors.Num());
+	UE_LOG(LogTemp, Display, TEXT("투명 메시 액터 제거 완료: %d개 제거됨 (총 %d개 중, 새로 분류된 머티리얼 %d개)"), 
+		  RemovedCount, StaticMeshActors.Num(), MaterialCache.Num() - CachedBefore);
+	
+	return RemovedCount;
 }
 
 bool FDatasmithSceneManager::CenterActorPivot(AActor* TargetActor)
@@ -915,61 +1327,11 @@ bool FDatasmithSceneManager::CenterActorPivot(AActor* TargetActor)
     // 평균 위치 계산
     FVector AveragePosition = TotalPosition / MeshCount;
     
-    // 에디터 트랜잭션 시작
+    // 에디터 트랜잭션 시작 (피벗 이동과 재연결을 하나의 Undo 단계로)
     GEditor->BeginTransaction(FText::FromString(TEXT("Center Pivot")));
     
-    UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
-    if (!EditorWorld)
-    {
-        GEditor->EndTransaction();
-        UE_LOG(LogTemp, Warning, TEXT("피벗 중앙화 실패: 에디터 월드를 찾을 수 없습니다."));
-        return false;
-    }
-    
-    // 원래 월드 변환 저장
-    FTransform OriginalTransform = TargetActor->GetActorTransform();
-    
-    // 새 루트 컴포넌트가 필요한 경우 생성
-    USceneComponent* RootComp = TargetActor->GetRootComponent();
-    if (!RootComp || !RootComp->IsA<UStaticMeshComponent>())
-    {
-        // 새 스태틱 메시 컴포넌트 생성
-        UStaticMeshComponent* NewRootComp = NewObject<UStaticMeshComponent>(
-            TargetActor, 
-            UStaticMeshComponent::StaticClass(), 
-            TEXT("CenteredRootComp")
-        );
-        
-        if (NewRootComp)
-        {
-            NewRootComp->RegisterComponent();
-            NewRootComp->SetWorldLocation(AveragePosition);
-            NewRootComp->SetMobility(EComponentMobility::Static);
-            NewRootComp->SetVisibility(false);
-            NewRootComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-            
-            // 기존 루트 컴포넌트 교체
-            TargetActor->SetRootComponent(NewRootComp);
-        }
-    }
-    else
-    {
-        // 기존 루트 컴포넌트 위치 변경
-        RootComp->SetWorldLocation(AveragePosition);
-    }
-    
-    // 모든 StaticMeshActor를 새 중심에 맞게 조정
-    for (AStaticMeshActor* MeshActor : StaticMeshActors)
-    {
-        if (!MeshActor) continue;
-        
-        // 월드 변환 저장하고 부모 변경
-        FTransform RelativeTransform = MeshActor->GetActorTransform();
-        
-        // 월드 좌표 유지하면서 부모 다시 지정
-        MeshActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
-        MeshActor->AttachToActor(TargetActor, FAttachmentTransformRules::KeepWorldTransform);
-    }
+    // 상대 변환을 한 번에 계산하고 변환 전파는 피벗 이동 한 번으로 처리
+    FTreeViewUtils::MovePivotAndReparent(TargetActor, StaticMeshActors, AveragePosition);
     
     UE_LOG(LogTemp, Display, TEXT("피벗 중앙화 완료. 메시 개수: %d, 중심 위치: [%.2f, %.2f, %.2f]"), 
            MeshCount, AveragePosition.X, AveragePosition.Y, AveragePosition.Z);
@@ -980,99 +1342,113 @@ bool FDatasmithSceneManager::CenterActorPivot(AActor* TargetActor)
     return true;
 }
 
-void FDatasmithSceneManager::CleanupNonStaticMeshActors(AActor* RootActor)
+FActorCleanupStats FDatasmithSceneManager::CleanupNonStaticMeshActors(AActor* RootActor)
 {
+    FActorCleanupStats Stats;
     if (!RootActor)
-        return;
-        
-    // 모든 StaticMesh 액터 찾기
-    TArray<AStaticMeshActor*> StaticMeshActors;
-    FindAllStaticMeshActors(RootActor, StaticMeshActors);
+        return Stats;
     
-    UE_LOG(LogTemp, Display, TEXT("StaticMesh 액터 발견: %d개"), StaticMeshActors.Num());
+    const double StartTime = FPlatformTime::Seconds();
     
-    // 모든 StaticMesh 액터를 루트 액터에 직접 연결
-    for (AStaticMeshActor* MeshActor : StaticMeshActors)
+    // 하위 구조를 하나의 작업 목록으로 평탄화
+    TArray<AActor*> Descendants;
+    GatherDescendantsBreadthFirst(RootActor, Descendants);
+    
+    // 스태틱 메시 액터와 제거할 액터 분류
+    TArray<AStaticMeshActor*> MeshActorsToReparent;
+    TArray<AActor*> ActorsToRemove;
+    MeshActorsToReparent.Reserve(Descendants.Num());
+    ActorsToRemove.Reserve(Descendants.Num());
+    
+    for (AActor* Actor : Descendants)
     {
-        // 이미 직접 자식이면 건너뛰기
-        AActor* CurrentParent = MeshActor->GetAttachParentActor();
-        if (CurrentParent == RootActor)
-            continue;
-            
-        // 월드 변환 저장
-        FTransform OriginalTransform = MeshActor->GetActorTransform();
-        
-        // 현재 부모에서 분리
-        MeshActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
-        
-        // 루트 액터에 직접 연결
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
+        {
+            // 이미 직접 자식이면 건너뛰기
+            if (MeshActor->GetAttachParentActor() != RootActor)
+            {
+                MeshActorsToReparent.Add(MeshActor);
+            }
+        }
+        else
+        {
+            ActorsToRemove.Add(Actor);
+        }
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("하위 액터 %d개 평탄화: 루트로 옮길 StaticMesh 액터 %d개, 제거할 액터 %d개"), 
+           Descendants.Num(), MeshActorsToReparent.Num(), ActorsToRemove.Num());
+    
+    // 1단계: 스태틱 메시 액터를 한 번에 루트로 이동 (중간 부모는 움직이지 않으므로 순서 무관)
+    for (AStaticMeshActor* MeshActor : MeshActorsToReparent)
+    {
+        // AttachToActor가 기존 부모에서 분리까지 처리하므로 별도의 분리 호출 없음
         MeshActor->AttachToActor(RootActor, FAttachmentTransformRules::KeepWorldTransform);
+    }
+    Stats.ReparentedCount = MeshActorsToReparent.Num();
+    
+    // 2단계: 깊은 액터부터 일괄 제거 (제거 시점에는 자식이 남아 있지 않아 재연결이 일어나지 않음)
+    UWorld* World = RootActor->GetWorld();
+    if (World && ActorsToRemove.Num() > 0)
+    {
+        // 레벨 수정 표시는 한 번만
+        if (ULevel* Level = RootActor->GetLevel())
+        {
+            Level->Modify();
+        }
         
-        UE_LOG(LogTemp, Verbose, TEXT("StaticMesh 액터 '%s'를 루트에 직접 연결"), *MeshActor->GetName());
+        for (int32 Index = ActorsToRemove.Num() - 1; Index >= 0; --Index)
+        {
+            if (World->DestroyActor(ActorsToRemove[Index], false, false))
+            {
+                Stats.RemovedCount++;
+            }
+        }
     }
     
-    // StaticMesh가 아닌 자식 액터 제거
-    int32 RemovedCount = 0;
-    RemoveNonStaticMeshChildren(RootActor, RemovedCount);
+    Stats.Seconds = FPlatformTime::Seconds() - StartTime;
     
-    UE_LOG(LogTemp, Display, TEXT("StaticMesh가 아닌 액터 제거 완료: %d개 제거됨"), RemovedCount);
+    UE_LOG(LogTemp, Display, TEXT("StaticMesh가 아닌 액터 제거 완료: %d개 제거됨, StaticMesh 액터 %d개 재연결 (%.3f초)"), 
+           Stats.RemovedCount, Stats.ReparentedCount, Stats.Seconds);
+    
+    return Stats;
 }
 
-void FDatasmithSceneManager::FindAllStaticMeshActors(AActor* RootActor, TArray<AStaticMeshActor*>& OutStaticMeshActors)
+void FDatasmithSceneManager::GatherDescendantsBreadthFirst(AActor* RootActor, TArray<AActor*>& OutActors)
 {
+    OutActors.Reset();
     if (!RootActor)
         return;
     
-    // 자식 액터 목록 가져오기
-    TArray<AActor*> ChildActors;
-    RootActor->GetAttachedActors(ChildActors);
-    
-    // 각 자식 액터에 대해 처리
-    for (AActor* ChildActor : ChildActors)
+    // 루트의 직접 자식부터 시작해서, 목록을 앞에서부터 훑으며 자식을 뒤에 덧붙임 (추가 배열 할당 없음)
+    RootActor->GetAttachedActors(OutActors, false);
+    for (int32 Index = 0; Index < OutActors.Num(); ++Index)
     {
-        if (ChildActor)
+        if (AActor* Actor = OutActors[Index])
         {
-            // StaticMeshActor인 경우 결과 배열에 추가
-            if (ChildActor->IsA(AStaticMeshActor::StaticClass()))
-            {
-                OutStaticMeshActors.Add(Cast<AStaticMeshActor>(ChildActor));
-            }
-            
-            // 하위 액터들을 재귀적으로 검색
-            FindAllStaticMeshActors(ChildActor, OutStaticMeshActors);
+            Actor->GetAttachedActors(OutActors, false);
         }
     }
+    
+    // 무효 항목 제거 (부모-자식 순서 유지)
+    OutActors.RemoveAll([](const AActor* Actor) { return Actor == nullptr; });
 }
 
-void FDatasmithSceneManager::RemoveNonStaticMeshChildren(AActor* Actor, int32& OutRemovedCount)
+void FDatasmithSceneManager::FindAllStaticMeshActors(AActor* RootActor, TArray<AStaticMeshActor*>& OutStaticMeshActors)
 {
-    if (!Actor)
+    if (!RootActor)
         return;
     
-    // 자식 액터 목록 가져오기
-    TArray<AActor*> ChildActors;
-    Actor->GetAttachedActors(ChildActors);
+    // 하위 구조를 한 번에 평탄화한 뒤 StaticMeshActor만 수집
+    TArray<AActor*> Descendants;
+    GatherDescendantsBreadthFirst(RootActor, Descendants);
     
-    // 각 자식 액터에 대해 처리
-    for (AActor* ChildActor : ChildActors)
+    OutStaticMeshActors.Reserve(OutStaticMeshActors.Num() + Descendants.Num());
+    for (AActor* Actor : Descendants)
     {
-        if (ChildActor)
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
         {
-            // StaticMeshActor인 경우 스킵하고 보존
-            if (ChildActor->IsA(AStaticMeshActor::StaticClass()))
-            {
-                UE_LOG(LogTemp, Verbose, TEXT("StaticMeshActor 유지: %s"), *ChildActor->GetName());
-            }
-            else
-            {
-                // 일반 Actor인 경우, 그 자식들을 먼저 재귀적으로 처리
-                RemoveNonStaticMeshChildren(ChildActor, OutRemovedCount);
-                
-                // 그 다음 현재 Actor 제거
-                UE_LOG(LogTemp, Verbose, TEXT("액터 제거: %s"), *ChildActor->GetName());
-                ChildActor->Destroy();
-                OutRemovedCount++;
-            }
+            OutStaticMeshActors.Add(MeshActor);
         }
     }
 }
@@ -1080,35 +1456,6 @@ void FDatasmithSceneManager::RemoveNonStaticMeshChildren(AActor* Actor, int32& O
 // DatasmithSceneManager에 함수 추가
 bool FDatasmithSceneManager::IsAlreadyImportedInLevel(const FString& PartNo) const
 {
-    // 1. 매니저에 등록되어 있는지 확인
-    bool bRegisteredInManager = FImportedNodeManager::Get().IsNodeImported(PartNo);
-    
-    // 2. 레벨에 실제로 존재하는지 태그로 검색하여 확인
-    bool bExistsInLevel = false;
-    
-#if WITH_EDITOR
-    if (GEditor)
-    {
-        UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
-        if (EditorWorld)
-        {
-            // ImportedTag와 파트번호 태그를 모두 가진 액터 검색
-            FName ImportedTag = FImportedNodeManager::ImportedTag; // "Imported3DXML"
-            FName PartTag = FName(*FString::Printf(TEXT("ImportedPart_%s"), *PartNo));
-            
-            for (TActorIterator<AActor> It(EditorWorld); It; ++It)
-            {
-                AActor* Actor = *It;
-                if (Actor && Actor->ActorHasTag(ImportedTag) && Actor->ActorHasTag(PartTag))
-                {
-                    bExistsInLevel = true;
-                    break;
-                }
-            }
-        }
-    }
-#endif
-    
-    // 둘 중 하나라도 true면 임포트된 것으로 간주
-    return bRegisteredInManager || bExistsInLevel;
+    // 임포트 노드 관리자가 레벨 액터 추가/삭제/태그 변경을 추적하므로 관리자 조회만으로 충분
+    return FImportedNodeManager::Get().IsNodeImported(PartNo);
 }
@@ -0,0 +1,436 @@
+﻿// ImportResultCache.cpp
+// 3DXML 임포트 결과 캐시 구현
+
+#include "ImportResultCache.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+// 정적 멤버 초기화
+FImportResultCache* FImportResultCache::Instance = nullptr;
+
+namespace ImportResultCacheJson
+{
+	/** 변환을 JSON 배열로 저장 (위치 3 + 회전 쿼터니언 4 + 스케일 3) */
+	TArray<TSharedPtr<FJsonValue>> TransformToJson(const FTransform& Transform)
+	{
+		const FVector Location = Transform.GetLocation();
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Scale = Transform.GetScale3D();
+		
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (double Value : { Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, Scale.X, Scale.Y, Scale.Z })
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+		return Values;
+	}
+
+	/** JSON 배열에서 변환 복원 */
+	bool TransformFromJson(const TArray<TSharedPtr<FJsonValue>>& Values, FTransform& OutTransform)
+	{
+		if (Values.Num() != 10)
+			return false;
+		
+		OutTransform.SetLocation(FVector(Values[0]->AsNumber(), Values[1]->AsNumber(), Values[2]->AsNumber()));
+		OutTransform.SetRotation(FQuat(Values[3]->AsNumber(), Values[4]->AsNumber(), Values[5]->AsNumber(), Values[6]->AsNumber()).GetNormalized());
+		OutTransform.SetScale3D(FVector(Values[7]->AsNumber(), Values[8]->AsNumber(), Values[9]->AsNumber()));
+		return true;
+	}
+
+	/** 에셋이 디스크에 저장되는 경로인지 확인 (트랜지언트 에셋은 캐시할 수 없음) */
+	bool IsPersistentAsset(const UObject* Asset)
+	{
+		return Asset && Asset->GetPathName().StartsWith(TEXT("/Game/"));
+	}
+}
+
+FImportResultCache& FImportResultCache::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FImportResultCache();
+	}
+	return *Instance;
+}
+
+FImportResultCache::FImportResultCache()
+{
+	LoadFromDisk();
+}
+
+FString FImportResultCache::GetCacheFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ImportCache"), TEXT("ImportResultCache.json"));
+}
+
+FString FImportResultCache::GetFileHash(const FString& FilePath)
+{
+	const FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+	
+	FFileStatData StatData = IFileManager::Get().GetStatData(*FullPath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		return FString();
+	}
+	
+	// 크기와 수정 시간이 같으면 이전에 계산한 해시 사용
+	if (const FFileHashMemo* Memo = FileHashMemos.Find(FullPath))
+	{
+		if (Memo->FileSize == StatData.FileSize && Memo->TimeStamp == StatData.ModificationTime)
+		{
+			return Memo->Hash;
+		}
+	}
+	
+	FMD5Hash Hash = FMD5Hash::HashFile(*FullPath);
+	if (!Hash.IsValid())
+	{
+		return FString();
+	}
+	
+	FFileHashMemo& NewMemo = FileHashMemos.Add(FullPath);
+	NewMemo.FileSize = StatData.FileSize;
+	NewMemo.TimeStamp = StatData.ModificationTime;
+	NewMemo.Hash = LexToString(Hash);
+	
+	return NewMemo.Hash;
+}
+
+FString FImportResultCache::MakeCacheKey(const FString& FileHash, const FImportSettings& Settings)
+{
+	return FString::Printf(TEXT("%s_%08x"), *FileHash, Settings.GetImportResultHash());
+}
+
+FString FImportResultCache::MakeCacheKeyFromEntry(const FImportCacheEntry& Entry)
+{
+	return FString::Printf(TEXT("%s_%08x"), *Entry.FileHash, Entry.SettingsHash);
+}
+
+const FImportCacheEntry* FImportResultCache::FindEntry(const FString& FilePath, const FImportSettings& Settings)
+{
+	if (Entries.Num() == 0)
+		return nullptr;
+	
+	const FString FileHash = GetFileHash(FilePath);
+	if (FileHash.IsEmpty())
+		return nullptr;
+	
+	return Entries.Find(MakeCacheKey(FileHash, Settings));
+}
+
+bool FImportResultCache::RecordImport(const FString& FilePath, const FString& PartNo, const FImportSettings& Settings,
+	AActor* RootActor, const TArray<AStaticMeshActor*>& MeshActors)
+{
+	if (!RootActor || MeshActors.Num() == 0)
+		return false;
+	
+	const FString FileHash = GetFileHash(FilePath);
+	if (FileHash.IsEmpty())
+		return false;
+	
+	FImportCacheEntry Entry;
+	Entry.PartNo = PartNo;
+	Entry.SourceFilePath = FPaths::ConvertRelativePathToFull(FilePath);
+	Entry.FileHash = FileHash;
+	Entry.SettingsHash = Settings.GetImportResultHash();
+	Entry.RootTransform = RootActor->GetActorTransform();
+	Entry.Meshes.Reserve(MeshActors.Num());
+	
+	for (AStaticMeshActor* MeshActor : MeshActors)
+	{
+		UStaticMeshComponent* MeshComp = MeshActor ? MeshActor->GetStaticMeshComponent() : nullptr;
+		if (!MeshComp)
+			continue;
+		
+		UStaticMesh* StaticMesh = MeshComp->GetStaticMesh();
+		if (!ImportResultCacheJson::IsPersistentAsset(StaticMesh))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("임포트 캐시 기록 건너뜀 (저장되지 않은 메시): %s"), *MeshActor->GetName());
+			return false;
+		}
+		
+		FImportCacheMeshEntry& MeshEntry = Entry.Meshes.AddDefaulted_GetRef();
+		MeshEntry.ActorLabel = MeshActor->GetActorLabel();
+		MeshEntry.StaticMeshPath = StaticMesh->GetPathName();
+		MeshEntry.RelativeTransform = MeshActor->GetActorTransform().GetRelativeTransform(Entry.RootTransform);
+		
+		for (int32 i = 0; i < MeshComp->GetNumMaterials(); ++i)
+		{
+			UMaterialInterface* Material = MeshComp->GetMaterial(i);
+			MeshEntry.MaterialPaths.Add(ImportResultCacheJson::IsPersistentAsset(Material) ? Material->GetPathName() : FString());
+		}
+	}
+	
+	// 같은 에셋 경로를 쓰는 이전 파일 내용/설정의 항목은 덮어쓴 에셋을 가리키므로 제거
+	const FString CacheKey = MakeCacheKey(FileHash, Settings);
+	const int32 EvictedCount = EvictConflictingEntries(Entry, CacheKey);
+	Entries.Add(CacheKey, MoveTemp(Entry));
+	SaveToDisk();
+	
+	UE_LOG(LogTemp, Display, TEXT("임포트 캐시 기록: %s (메시 액터 %d개, 키 %s, 이전 항목 %d개 제거)"), *PartNo, MeshActors.Num(), *CacheKey, EvictedCount);
+	return true;
+}
+
+AActor* FImportResultCache::SpawnFromCache(UWorld* World, const FImportCacheEntry& Entry)
+{
+	if (!World)
+		return nullptr;
+	
+	const FString CacheKey = MakeCacheKeyFromEntry(Entry);
+	
+	// 스폰 전에 모든 에셋을 먼저 로드 (하나라도 없으면 캐시 무효)
+	TArray<UStaticMesh*> Meshes;
+	TArray<TArray<UMaterialInterface*>> Materials;
+	Meshes.Reserve(Entry.Meshes.Num());
+	Materials.Reserve(Entry.Meshes.Num());
+	
+	for (const FImportCacheMeshEntry& MeshEntry : Entry.Meshes)
+	{
+		UStaticMesh* StaticMesh = LoadObject<UStaticMesh>(nullptr, *MeshEntry.StaticMeshPath);
+		if (!StaticMesh)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("임포트 캐시 무효화 (메시 에셋 없음): %s"), *MeshEntry.StaticMeshPath);
+			RemoveEntry(CacheKey);
+			return nullptr;
+		}
+		Meshes.Add(StaticMesh);
+		
+		TArray<UMaterialInterface*>& MeshMaterials = Materials.AddDefaulted_GetRef();
+		for (const FString& MaterialPath : MeshEntry.MaterialPaths)
+		{
+			MeshMaterials.Add(MaterialPath.IsEmpty() ? nullptr : LoadObject<UMaterialInterface>(nullptr, *MaterialPath));
+		}
+	}
+	
+	// 루트 액터 스폰
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	
+	AActor* RootActor = World->SpawnActor<AActor>(AActor::StaticClass(), Entry.RootTransform, SpawnParams);
+	if (!RootActor)
+		return nullptr;
+	
+	USceneComponent* RootComponent = NewObject<USceneComponent>(RootActor, TEXT("Root"), RF_Transactional);
+	RootComponent->SetMobility(EComponentMobility::Static);
+	RootActor->SetRootComponent(RootComponent);
+	RootActor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
+	RootActor->SetActorTransform(Entry.RootTransform);
+	
+	// 스태틱 메시 액터 스폰 및 연결
+	for (int32 Index = 0; Index < Entry.Meshes.Num(); ++Index)
+	{
+		const FImportCacheMeshEntry& MeshEntry = Entry.Meshes[Index];
+		const FTransform WorldTransform = MeshEntry.RelativeTransform * Entry.RootTransform;
+		
+		AStaticMeshActor* MeshActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), WorldTransform, SpawnParams);
+		if (!MeshActor)
+			continue;
+		
+		UStaticMeshComponent* MeshComp = MeshActor->GetStaticMeshComponent();
+		MeshComp->SetStaticMesh(Meshes[Index]);
+		for (int32 Slot = 0; Slot < Materials[Index].Num(); ++Slot)
+		{
+			if (Materials[Index][Slot])
+			{
+				MeshComp->SetMaterial(Slot, Materials[Index][Slot]);
+			}
+		}
+		
+		MeshActor->SetActorLabel(MeshEntry.ActorLabel);
+		MeshActor->AttachToActor(RootActor, FAttachmentTransformRules::KeepWorldTransform);
+	}
+	
+	UE_LOG(LogTemp, Display, TEXT("임포트 캐시에서 스폰: %s (메시 액터 %d개)"), *Entry.PartNo, Entry.Meshes.Num());
+	return RootActor;
+}
+
+void FImportResultCache::RemoveEntry(const FString& CacheKey)
+{
+	if (Entries.Remove(CacheKey) > 0)
+	{
+		SaveToDisk();
+	}
+}
+
+int32 FImportResultCache::RemoveEntriesForDestination(const FString& PartNo, const FString& DestinationPath)
+{
+	const FString DestinationPrefix = DestinationPath / TEXT("");
+	
+	int32 RemovedCount = 0;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		const FImportCacheEntry& Entry = It.Value();
+		bool bConflicts = Entry.PartNo == PartNo;
+		for (int32 Index = 0; !bConflicts && Index < Entry.Meshes.Num(); ++Index)
+		{
+			bConflicts = Entry.Meshes[Index].StaticMeshPath.StartsWith(DestinationPrefix);
+		}
+		
+		if (bConflicts)
+		{
+			It.RemoveCurrent();
+			++RemovedCount;
+		}
+	}
+	
+	if (RemovedCount > 0)
+	{
+		SaveToDisk();
+		UE_LOG(LogTemp, Display, TEXT("임포트 캐시 항목 제거 (재임포트로 에셋 덮어씀): %s - %d개"), *DestinationPath, RemovedCount);
+	}
+	return RemovedCount;
+}
+
+int32 FImportResultCache::EvictConflictingEntries(const FImportCacheEntry& NewEntry, const FString& KeepKey)
+{
+	TSet<FString> NewMeshPaths;
+	NewMeshPaths.Reserve(NewEntry.Meshes.Num());
+	for (const FImportCacheMeshEntry& MeshEntry : NewEntry.Meshes)
+	{
+		NewMeshPaths.Add(MeshEntry.StaticMeshPath);
+	}
+	
+	int32 RemovedCount = 0;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() == KeepKey)
+			continue;
+		
+		const FImportCacheEntry& Entry = It.Value();
+		bool bConflicts = Entry.PartNo == NewEntry.PartNo;
+		for (int32 Index = 0; !bConflicts && Index < Entry.Meshes.Num(); ++Index)
+		{
+			bConflicts = NewMeshPaths.Contains(Entry.Meshes[Index].StaticMeshPath);
+		}
+		
+		if (bConflicts)
+		{
+			It.RemoveCurrent();
+			++RemovedCount;
+		}
+	}
+	return RemovedCount;
+}
+
+void FImportResultCache::Clear()
+{
+	Entries.Empty();
+	FileHashMemos.Empty();
+	SaveToDisk();
+}
+
+void FImportResultCache::LoadFromDisk()
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetCacheFilePath()))
+		return;
+	
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("임포트 캐시 파일을 읽을 수 없습니다: %s"), *GetCacheFilePath());
+		return;
+	}
+	
+	const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+	if (!RootObject->TryGetArrayField(TEXT("Entries"), EntryValues))
+		return;
+	
+	for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValues)
+	{
+		const TSharedPtr<FJsonObject> EntryObject = EntryValue->AsObject();
+		if (!EntryObject.IsValid())
+			continue;
+		
+		FImportCacheEntry Entry;
+		Entry.PartNo = EntryObject->GetStringField(TEXT("PartNo"));
+		Entry.SourceFilePath = EntryObject->GetStringField(TEXT("SourceFilePath"));
+		Entry.FileHash = EntryObject->GetStringField(TEXT("FileHash"));
+		Entry.SettingsHash = static_cast<uint32>(EntryObject->GetNumberField(TEXT("SettingsHash")));
+		if (!ImportResultCacheJson::TransformFromJson(EntryObject->GetArrayField(TEXT("RootTransform")), Entry.RootTransform))
+			continue;
+		
+		for (const TSharedPtr<FJsonValue>& MeshValue : EntryObject->GetArrayField(TEXT("Meshes")))
+		{
+			const TSharedPtr<FJsonObject> MeshObject = MeshValue->AsObject();
+			if (!MeshObject.IsValid())
+				continue;
+			
+			FImportCacheMeshEntry& MeshEntry = Entry.Meshes.AddDefaulted_GetRef();
+			MeshEntry.ActorLabel = MeshObject->GetStringField(TEXT("Label"));
+			MeshEntry.StaticMeshPath = MeshObject->GetStringField(TEXT("Mesh"));
+			MeshObject->TryGetStringArrayField(TEXT("Materials"), MeshEntry.MaterialPaths);
+			ImportResultCacheJson::TransformFromJson(MeshObject->GetArrayField(TEXT("Transform")), MeshEntry.RelativeTransform);
+		}
+		
+		Entries.Add(MakeCacheKeyFromEntry(Entry), MoveTemp(Entry));
+	}
+	
+	UE_LOG(LogTemp, Display, TEXT("임포트 캐시 로드: %d개 항목"), Entries.Num());
+}
+
+void FImportResultCache::SaveToDisk() const
+{
+	TArray<TSharedPtr<FJsonValue>> EntryValues;
+	EntryValues.Reserve(Entries.Num());
+	
+	for (const TPair<FString, FImportCacheEntry>& Pair : Entries)
+	{
+		const FImportCacheEntry& Entry = Pair.Value;
+		
+		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("PartNo"), Entry.PartNo);
+		EntryObject->SetStringField(TEXT("SourceFilePath"), Entry.SourceFilePath);
+		EntryObject->SetStringField(TEXT("FileHash"), Entry.FileHash);
+		EntryObject->SetNumberField(TEXT("SettingsHash"), Entry.SettingsHash);
+		EntryObject->SetArrayField(TEXT("RootTransform"), ImportResultCacheJson::TransformToJson(Entry.RootTransform));
+		
+		TArray<TSharedPtr<FJsonValue>> MeshValues;
+		MeshValues.Reserve(Entry.Meshes.Num());
+		for (const FImportCacheMeshEntry& MeshEntry : Entry.Meshes)
+		{
+			TSharedRef<FJsonObject> MeshObject = MakeShared<FJsonObject>();
+			MeshObject->SetStringField(TEXT("Label"), MeshEntry.ActorLabel);
+			MeshObject->SetStringField(TEXT("Mesh"), MeshEntry.StaticMeshPath);
+			
+			TArray<TSharedPtr<FJsonValue>> MaterialValues;
+			for (const FString& MaterialPath : MeshEntry.MaterialPaths)
+			{
+				MaterialValues.Add(MakeShared<FJsonValueString>(MaterialPath));
+			}
+			MeshObject->SetArrayField(TEXT("Materials"), MaterialValues);
+			MeshObject->SetArrayField(TEXT("Transform"), ImportResultCacheJson::TransformToJson(MeshEntry.RelativeTransform));
+			
+			MeshValues.Add(MakeShared<FJsonValueObject>(MeshObject));
+		}
+		EntryObject->SetArrayField(TEXT("Meshes"), MeshValues);
+		
+		EntryValues.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+	
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetArrayField(TEXT("Entries"), EntryValues);
+	
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(RootObject, Writer);
+	
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetCacheFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("임포트 캐시 파일을 저장할 수 없습니다: %s"), *GetCacheFilePath());
+	}
+}
@@ -0,0 +1,228 @@
+﻿// ImportTelemetry.cpp
+// 3DXML 임포트 계측 및 배치 보고서 구현
+
+#include "ImportTelemetry.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "StaticMeshResources.h"
+
+namespace ImportTelemetryReport
+{
+	/** CSV 필드 (쉼표/따옴표가 있으면 따옴표로 감쌈) */
+	FString EscapeCsv(const FString& Value)
+	{
+		if (!Value.Contains(TEXT(",")) && !Value.Contains(TEXT("\"")))
+		{
+			return Value;
+		}
+		return FString::Printf(TEXT("\"%s\""), *Value.Replace(TEXT("\""), TEXT("\"\"")));
+	}
+}
+
+const TCHAR* FImportTelemetry::GetStageName(EImportStage Stage)
+{
+	switch (Stage)
+	{
+	case EImportStage::Translate:    return TEXT("Translate");
+	case EImportStage::Spawn:        return TEXT("Spawn");
+	case EImportStage::Transparency: return TEXT("Transparency");
+	case EImportStage::Cleanup:      return TEXT("Cleanup");
+	case EImportStage::Pivot:        return TEXT("Pivot");
+	case EImportStage::CacheRecord:  return TEXT("CacheRecord");
+	case EImportStage::Consolidate:  return TEXT("Consolidate");
+	case EImportStage::Finalize:     return TEXT("Finalize");
+	case EImportStage::PreTranslate: return TEXT("PreTranslate");
+	default:                         return TEXT("Unknown");
+	}
+}
+
+int64 FImportTelemetry::CountTriangles(AActor* RootActor)
+{
+	if (!RootActor)
+		return 0;
+
+	TArray<AActor*> Actors;
+	RootActor->GetAttachedActors(Actors, true, true);
+	Actors.Add(RootActor);
+
+	int64 TriangleCount = 0;
+	TArray<UStaticMeshComponent*> MeshComponents;
+	for (AActor* Actor : Actors)
+	{
+		if (!Actor)
+			continue;
+
+		MeshComponents.Reset();
+		Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+		for (UStaticMeshComponent* MeshComp : MeshComponents)
+		{
+			UStaticMesh* StaticMesh = MeshComp->GetStaticMesh();
+			const FStaticMeshRenderData* RenderData = StaticMesh ? StaticMesh->GetRenderData() : nullptr;
+			if (!RenderData || RenderData->LODResources.Num() == 0)
+				continue;
+
+			const int64 MeshTriangles = RenderData->LODResources[0].GetNumTriangles();
+
+			// 인스턴스 컴포넌트는 인스턴스 수만큼
+			if (const UInstancedStaticMeshComponent* InstancedComp = Cast<UInstancedStaticMeshComponent>(MeshComp))
+			{
+				TriangleCount += MeshTriangles * InstancedComp->GetInstanceCount();
+			}
+			else
+			{
+				TriangleCount += MeshTriangles;
+			}
+		}
+	}
+
+	return TriangleCount;
+}
+
+int32 FImportTelemetry::CountActors(AActor* RootActor)
+{
+	if (!RootActor)
+		return 0;
+
+	TArray<AActor*> Actors;
+	RootActor->GetAttachedActors(Actors, true, true);
+	return Actors.Num() + 1;
+}
+
+int64 FImportTelemetry::GetContentFolderSize(const FString& ContentPath)
+{
+	FString FolderPath;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(ContentPath / TEXT(""), FolderPath))
+		return 0;
+
+	int64 TotalBytes = 0;
+	IFileManager::Get().IterateDirectoryStatRecursively(*FolderPath,
+		[&TotalBytes](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory && StatData.FileSize > 0)
+			{
+				TotalBytes += StatData.FileSize;
+			}
+			return true;
+		});
+
+	return TotalBytes;
+}
+
+bool FImportTelemetry::WriteBatchReport(const TArray<FPartImportRecord>& Records, FString& OutCsvPath, FString& OutJsonPath, double BatchSaveSeconds)
+{
+	const FString ReportDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ImportReports"));
+	const FString BaseName = FString::Printf(TEXT("ImportReport_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	OutCsvPath = FPaths::Combine(ReportDir, BaseName + TEXT(".csv"));
+	OutJsonPath = FPaths::Combine(ReportDir, BaseName + TEXT(".json"));
+
+	const int32 NumStages = static_cast<int32>(EImportStage::Count);
+
+	// CSV: 파트당 한 줄
+	FString Csv = TEXT("PartNo,FilePath,Succeeded,FromCache,TotalSeconds");
+	for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+	{
+		Csv += FString::Printf(TEXT(",%sSeconds"), GetStageName(static_cast<EImportStage>(StageIndex)));
+	}
+	Csv += TEXT(",Triangles,ActorsCreated,ActorsDestroyed,BytesWritten\n");
+
+	// JSON: 합계와 파트별 기록
+	TArray<TSharedPtr<FJsonValue>> PartValues;
+	double TotalSeconds = 0.0;
+	double TotalStageSeconds[static_cast<int32>(EImportStage::Count)] = {};
+	int64 TotalTriangles = 0;
+	int64 TotalBytes = 0;
+	int32 SucceededCount = 0;
+	const FPartImportRecord* SlowestRecord = nullptr;
+
+	for (const FPartImportRecord& Record : Records)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%d,%d,%.4f"),
+			*ImportTelemetryReport::EscapeCsv(Record.PartNo), *ImportTelemetryReport::EscapeCsv(Record.FilePath),
+			Record.bSucceeded ? 1 : 0, Record.bFromCache ? 1 : 0, Record.TotalSeconds);
+
+		TSharedPtr<FJsonObject> StagesObject = MakeShared<FJsonObject>();
+		for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+		{
+			Csv += FString::Printf(TEXT(",%.4f"), Record.StageSeconds[StageIndex]);
+			StagesObject->SetNumberField(GetStageName(static_cast<EImportStage>(StageIndex)), Record.StageSeconds[StageIndex]);
+			TotalStageSeconds[StageIndex] += Record.StageSeconds[StageIndex];
+		}
+
+		Csv += FString::Printf(TEXT(",%lld,%d,%d,%lld\n"),
+			Record.TriangleCount, Record.ActorsCreated, Record.ActorsDestroyed, Record.BytesWritten);
+
+		TSharedPtr<FJsonObject> PartObject = MakeShared<FJsonObject>();
+		PartObject->SetStringField(TEXT("PartNo"), Record.PartNo);
+		PartObject->SetStringField(TEXT("FilePath"), Record.FilePath);
+		PartObject->SetBoolField(TEXT("Succeeded"), Record.bSucceeded);
+		PartObject->SetBoolField(TEXT("FromCache"), Record.bFromCache);
+		PartObject->SetNumberField(TEXT("TotalSeconds"), Record.TotalSeconds);
+		PartObject->SetObjectField(TEXT("StageSeconds"), StagesObject);
+		PartObject->SetNumberField(TEXT("Triangles"), static_cast<double>(Record.TriangleCount));
+		PartObject->SetNumberField(TEXT("ActorsCreated"), Record.ActorsCreated);
+		PartObject->SetNumberField(TEXT("ActorsDestroyed"), Record.ActorsDestroyed);
+		PartObject->SetNumberField(TEXT("BytesWritten"), static_cast<double>(Record.BytesWritten));
+		PartValues.Add(MakeShared<FJsonValueObject>(PartObject));
+
+		TotalSeconds += Record.TotalSeconds;
+		TotalTriangles += Record.TriangleCount;
+		TotalBytes += Record.BytesWritten;
+		SucceededCount += Record.bSucceeded ? 1 : 0;
+		if (!SlowestRecord || Record.TotalSeconds > SlowestRecord->TotalSeconds)
+		{
+			SlowestRecord = &Record;
+		}
+	}
+
+	TSharedPtr<FJsonObject> TotalStagesObject = MakeShared<FJsonObject>();
+	for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+	{
+		TotalStagesObject->SetNumberField(GetStageName(static_cast<EImportStage>(StageIndex)), TotalStageSeconds[StageIndex]);
+	}
+
+	TSharedPtr<FJsonObject> SummaryObject = MakeShared<FJsonObject>();
+	SummaryObject->SetNumberField(TEXT("Parts"), Records.Num());
+	SummaryObject->SetNumberField(TEXT("Succeeded"), SucceededCount);
+	SummaryObject->SetNumberField(TEXT("TotalSeconds"), TotalSeconds);
+	SummaryObject->SetObjectField(TEXT("StageSeconds"), TotalStagesObject);
+	SummaryObject->SetNumberField(TEXT("BatchSaveSeconds"), BatchSaveSeconds);
+	SummaryObject->SetNumberField(TEXT("Triangles"), static_cast<double>(TotalTriangles));
+	SummaryObject->SetNumberField(TEXT("BytesWritten"), static_cast<double>(TotalBytes));
+	if (SlowestRecord)
+	{
+		SummaryObject->SetStringField(TEXT("SlowestPartNo"), SlowestRecord->PartNo);
+		SummaryObject->SetNumberField(TEXT("SlowestPartSeconds"), SlowestRecord->TotalSeconds);
+	}
+
+	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetStringField(TEXT("CreatedAt"), FDateTime::Now().ToIso8601());
+	RootObject->SetObjectField(TEXT("Summary"), SummaryObject);
+	RootObject->SetArrayField(TEXT("Parts"), PartValues);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+
+	const bool bCsvSaved = FFileHelper::SaveStringToFile(Csv, *OutCsvPath, FFileHelper::EEncodingOptions::ForceUTF8);
+	const bool bJsonSaved = FFileHelper::SaveStringToFile(JsonString, *OutJsonPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+	if (!bCsvSaved || !bJsonSaved)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("임포트 보고서 저장 실패: %s"), *ReportDir);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("임포트 보고서 저장: %s (파트 %d개, 총 %.2f초)"), *OutCsvPath, Records.Num(), TotalSeconds);
+	return true;
+}
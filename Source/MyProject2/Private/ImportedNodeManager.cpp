@@ -1,11 +1,26 @@
 ﻿// ImportedNodeManager.cpp
 #include "ImportedNodeManager.h"
-#include "EngineUtils.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
+#include "PartInstancedMeshComponent.h"
+#include "UObject/UObjectGlobals.h"
 
 // 정적 멤버 초기화
 FImportedNodeManager* FImportedNodeManager::Instance = nullptr;
 const FName FImportedNodeManager::ImportedTag = FName("Imported3DXML");
 
+namespace ImportedNodeManager
+{
+    /** 파트 번호 태그 접두사 */
+    static const TCHAR* PartTagPrefix = TEXT("ImportedPart_");
+    
+    /** 접두사 길이 ("ImportedPart_") */
+    static const int32 PartTagPrefixLen = 13;
+}
+
 FImportedNodeManager& FImportedNodeManager::Get()
 {
     if (!Instance)
@@ -15,25 +30,73 @@ FImportedNodeManager& FImportedNodeManager::Get()
     return *Instance;
 }
 
+void FImportedNodeManager::Shutdown()
+{
+    delete Instance;
+    Instance = nullptr;
+}
+
 FImportedNodeManager::FImportedNodeManager()
 {
     // 에디터 모드에서 시작 시 초기화
 #if WITH_EDITOR
+    RegisterEditorHooks();
     InitializeFromLevelActors();
 #endif
 }
 
+FImportedNodeManager::~FImportedNodeManager()
+{
+    UnregisterEditorHooks();
+}
+
+void FImportedNodeManager::RegisterEditorHooks()
+{
+#if WITH_EDITOR
+    if (GEngine)
+    {
+        LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FImportedNodeManager::OnLevelActorAdded);
+        LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FImportedNodeManager::OnLevelActorDeleted);
+    }
+    
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FImportedNodeManager::OnActorLabelChanged);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FImportedNodeManager::OnObjectPropertyChanged);
+    MapOpenedHandle = FEditorDelegates::OnMapOpened.AddRaw(this, &FImportedNodeManager::OnMapOpened);
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FImportedNodeManager::OnLevelAddedToWorld);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FImportedNodeManager::OnLevelRemovedFromWorld);
+#endif
+}
+
+void FImportedNodeManager::UnregisterEditorHooks()
+{
+#if WITH_EDITOR
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+    }
+    
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::OnMapOpened.Remove(MapOpenedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+#endif
+}
+
 void FImportedNodeManager::RegisterImportedNode(const FString& PartNo, AActor* Actor)
 {
     if (!Actor || PartNo.IsEmpty())
         return;
         
     // 매니저에 등록
-    ImportedNodes.Add(PartNo, Actor);
+    AddImportedNodeEntry(PartNo, Actor);
     
     // 태그 추가
     Actor->Tags.AddUnique(ImportedTag);
-    Actor->Tags.AddUnique(FName(*FString::Printf(TEXT("ImportedPart_%s"), *PartNo)));
+    Actor->Tags.AddUnique(FName(*FString::Printf(TEXT("%s%s"), ImportedNodeManager::PartTagPrefix, *PartNo)));
+    
+    ImportedNodeChangedEvent.Broadcast(PartNo);
     
     UE_LOG(LogTemp, Display, TEXT("노드 임포트 등록: %s"), *PartNo);
 }
@@ -82,47 +145,409 @@ void FImportedNodeManager::RemoveImportedNode(const FString& PartNo)
     if (Actor)
     {
         Actor->Tags.Remove(ImportedTag);
-        Actor->Tags.Remove(FName(*FString::Printf(TEXT("ImportedPart_%s"), *PartNo)));
+        Actor->Tags.Remove(FName(*FString::Printf(TEXT("%s%s"), ImportedNodeManager::PartTagPrefix, *PartNo)));
+        ActorToPartNo.Remove(Actor);
     }
     
     // 매니저에서 제거
     ImportedNodes.Remove(PartNo);
+    ImportedNodeChangedEvent.Broadcast(PartNo);
+}
+
+void FImportedNodeManager::AddImportedNodeEntry(const FString& PartNo, AActor* Actor)
+{
+    // 같은 파트 번호를 다른 액터로 다시 등록하면 이전 액터의 역방향 항목 제거
+    if (const TWeakObjectPtr<AActor>* PreviousActor = ImportedNodes.Find(PartNo))
+    {
+        if (AActor* PreviousLiveActor = PreviousActor->Get())
+        {
+            if (PreviousLiveActor != Actor)
+            {
+                ActorToPartNo.Remove(PreviousLiveActor);
+            }
+        }
+        else if (PreviousActor->IsStale())
+        {
+            // 이전 액터가 이미 삭제되었으면 키를 만들 수 없으므로 이 파트 번호의 죽은 항목만 정리
+            for (auto It = ActorToPartNo.CreateIterator(); It; ++It)
+            {
+                if (It.Value() == PartNo && It.Key().ResolveObjectPtr() == nullptr)
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+    }
+    
+    // 같은 액터를 다른 파트 번호로 다시 등록하면 이전 파트 번호 항목 제거
+    if (const FString* PreviousPartNo = ActorToPartNo.Find(Actor))
+    {
+        if (*PreviousPartNo != PartNo)
+        {
+            const TWeakObjectPtr<AActor>* ImportedActor = ImportedNodes.Find(*PreviousPartNo);
+            if (ImportedActor && ImportedActor->Get() == Actor)
+            {
+                ImportedNodes.Remove(*PreviousPartNo);
+            }
+        }
+    }
+    
+    ImportedNodes.Add(PartNo, Actor);
+    ActorToPartNo.Add(Actor, PartNo);
+}
+
+FString FImportedNodeManager::GetPartNoForActor(const AActor* Actor) const
+{
+    // 부착 부모를 따라 올라가며 임포트된 루트 액터 조회 (깊이만큼만 조회)
+    for (const AActor* Current = Actor; Current; Current = Current->GetAttachParentActor())
+    {
+        if (const FString* PartNo = ActorToPartNo.Find(Current))
+        {
+            return *PartNo;
+        }
+    }
+    
+    return FString();
+}
+
+AActor* FImportedNodeManager::FindActorByLabel(const FString& Label) const
+{
+    if (Label.IsEmpty())
+        return nullptr;
+    
+    for (auto It = ActorsByLabel.CreateConstKeyIterator(Label.ToLower()); It; ++It)
+    {
+        if (AActor* Actor = It.Value().Get())
+        {
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+AActor* FImportedNodeManager::FindDatasmithSceneActor(const FString& NameHint) const
+{
+    // 가장 최근에 추가된 액터부터 확인
+    for (int32 Index = DatasmithSceneActors.Num() - 1; Index >= 0; --Index)
+    {
+        AActor* Actor = DatasmithSceneActors[Index].Get();
+        if (Actor && (NameHint.IsEmpty() || Actor->GetName().Contains(NameHint)))
+        {
+            return Actor;
+        }
+    }
+    
+    return nullptr;
+}
+
+void FImportedNodeManager::GetLabelSegmentKeys(const FString& LowerLabel, TArray<FString>& OutKeys)
+{
+    // 구간 시작 위치 (문자열 시작, 구분자 다음)와 끝 위치 (구분자, 문자열 끝)
+    TArray<int32, TInlineAllocator<8>> Starts;
+    TArray<int32, TInlineAllocator<8>> Ends;
+    const int32 Len = LowerLabel.Len();
+    for (int32 Index = 0; Index <= Len; ++Index)
+    {
+        const bool bSeparator = Index == Len || !FChar::IsAlnum(LowerLabel[Index]);
+        if (bSeparator)
+        {
+            Ends.Add(Index);
+            if (Index < Len)
+            {
+                Starts.Add(Index + 1);
+            }
+        }
+    }
+    Starts.Insert(0, 0);
+    
+    for (const int32 Start : Starts)
+    {
+        for (const int32 End : Ends)
+        {
+            // 라벨 전체는 정확히 일치 맵에서 조회
+            if (End > Start && !(Start == 0 && End == Len))
+            {
+                OutKeys.AddUnique(LowerLabel.Mid(Start, End - Start));
+            }
+        }
+    }
+}
+
+void FImportedNodeManager::RegisterInstancedParts(UPartInstancedMeshComponent* Component)
+{
+    if (!Component)
+        return;
+    
+    // 재등록이면 이전 항목 제거 후 다시 추가
+    UnregisterInstancedParts(Component);
+    
+    TPair<TArray<FString>, TArray<FString>>& Keys = InstancedPartKeys.Add(Component);
+    
+    const int32 NumInstances = FMath::Min(Component->InstancePartLabels.Num(), Component->GetInstanceCount());
+    for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+    {
+        const FString LowerLabel = Component->InstancePartLabels[InstanceIndex].ToLower();
+        if (LowerLabel.IsEmpty())
+            continue;
+        
+        const FInstancedPartRef PartRef{ Component, InstanceIndex };
+        InstancedPartsByLabel.Add(LowerLabel, PartRef);
+        Keys.Key.Add(LowerLabel);
+        
+        TArray<FString> SegmentKeys;
+        GetLabelSegmentKeys(LowerLabel, SegmentKeys);
+        for (FString& SegmentKey : SegmentKeys)
+        {
+            InstancedPartsBySegment.Add(SegmentKey, PartRef);
+            Keys.Value.Add(MoveTemp(SegmentKey));
+        }
+    }
+    
+    // 인스턴스를 소유한 임포트 파트의 형상이 바뀌었음을 알림
+    const FString OwnerPartNo = GetPartNoForActor(Component->GetOwner());
+    if (!OwnerPartNo.IsEmpty())
+    {
+        ImportedNodeChangedEvent.Broadcast(OwnerPartNo);
+    }
+    
+    UE_LOG(LogTemp, Verbose, TEXT("인스턴스 파트 등록: %s (인스턴스 %d개, 부분 일치 키 %d개)"), 
+           *Component->GetName(), NumInstances, Keys.Value.Num());
+}
+
+void FImportedNodeManager::UnregisterInstancedParts(UPartInstancedMeshComponent* Component)
+{
+    TPair<TArray<FString>, TArray<FString>> Keys;
+    if (!InstancedPartKeys.RemoveAndCopyValue(Component, Keys))
+        return;
+    
+    // 이 컴포넌트의 인스턴스만 제거 (같은 키의 다른 컴포넌트는 유지)
+    const TWeakObjectPtr<UPartInstancedMeshComponent> WeakComponent(Component);
+    auto RemoveComponentRefs = [&WeakComponent](TMultiMap<FString, FInstancedPartRef>& Map, const TArray<FString>& InKeys)
+    {
+        for (const FString& Key : InKeys)
+        {
+            for (auto It = Map.CreateKeyIterator(Key); It; ++It)
+            {
+                if (It.Value().Component == WeakComponent)
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+    };
+    RemoveComponentRefs(InstancedPartsByLabel, Keys.Key);
+    RemoveComponentRefs(InstancedPartsBySegment, Keys.Value);
+}
+
+bool FImportedNodeManager::FindImportedInstance(const FString& PartNo, UPartInstancedMeshComponent*& OutComponent, int32& OutInstanceIndex) const
+{
+    OutComponent = nullptr;
+    OutInstanceIndex = INDEX_NONE;
+    
+    if (PartNo.IsEmpty())
+        return false;
+    
+    const FString LowerPartNo = PartNo.ToLower();
+    auto FindValid = [&](const TMultiMap<FString, FInstancedPartRef>& Map)
+    {
+        for (auto It = Map.CreateConstKeyIterator(LowerPartNo); It; ++It)
+        {
+            UPartInstancedMeshComponent* Component = It.Value().Component.Get();
+            if (Component && It.Value().InstanceIndex < Component->GetInstanceCount())
+            {
+                OutComponent = Component;
+                OutInstanceIndex = It.Value().InstanceIndex;
+                return true;
+            }
+        }
+        return false;
+    };
+    
+    // 1. 라벨이 정확히 일치하는 인스턴스, 2. 라벨 구간이 파트 번호와 일치하는 인스턴스
+    return FindValid(InstancedPartsByLabel) || FindValid(InstancedPartsBySegment);
 }
 
 void FImportedNodeManager::InitializeFromLevelActors()
 {
     // 기존 맵 초기화
     ImportedNodes.Empty();
+    ActorToPartNo.Empty();
+    ActorsByLabel.Empty();
+    IndexedLabels.Empty();
+    DatasmithSceneActors.Empty();
+    InstancedPartsByLabel.Empty();
+    InstancedPartsBySegment.Empty();
+    InstancedPartKeys.Empty();
     
     // 에디터 월드 가져오기
     UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
     if (!EditorWorld)
         return;
+    
+    // 로드된 레벨의 액터를 한 번만 인덱싱 (이후에는 이벤트로 갱신)
+    for (ULevel* Level : EditorWorld->GetLevels())
+    {
+        IndexLevel(Level);
+    }
+    
+    // 전체 재구성 알림
+    ImportedNodeChangedEvent.Broadcast(FString());
+    
+    UE_LOG(LogTemp, Display, TEXT("레벨에서 임포트된 노드 %d개 초기화 완료 (인덱싱된 액터 %d개)"), 
+           ImportedNodes.Num(), IndexedLabels.Num());
+}
+
+void FImportedNodeManager::IndexLevel(ULevel* Level)
+{
+    if (!Level)
+        return;
+    
+    for (AActor* Actor : Level->Actors)
+    {
+        IndexActor(Actor);
+    }
+}
+
+FString FImportedNodeManager::GetPartNoFromTags(const AActor* Actor)
+{
+    if (!Actor || !Actor->ActorHasTag(ImportedTag))
+        return FString();
+    
+    for (const FName& Tag : Actor->Tags)
+    {
+        FString TagStr = Tag.ToString();
+        if (TagStr.StartsWith(ImportedNodeManager::PartTagPrefix))
+        {
+            // 태그에서 파트 번호 추출
+            return TagStr.RightChop(ImportedNodeManager::PartTagPrefixLen);
+        }
+    }
+    
+    return FString();
+}
+
+void FImportedNodeManager::IndexActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+        return;
+    
+#if WITH_EDITOR
+    // 라벨 인덱스
+    const FString LabelKey = Actor->GetActorLabel().ToLower();
+    if (!LabelKey.IsEmpty())
+    {
+        ActorsByLabel.AddUnique(LabelKey, Actor);
+        IndexedLabels.Add(Actor, LabelKey);
+    }
+#endif
+    
+    // DatasmithSceneActor 추적
+    if (Actor->GetClass()->GetName().Contains(TEXT("DatasmithSceneActor")))
+    {
+        DatasmithSceneActors.AddUnique(Actor);
+    }
+    
+    // 임포트 태그가 있는 액터 등록
+    const FString PartNo = GetPartNoFromTags(Actor);
+    if (!PartNo.IsEmpty())
+    {
+        AddImportedNodeEntry(PartNo, Actor);
+        ImportedNodeChangedEvent.Broadcast(PartNo);
         
-    // 모든 액터 탐색
-    int32 ImportedCount = 0;
-    for (TActorIterator<AActor> It(EditorWorld); It; ++It)
+        // 인스턴스로 통합된 파트 등록
+        TArray<UPartInstancedMeshComponent*> InstancedMeshComponents;
+        Actor->GetComponents(InstancedMeshComponents);
+        for (UPartInstancedMeshComponent* Component : InstancedMeshComponents)
+        {
+            RegisterInstancedParts(Component);
+        }
+    }
+}
+
+void FImportedNodeManager::UnindexActor(AActor* Actor)
+{
+    if (!Actor)
+        return;
+    
+    // 라벨 인덱스에서 이 액터만 제거 (같은 라벨의 다른 액터는 계속 조회 가능)
+    FString LabelKey;
+    if (IndexedLabels.RemoveAndCopyValue(Actor, LabelKey))
     {
-        AActor* Actor = *It;
-        if (Actor && Actor->ActorHasTag(ImportedTag))
+        ActorsByLabel.Remove(LabelKey, Actor);
+    }
+    
+    // 인스턴스 파트 인덱스에서 이 액터의 컴포넌트 제거
+    TArray<UPartInstancedMeshComponent*> InstancedMeshComponents;
+    Actor->GetComponents(InstancedMeshComponents);
+    for (UPartInstancedMeshComponent* Component : InstancedMeshComponents)
+    {
+        UnregisterInstancedParts(Component);
+    }
+    
+    DatasmithSceneActors.Remove(Actor);
+    
+    // 임포트 노드에서 제거 (태그는 유지)
+    FString PartNo;
+    if (ActorToPartNo.RemoveAndCopyValue(Actor, PartNo))
+    {
+        const TWeakObjectPtr<AActor>* ImportedActor = ImportedNodes.Find(PartNo);
+        if (ImportedActor && ImportedActor->Get() == Actor)
         {
-            // ImportedPart_ 태그 찾기
-            for (const FName& Tag : Actor->Tags)
-            {
-                FString TagStr = Tag.ToString();
-                if (TagStr.StartsWith(TEXT("ImportedPart_")))
-                {
-                    // 태그에서 파트 번호 추출
-                    FString PartNo = TagStr.RightChop(13); // "ImportedPart_" 부분 제거
-                    
-                    // 맵에 추가
-                    ImportedNodes.Add(PartNo, Actor);
-                    ImportedCount++;
-                    break;
-                }
-            }
+            ImportedNodes.Remove(PartNo);
+            ImportedNodeChangedEvent.Broadcast(PartNo);
         }
     }
+}
+
+void FImportedNodeManager::OnLevelActorAdded(AActor* Actor)
+{
+    IndexActor(Actor);
+}
+
+void FImportedNodeManager::OnLevelActorDeleted(AActor* Actor)
+{
+    UnindexActor(Actor);
+}
+
+void FImportedNodeManager::OnActorLabelChanged(AActor* Actor)
+{
+    // 라벨 변경 시 재인덱싱
+    UnindexActor(Actor);
+    IndexActor(Actor);
+}
+
+void FImportedNodeManager::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // 디테일 패널 등에서 태그가 변경된 경우 재인덱싱
+    AActor* Actor = Cast<AActor>(Object);
+    if (Actor && PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags))
+    {
+        UnindexActor(Actor);
+        IndexActor(Actor);
+    }
+}
+
+void FImportedNodeManager::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+    // 새 맵이 열리면 인덱스 재구성
+    InitializeFromLevelActors();
+}
+
+void FImportedNodeManager::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    if (GEditor && World == GEditor->GetEditorWorldContext().World())
+    {
+        IndexLevel(Level);
+    }
+}
+
+void FImportedNodeManager::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+    if (!Level || !GEditor || World != GEditor->GetEditorWorldContext().World())
+        return;
     
-    UE_LOG(LogTemp, Display, TEXT("레벨에서 임포트된 노드 %d개 초기화 완료"), ImportedCount);
-}
\ No newline at end of file
+    for (AActor* Actor : Level->Actors)
+    {
+        UnindexActor(Actor);
+    }
+}
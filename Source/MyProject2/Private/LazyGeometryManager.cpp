@@ -0,0 +1,792 @@
+﻿// LazyGeometryManager.cpp
+// 지연 형상 관리 구현
+
+#include "LazyGeometryManager.h"
+
+#include "Async/Async.h"
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "DatasmithSceneFactory.h"
+#include "DatasmithSceneManager.h"
+#include "DatasmithTranslatableSource.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "ImportSettings.h"
+#include "ImportedNodeManager.h"
+#include "MeshBoundsEngine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PartFileIndex.h"
+#include "SceneManagement.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "ServiceLocator.h"
+#include "UI/PartTreeItem.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "LevelEditorViewport.h"
+#endif
+
+FLazyGeometryManager* FLazyGeometryManager::Instance = nullptr;
+const FName FLazyGeometryManager::PlaceholderTag(TEXT("LazyGeometryPlaceholder"));
+
+namespace LazyGeometry
+{
+	/** 절두체 검사 간격 (초) */
+	static constexpr double VisibilityCheckInterval = 0.5;
+
+	/** 절두체 안에서 임포트할 최소 화면 크기 (반지름 / 거리) */
+	static constexpr double MinScreenSize = 0.02;
+
+	/** 방금 보거나 요청한 노드는 정리 대상에서 제외하는 시간 (초) */
+	static constexpr double EvictionGraceSeconds = 2.0;
+
+	/** 워커 스레드에서 동시에 변환할 최대 노드 수 */
+	static constexpr int32 MaxConcurrentTranslations = 2;
+
+	/** 소비한 대기열 앞부분을 압축하는 최소 항목 수 */
+	static constexpr int32 LoadQueueCompactThreshold = 256;
+
+	/** 박스를 JSON 배열로 저장 (Min 3 + Max 3) */
+	TArray<TSharedPtr<FJsonValue>> BoxToJson(const FBox& Box)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (const FVector& Corner : { Box.Min, Box.Max })
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Corner.X));
+			Values.Add(MakeShared<FJsonValueNumber>(Corner.Y));
+			Values.Add(MakeShared<FJsonValueNumber>(Corner.Z));
+		}
+		return Values;
+	}
+
+	/** JSON 배열에서 박스 복원 */
+	bool BoxFromJson(const TArray<TSharedPtr<FJsonValue>>& Values, FBox& OutBox)
+	{
+		if (Values.Num() != 6)
+			return false;
+
+		OutBox = FBox(
+			FVector(Values[0]->AsNumber(), Values[1]->AsNumber(), Values[2]->AsNumber()),
+			FVector(Values[3]->AsNumber(), Values[4]->AsNumber(), Values[5]->AsNumber()));
+		return OutBox.IsValid != 0;
+	}
+
+#if WITH_EDITOR
+	/** 현재 레벨 편집 원근 뷰포트의 절두체와 시점 위치 */
+	bool GetActiveViewFrustum(FConvexVolume& OutFrustum, FVector& OutViewLocation)
+	{
+		FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
+		if (!Client || !Client->IsPerspective() || !Client->Viewport)
+			return false;
+
+		const FIntPoint ViewportSize = Client->Viewport->GetSizeXY();
+		if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+			return false;
+
+		OutViewLocation = Client->GetViewLocation();
+
+		// 언리얼 좌표계(X 전방, Z 위) -> 뷰 좌표계(Z 전방, Y 위)
+		const FMatrix ViewRotationMatrix = FInverseRotationMatrix(Client->GetViewRotation()) * FMatrix(
+			FPlane(0, 0, 1, 0),
+			FPlane(1, 0, 0, 0),
+			FPlane(0, 1, 0, 0),
+			FPlane(0, 0, 0, 1));
+		const FMatrix ViewMatrix = FTranslationMatrix(-OutViewLocation) * ViewRotationMatrix;
+		const float HalfFOV = FMath::DegreesToRadians(Client->ViewFOV) * 0.5f;
+		const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(HalfFOV, ViewportSize.X, ViewportSize.Y, GNearClippingPlane);
+
+		GetViewFrustumBounds(OutFrustum, ViewMatrix * ProjectionMatrix, false);
+		return true;
+	}
+#endif
+}
+
+FLazyGeometryManager& FLazyGeometryManager::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FLazyGeometryManager();
+	}
+	return *Instance;
+}
+
+void FLazyGeometryManager::Shutdown()
+{
+	delete Instance;
+	Instance = nullptr;
+}
+
+FLazyGeometryManager::FLazyGeometryManager()
+	: SceneManager(MakeUnique<FDatasmithSceneManager>())
+{
+	// 지연 임포트는 사용자가 요청하지 않은 백그라운드 작업이므로 모달 진행 대화상자를 띄우지 않음
+	SceneManager->SetShowProgressDialog(false);
+
+	LoadRecordedBounds();
+
+	ImportedNodeChangedHandle = FImportedNodeManager::Get().OnImportedNodeChanged().AddRaw(
+		this, &FLazyGeometryManager::OnImportedNodeChanged);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FLazyGeometryManager::Tick));
+}
+
+FLazyGeometryManager::~FLazyGeometryManager()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FImportedNodeManager::Get().OnImportedNodeChanged().Remove(ImportedNodeChangedHandle);
+
+	WaitForPendingTranslations();
+
+	if (bRecordedBoundsDirty)
+	{
+		SaveRecordedBounds();
+	}
+}
+
+int32 FLazyGeometryManager::RegisterSubtree(const TSharedPtr<FPartTreeItem>& RootItem)
+{
+	FPartFileIndex* FileIndex = FServiceLocator::GetCADFileIndex();
+	if (!RootItem.IsValid() || !FileIndex)
+		return 0;
+
+	const FImportedNodeManager& NodeManager = FImportedNodeManager::Get();
+	int32 RegisteredCount = 0;
+	int32 PlaceholderCount = 0;
+
+	TArray<FPartTreeItem*> Stack;
+	Stack.Add(RootItem.Get());
+	while (Stack.Num() > 0)
+	{
+		FPartTreeItem* Item = Stack.Pop(EAllowShrinking::No);
+		for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+		{
+			if (Child.IsValid())
+			{
+				Stack.Add(Child.Get());
+			}
+		}
+
+		// 이미 등록되었거나 임포트된 노드, 파일이 없는 노드는 제외
+		const FString* FilePath = FileIndex->FindFile(Item->PartNo);
+		if (!FilePath || Parts.Contains(Item->PartNo) || NodeManager.IsNodeImported(Item->PartNo))
+			continue;
+
+		FLazyPart& Part = Parts.Add(Item->PartNo);
+		Part.FilePath = *FilePath;
+		Part.Bounds = FindRecordedBounds(Item->PartNo, *FilePath);
+		if (Part.Bounds.IsValid)
+		{
+			Part.Placeholder = SpawnPlaceholder(Item->PartNo, Part.Bounds);
+			PlaceholderCount += Part.Placeholder.IsValid() ? 1 : 0;
+		}
+		RegisteredCount++;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("지연 형상 등록: %s 하위 %d개 노드 (플레이스홀더 %d개, 바운딩 박스 기록 없음 %d개)"),
+		*RootItem->PartNo, RegisteredCount, PlaceholderCount, RegisteredCount - PlaceholderCount);
+
+	return RegisteredCount;
+}
+
+void FLazyGeometryManager::UnregisterAll()
+{
+	for (TPair<FString, FLazyPart>& Pair : Parts)
+	{
+		if (AActor* Placeholder = Pair.Value.Placeholder.Get())
+		{
+			Placeholder->Destroy();
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("지연 형상 등록 해제: %d개 노드"), Parts.Num());
+	Parts.Empty();
+	LoadQueue.Empty();
+	LoadQueueHead = 0;
+}
+
+ELazyGeometryState FLazyGeometryManager::GetState(const FString& PartNo) const
+{
+	const FLazyPart* Part = Parts.Find(PartNo);
+	return Part ? Part->State : ELazyGeometryState::Loaded;
+}
+
+void FLazyGeometryManager::RequestLoad(const FString& PartNo)
+{
+	FLazyPart* Part = Parts.Find(PartNo);
+	if (!Part)
+		return;
+
+	Part->LastViewedTime = FPlatformTime::Seconds();
+
+	if (Part->State == ELazyGeometryState::Placeholder)
+	{
+		// 명시적 요청은 이전 실패와 관계없이 다시 시도
+		Part->bLoadFailed = false;
+		Part->State = ELazyGeometryState::Queued;
+		EnqueueLoad(PartNo);
+	}
+}
+
+void FLazyGeometryManager::RequestLoadExpanded(const TSharedPtr<FPartTreeItem>& Item)
+{
+	if (!Item.IsValid())
+		return;
+
+	RequestLoad(Item->PartNo);
+	for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+	{
+		if (Child.IsValid())
+		{
+			RequestLoad(Child->PartNo);
+		}
+	}
+}
+
+void FLazyGeometryManager::SetMemoryBudgetMB(int32 InBudgetMB)
+{
+	MemoryBudgetMB = FMath::Max(InBudgetMB, 64);
+	EnforceMemoryBudget();
+}
+
+int64 FLazyGeometryManager::GetLoadedMemoryBytes() const
+{
+	int64 TotalBytes = 0;
+	for (const TPair<FString, FLazyPart>& Pair : Parts)
+	{
+		if (Pair.Value.State == ELazyGeometryState::Loaded)
+		{
+			TotalBytes += Pair.Value.MemoryBytes;
+		}
+	}
+	return TotalBytes;
+}
+
+bool FLazyGeometryManager::Tick(float DeltaTime)
+{
+	if (Parts.Num() > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - LastVisibilityCheckTime >= LazyGeometry::VisibilityCheckInterval)
+		{
+			LastVisibilityCheckTime = Now;
+			UpdateViewportVisibility();
+		}
+
+	}
+
+	// 등록 해제 후에도 변환 중인 작업을 정리하고 번역기 콘솔 변수를 복원해야 함
+	if (Parts.Num() > 0 || PendingTranslations.Num() > 0 || bTranslatorConfigured)
+	{
+		ProcessNextLoad();
+	}
+
+	if (bRecordedBoundsDirty && GetNumQueuedLoads() == 0 && PendingTranslations.Num() == 0)
+	{
+		SaveRecordedBounds();
+	}
+
+	return true;
+}
+
+void FLazyGeometryManager::ProcessNextLoad()
+{
+#if WITH_EDITOR
+	// 틱마다 변환이 끝난 파트 하나만 게임 스레드에서 임포트하여 에디터 응답성 유지
+	for (int32 Index = 0; Index < PendingTranslations.Num(); ++Index)
+	{
+		if (!PendingTranslations[Index].Result.IsReady())
+			continue;
+
+		const FString PartNo = PendingTranslations[Index].PartNo;
+		const bool bTranslated = PendingTranslations[Index].Result.Get();
+		PendingTranslations.RemoveAt(Index, 1, EAllowShrinking::No);
+
+		if (bTranslated)
+		{
+			FinishLoad(PartNo);
+		}
+		else if (FLazyPart* Part = Parts.Find(PartNo))
+		{
+			// 게임 스레드에서 다시 변환하면 에디터가 멈추므로 실패로 두고 명시적 요청 때 다시 시도
+			UE_LOG(LogTemp, Warning, TEXT("지연 형상 변환 실패: %s"), *PartNo);
+			if (Part->State == ELazyGeometryState::Queued)
+			{
+				Part->State = ELazyGeometryState::Placeholder;
+				Part->bLoadFailed = true;
+			}
+		}
+		return;
+	}
+
+	// 남은 자리만큼 대기열의 다음 노드를 워커 스레드에서 변환 시작
+	FString PartNo;
+	while (PendingTranslations.Num() < LazyGeometry::MaxConcurrentTranslations && DequeueLoad(PartNo))
+	{
+		FLazyPart* Part = Parts.Find(PartNo);
+		if (!Part || Part->State != ELazyGeometryState::Queued)
+			continue;
+
+		if (!bTranslatorConfigured)
+		{
+			bCanPreTranslate = FDatasmithSceneManager::ConfigureCADPreTranslation(LazyGeometry::MaxConcurrentTranslations, SavedConsoleVariables);
+			bTranslatorConfigured = true;
+		}
+
+		// 사전 변환 소스의 테셀레이션 품질이 임포트 설정을 따르도록 먼저 적용
+		SceneManager->SetImportSettings(UImportSettingsManager::Get()->GetSettings());
+
+		// 직접 임포트된 노드, 임포트 캐시가 있는 노드는 변환이 필요 없음
+		TSharedPtr<FDatasmithTranslatableSceneSource> Source;
+		if (bCanPreTranslate
+			&& !FImportedNodeManager::Get().GetImportedActor(PartNo)
+			&& !SceneManager->HasImportCacheEntry(Part->FilePath))
+		{
+			Source = SceneManager->CreatePreTranslationSource(Part->FilePath);
+		}
+
+		if (!Source.IsValid())
+		{
+			FinishLoad(PartNo);
+			return;
+		}
+
+		FPendingTranslation& Pending = PendingTranslations.AddDefaulted_GetRef();
+		Pending.PartNo = PartNo;
+		Pending.Result = Async(EAsyncExecution::ThreadPool, [Source, PartNo]()
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FLazyGeometryManager::PreTranslate);
+
+			// 번역 결과 씬은 버리고 CAD 캐시에 남은 변환 결과만 게임 스레드 임포트에서 사용
+			TSharedRef<IDatasmithScene> Scene = FDatasmithSceneFactory::CreateScene(*PartNo);
+			return Source->Translate(Scene);
+		});
+	}
+
+	// 대기 중이거나 변환 중인 노드가 없으면 번역기 콘솔 변수 복원
+	if (bTranslatorConfigured && PendingTranslations.Num() == 0 && GetNumQueuedLoads() == 0)
+	{
+		FDatasmithSceneManager::RestoreConsoleVariables(SavedConsoleVariables);
+		bTranslatorConfigured = false;
+	}
+#endif
+}
+
+void FLazyGeometryManager::FinishLoad(const FString& PartNo)
+{
+#if WITH_EDITOR
+	// 변환 중 등록 해제되었거나 직접 임포트로 처리된 노드는 건너뜀
+	FLazyPart* Part = Parts.Find(PartNo);
+	if (!Part || Part->State != ELazyGeometryState::Queued)
+		return;
+
+	// 직접 임포트된 노드는 플레이스홀더만 정리
+	AActor* ImportedActor = FImportedNodeManager::Get().GetImportedActor(PartNo);
+	if (!ImportedActor)
+	{
+		SceneManager->SetImportSettings(UImportSettingsManager::Get()->GetSettings());
+
+		bLoadingPart = true;
+		ImportedActor = SceneManager->ImportAndProcessDatasmith(Part->FilePath, PartNo);
+		bLoadingPart = false;
+
+		// 저장을 미루는 설정이면 파트 단위로 바로 저장 (배치 끝이 없음)
+		SceneManager->SavePendingPackages();
+
+		// 임포트 중 다른 호출로 맵이 바뀌었을 수 있으므로 다시 조회
+		Part = Parts.Find(PartNo);
+		if (!Part)
+			return;
+	}
+
+	if (!ImportedActor)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("지연 형상 임포트 실패: %s"), *PartNo);
+		Part->State = ELazyGeometryState::Placeholder;
+		Part->bLoadFailed = true;
+		return;
+	}
+
+	if (AActor* Placeholder = Part->Placeholder.Get())
+	{
+		Placeholder->Destroy();
+	}
+	Part->Placeholder.Reset();
+	Part->State = ELazyGeometryState::Loaded;
+	Part->LastViewedTime = FPlatformTime::Seconds();
+	Part->MemoryBytes = EstimateMemoryBytes(ImportedActor);
+
+	RecordBounds(PartNo, Part->FilePath, ImportedActor);
+	Part->Bounds = FindRecordedBounds(PartNo, Part->FilePath);
+
+	UE_LOG(LogTemp, Display, TEXT("지연 형상 임포트: %s (추정 메모리 %.1f MB, 대기 %d개, 변환 중 %d개)"),
+		*PartNo, Part->MemoryBytes / (1024.0 * 1024.0), GetNumQueuedLoads(), PendingTranslations.Num());
+
+	EnforceMemoryBudget();
+#endif
+}
+
+void FLazyGeometryManager::EnqueueLoad(const FString& PartNo)
+{
+	LoadQueue.Add(PartNo);
+}
+
+bool FLazyGeometryManager::DequeueLoad(FString& OutPartNo)
+{
+	if (LoadQueueHead >= LoadQueue.Num())
+		return false;
+
+	OutPartNo = MoveTemp(LoadQueue[LoadQueueHead++]);
+
+	// 다 비었으면 처음부터, 소비한 앞부분이 절반을 넘으면 한 번에 압축 (항목마다 앞에서 지우지 않음)
+	if (LoadQueueHead == LoadQueue.Num())
+	{
+		LoadQueue.Reset();
+		LoadQueueHead = 0;
+	}
+	else if (LoadQueueHead >= LazyGeometry::LoadQueueCompactThreshold && LoadQueueHead * 2 >= LoadQueue.Num())
+	{
+		LoadQueue.RemoveAt(0, LoadQueueHead, EAllowShrinking::No);
+		LoadQueueHead = 0;
+	}
+	return true;
+}
+
+void FLazyGeometryManager::WaitForPendingTranslations()
+{
+	// 워커 스레드가 번역기 소스를 쓰는 동안 콘솔 변수를 되돌리지 않도록 먼저 대기
+	for (FPendingTranslation& Pending : PendingTranslations)
+	{
+		Pending.Result.Wait();
+	}
+	PendingTranslations.Empty();
+
+	if (bTranslatorConfigured)
+	{
+		FDatasmithSceneManager::RestoreConsoleVariables(SavedConsoleVariables);
+		bTranslatorConfigured = false;
+	}
+}
+
+void FLazyGeometryManager::UpdateViewportVisibility()
+{
+#if WITH_EDITOR
+	FConvexVolume Frustum;
+	FVector ViewLocation;
+	if (!LazyGeometry::GetActiveViewFrustum(Frustum, ViewLocation))
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	for (TPair<FString, FLazyPart>& Pair : Parts)
+	{
+		FLazyPart& Part = Pair.Value;
+		if (!Part.Bounds.IsValid || Part.bLoadFailed)
+			continue;
+
+		const FVector Center = Part.Bounds.GetCenter();
+		const FVector Extent = Part.Bounds.GetExtent();
+		if (!Frustum.IntersectBox(Center, Extent))
+			continue;
+
+		// 너무 작게 보이는 노드는 임포트하지 않음 (전체 기체를 멀리서 볼 때 전부 임포트되는 것 방지)
+		const double Distance = FMath::Max(FVector::Dist(ViewLocation, Center), 1.0);
+		if (Extent.Size() / Distance < LazyGeometry::MinScreenSize)
+			continue;
+
+		if (Part.State == ELazyGeometryState::Placeholder)
+		{
+			Part.State = ELazyGeometryState::Queued;
+			EnqueueLoad(Pair.Key);
+		}
+		Part.LastViewedTime = Now;
+	}
+#endif
+}
+
+void FLazyGeometryManager::EnforceMemoryBudget()
+{
+	const int64 BudgetBytes = static_cast<int64>(MemoryBudgetMB) * 1024 * 1024;
+	int64 LoadedBytes = GetLoadedMemoryBytes();
+	if (LoadedBytes <= BudgetBytes)
+		return;
+
+	// 오래 보지 않은 순서로 정리 후보 정렬
+	const double Now = FPlatformTime::Seconds();
+	TArray<FString> Candidates;
+	for (const TPair<FString, FLazyPart>& Pair : Parts)
+	{
+		if (Pair.Value.State == ELazyGeometryState::Loaded && Now - Pair.Value.LastViewedTime > LazyGeometry::EvictionGraceSeconds)
+		{
+			Candidates.Add(Pair.Key);
+		}
+	}
+	Candidates.Sort([this](const FString& A, const FString& B)
+	{
+		return Parts[A].LastViewedTime < Parts[B].LastViewedTime;
+	});
+
+	int32 EvictedCount = 0;
+	for (const FString& PartNo : Candidates)
+	{
+		if (LoadedBytes <= BudgetBytes)
+			break;
+
+		FLazyPart& Part = Parts[PartNo];
+		LoadedBytes -= Part.MemoryBytes;
+		EvictToPlaceholder(PartNo, Part);
+		EvictedCount++;
+	}
+
+	if (EvictedCount > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("지연 형상 메모리 예산 초과: %d개 노드를 플레이스홀더로 되돌림 (%.1f / %d MB)"),
+			EvictedCount, LoadedBytes / (1024.0 * 1024.0), MemoryBudgetMB);
+
+		// 더 이상 참조되지 않는 메시 에셋 해제
+		if (GEngine)
+		{
+			GEngine->ForceGarbageCollection(true);
+		}
+	}
+}
+
+void FLazyGeometryManager::EvictToPlaceholder(const FString& PartNo, FLazyPart& Part)
+{
+	if (AActor* RootActor = FImportedNodeManager::Get().GetImportedActor(PartNo))
+	{
+		TArray<AActor*> Actors;
+		RootActor->GetAttachedActors(Actors, true, true);
+
+		// 자식부터 제거하여 중간 재연결 방지
+		for (int32 Index = Actors.Num() - 1; Index >= 0; --Index)
+		{
+			if (Actors[Index])
+			{
+				Actors[Index]->Destroy();
+			}
+		}
+		RootActor->Destroy();
+	}
+
+	Part.State = ELazyGeometryState::Placeholder;
+	Part.MemoryBytes = 0;
+	if (Part.Bounds.IsValid && !Part.Placeholder.IsValid())
+	{
+		Part.Placeholder = SpawnPlaceholder(PartNo, Part.Bounds);
+	}
+}
+
+AActor* FLazyGeometryManager::SpawnPlaceholder(const FString& PartNo, const FBox& Bounds)
+{
+#if WITH_EDITOR
+	UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!EditorWorld || !Bounds.IsValid)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AActor* Placeholder = EditorWorld->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Bounds.GetCenter()), SpawnParams);
+	if (!Placeholder)
+		return nullptr;
+
+	// 와이어프레임 박스만 표시 (충돌/그림자 없음)
+	UBoxComponent* BoxComponent = NewObject<UBoxComponent>(Placeholder, TEXT("Bounds"), RF_Transient);
+	BoxComponent->SetMobility(EComponentMobility::Static);
+	BoxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	BoxComponent->SetBoxExtent(Bounds.GetExtent(), false);
+	BoxComponent->ShapeColor = FColor(120, 170, 255);
+	BoxComponent->SetHiddenInGame(true);
+	Placeholder->SetRootComponent(BoxComponent);
+	Placeholder->AddInstanceComponent(BoxComponent);
+	BoxComponent->RegisterComponent();
+	BoxComponent->SetWorldLocation(Bounds.GetCenter());
+
+	Placeholder->SetActorLabel(FString::Printf(TEXT("%s (Lazy)"), *PartNo));
+	Placeholder->Tags.Add(PlaceholderTag);
+	return Placeholder;
+#else
+	return nullptr;
+#endif
+}
+
+int64 FLazyGeometryManager::EstimateMemoryBytes(AActor* RootActor)
+{
+	if (!RootActor)
+		return 0;
+
+	TArray<AActor*> Actors;
+	RootActor->GetAttachedActors(Actors, true, true);
+	Actors.Add(RootActor);
+
+	TSet<UStaticMesh*> UniqueMeshes;
+	TArray<UStaticMeshComponent*> MeshComponents;
+	for (AActor* Actor : Actors)
+	{
+		MeshComponents.Reset();
+		Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+		for (UStaticMeshComponent* MeshComp : MeshComponents)
+		{
+			if (UStaticMesh* StaticMesh = MeshComp->GetStaticMesh())
+			{
+				UniqueMeshes.Add(StaticMesh);
+			}
+		}
+	}
+
+	int64 TotalBytes = 0;
+	for (UStaticMesh* StaticMesh : UniqueMeshes)
+	{
+		TotalBytes += StaticMesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	}
+	return TotalBytes;
+}
+
+FBox FLazyGeometryManager::FindRecordedBounds(const FString& PartNo, const FString& FilePath) const
+{
+	const FRecordedBounds* Recorded = RecordedBounds.Find(PartNo);
+	if (!Recorded)
+		return FBox(EForceInit::ForceInit);
+
+	// 파일 크기와 수정 시각만 확인 (내용을 읽지 않음)
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*FilePath);
+	if (!StatData.bIsValid || StatData.FileSize != Recorded->FileSize || StatData.ModificationTime != Recorded->FileTimestamp)
+		return FBox(EForceInit::ForceInit);
+
+	return Recorded->Bounds;
+}
+
+void FLazyGeometryManager::RecordBounds(const FString& PartNo, const FString& FilePath, AActor* RootActor)
+{
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*FilePath);
+	if (!RootActor || !StatData.bIsValid)
+		return;
+
+	FMeshBoundsSoA MeshBounds;
+	FMeshBoundsEngine::CollectFromActor(RootActor, MeshBounds);
+	const FBox Bounds = FMeshBoundsEngine::ReduceTotalBounds(MeshBounds);
+	if (!Bounds.IsValid)
+		return;
+
+	FRecordedBounds& Recorded = RecordedBounds.FindOrAdd(PartNo);
+	Recorded.Bounds = Bounds;
+	Recorded.FileSize = StatData.FileSize;
+	Recorded.FileTimestamp = StatData.ModificationTime;
+	bRecordedBoundsDirty = true;
+}
+
+FString FLazyGeometryManager::GetBoundsFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ImportCache"), TEXT("LazyGeometryBounds.json"));
+}
+
+void FLazyGeometryManager::LoadRecordedBounds()
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetBoundsFilePath()))
+		return;
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("지연 형상 바운딩 박스 기록을 읽을 수 없습니다: %s"), *GetBoundsFilePath());
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* PartValues = nullptr;
+	if (!RootObject->TryGetArrayField(TEXT("Parts"), PartValues))
+		return;
+
+	for (const TSharedPtr<FJsonValue>& PartValue : *PartValues)
+	{
+		const TSharedPtr<FJsonObject>* PartObject = nullptr;
+		if (!PartValue->TryGetObject(PartObject))
+			continue;
+
+		FRecordedBounds Recorded;
+		FString PartNo;
+		FString TimestampString;
+		const TArray<TSharedPtr<FJsonValue>>* BoundsValues = nullptr;
+		if (!(*PartObject)->TryGetStringField(TEXT("PartNo"), PartNo)
+			|| !(*PartObject)->TryGetNumberField(TEXT("FileSize"), Recorded.FileSize)
+			|| !(*PartObject)->TryGetStringField(TEXT("FileTimestamp"), TimestampString)
+			|| !FDateTime::ParseIso8601(*TimestampString, Recorded.FileTimestamp)
+			|| !(*PartObject)->TryGetArrayField(TEXT("Bounds"), BoundsValues)
+			|| !LazyGeometry::BoxFromJson(*BoundsValues, Recorded.Bounds))
+		{
+			continue;
+		}
+
+		RecordedBounds.Add(PartNo, Recorded);
+	}
+}
+
+void FLazyGeometryManager::SaveRecordedBounds()
+{
+	TArray<TSharedPtr<FJsonValue>> PartValues;
+	for (const TPair<FString, FRecordedBounds>& Pair : RecordedBounds)
+	{
+		TSharedPtr<FJsonObject> PartObject = MakeShared<FJsonObject>();
+		PartObject->SetStringField(TEXT("PartNo"), Pair.Key);
+		PartObject->SetNumberField(TEXT("FileSize"), static_cast<double>(Pair.Value.FileSize));
+		PartObject->SetStringField(TEXT("FileTimestamp"), Pair.Value.FileTimestamp.ToIso8601());
+		PartObject->SetArrayField(TEXT("Bounds"), LazyGeometry::BoxToJson(Pair.Value.Bounds));
+		PartValues.Add(MakeShared<FJsonValueObject>(PartObject));
+	}
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetArrayField(TEXT("Parts"), PartValues);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(RootObject, Writer);
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetBoundsFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("지연 형상 바운딩 박스 기록 저장 실패: %s"), *GetBoundsFilePath());
+	}
+	bRecordedBoundsDirty = false;
+}
+
+void FLazyGeometryManager::OnImportedNodeChanged(const FString& PartNo)
+{
+	// 전체 재구성 알림과 지연 임포트 자체의 알림은 무시
+	if (PartNo.IsEmpty() || bLoadingPart)
+		return;
+
+	AActor* ImportedActor = FImportedNodeManager::Get().GetImportedActor(PartNo);
+	if (!ImportedActor)
+		return;
+
+	// 등록된 노드를 직접 임포트한 경우 플레이스홀더 정리
+	if (FLazyPart* Part = Parts.Find(PartNo))
+	{
+		if (Part->State != ELazyGeometryState::Loaded)
+		{
+			if (AActor* Placeholder = Part->Placeholder.Get())
+			{
+				Placeholder->Destroy();
+			}
+			Part->Placeholder.Reset();
+			Part->State = ELazyGeometryState::Loaded;
+			Part->LastViewedTime = FPlatformTime::Seconds();
+			Part->MemoryBytes = EstimateMemoryBytes(ImportedActor);
+		}
+	}
+
+	// 파일 기록과 일치하는 바운딩 박스가 없으면 기록 (다음 지연 등록 때 플레이스홀더로 사용)
+	FPartFileIndex* FileIndex = FServiceLocator::GetCADFileIndex();
+	const FString* FilePath = FileIndex ? FileIndex->FindFile(PartNo) : nullptr;
+	if (FilePath && !FindRecordedBounds(PartNo, *FilePath).IsValid)
+	{
+		RecordBounds(PartNo, *FilePath, ImportedActor);
+	}
+}
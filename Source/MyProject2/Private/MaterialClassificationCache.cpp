@@ -0,0 +1,110 @@
+﻿// MaterialClassificationCache.cpp
+#include "MaterialClassificationCache.h"
+#include "Materials/MaterialInterface.h"
+#include "UObject/UObjectGlobals.h"
+
+FMaterialClassificationCache* FMaterialClassificationCache::Instance = nullptr;
+
+FMaterialClassificationCache& FMaterialClassificationCache::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FMaterialClassificationCache();
+	}
+	return *Instance;
+}
+
+void FMaterialClassificationCache::Shutdown()
+{
+	delete Instance;
+	Instance = nullptr;
+}
+
+FMaterialClassificationCache::FMaterialClassificationCache()
+{
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+		this, &FMaterialClassificationCache::OnObjectPropertyChanged);
+}
+
+FMaterialClassificationCache::~FMaterialClassificationCache()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+}
+
+bool FMaterialClassificationCache::IsTransparent(UMaterialInterface* Material)
+{
+	if (!Material)
+		return false;
+
+	const FString MaterialPath = Material->GetPathName();
+	if (const bool* bCached = TransparencyByPath.Find(MaterialPath))
+	{
+		return *bCached;
+	}
+
+	const bool bTransparent = ClassifyTransparency(Material);
+	TransparencyByPath.Add(MaterialPath, bTransparent);
+	return bTransparent;
+}
+
+bool FMaterialClassificationCache::HasAnyTransparent(const TArray<UMaterialInterface*>& Materials)
+{
+	for (UMaterialInterface* Material : Materials)
+	{
+		if (IsTransparent(Material))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FMaterialClassificationCache::Invalidate(const UMaterialInterface* Material)
+{
+	if (Material)
+	{
+		TransparencyByPath.Remove(Material->GetPathName());
+	}
+}
+
+void FMaterialClassificationCache::Clear()
+{
+	TransparencyByPath.Empty();
+}
+
+float FMaterialClassificationCache::ExtractAlphaFromColorName(const FString& ColorName)
+{
+	// 색상 이름이 "color_RRGGBBAA" 형식인지 확인
+	if (!ColorName.StartsWith(TEXT("color_")) || ColorName.Len() < 15)
+		return 1.0f;
+
+	// 마지막 2자리가 알파 값
+	const FString AlphaHex = ColorName.Right(2);
+	if (uint32 AlphaInt = FParse::HexNumber(*AlphaHex))
+	{
+		return AlphaInt / 255.0f;
+	}
+
+	return 1.0f;
+}
+
+bool FMaterialClassificationCache::ClassifyTransparency(UMaterialInterface* Material)
+{
+	// 1. 메터리얼 블렌드 모드 확인
+	if (Material->GetBlendMode() != BLEND_Opaque)
+	{
+		return true;
+	}
+
+	// 2. 이름에서 알파 값 확인 (1.0보다 작으면 투명도 있음)
+	return ExtractAlphaFromColorName(Material->GetName()) < 1.0f;
+}
+
+void FMaterialClassificationCache::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// 블렌드 모드 등 머티리얼 속성이 바뀌면 다음 조회 시 다시 분류
+	if (const UMaterialInterface* Material = Cast<UMaterialInterface>(Object))
+	{
+		Invalidate(Material);
+	}
+}
@@ -0,0 +1,245 @@
+﻿// MeshBoundsEngine.cpp
+#include "MeshBoundsEngine.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+
+namespace MeshBoundsEngine
+{
+	/** 병렬 처리 청크 크기 */
+	static const int32 ChunkSize = 2048;
+
+	/** 연속된 float 배열의 최소값 (4개씩 SIMD 처리) */
+	static float ReduceMin(const float* Data, int32 Count)
+	{
+		VectorRegister4Float Acc = VectorSetFloat1(MAX_flt);
+		int32 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			Acc = VectorMin(Acc, VectorLoad(Data + Index));
+		}
+
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Acc, Lanes);
+		float Result = FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+		for (; Index < Count; ++Index)
+		{
+			Result = FMath::Min(Result, Data[Index]);
+		}
+		return Result;
+	}
+
+	/** 연속된 float 배열의 최대값 (4개씩 SIMD 처리) */
+	static float ReduceMax(const float* Data, int32 Count)
+	{
+		VectorRegister4Float Acc = VectorSetFloat1(-MAX_flt);
+		int32 Index = 0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			Acc = VectorMax(Acc, VectorLoad(Data + Index));
+		}
+
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Acc, Lanes);
+		float Result = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+		for (; Index < Count; ++Index)
+		{
+			Result = FMath::Max(Result, Data[Index]);
+		}
+		return Result;
+	}
+}
+
+void FMeshBoundsSoA::Reset()
+{
+	MinX.Reset();
+	MinY.Reset();
+	MinZ.Reset();
+	MaxX.Reset();
+	MaxY.Reset();
+	MaxZ.Reset();
+	Components.Reset();
+	InstanceIndices.Reset();
+}
+
+void FMeshBoundsSoA::Add(const FBox& Box, UStaticMeshComponent* Component, int32 InstanceIndex)
+{
+	MinX.Add(static_cast<float>(Box.Min.X));
+	MinY.Add(static_cast<float>(Box.Min.Y));
+	MinZ.Add(static_cast<float>(Box.Min.Z));
+	MaxX.Add(static_cast<float>(Box.Max.X));
+	MaxY.Add(static_cast<float>(Box.Max.Y));
+	MaxZ.Add(static_cast<float>(Box.Max.Z));
+	Components.Add(Component);
+	InstanceIndices.Add(InstanceIndex);
+}
+
+FBox FMeshBoundsSoA::GetBox(int32 Index) const
+{
+	return FBox(FVector(MinX[Index], MinY[Index], MinZ[Index]), FVector(MaxX[Index], MaxY[Index], MaxZ[Index]));
+}
+
+int32 FMeshBoundsEngine::CollectFromActor(AActor* RootActor, FMeshBoundsSoA& OutBounds)
+{
+	if (!RootActor)
+		return 0;
+
+	const int32 StartCount = OutBounds.Num();
+
+	// 부착 계층을 스택으로 순회 (액터별 컴포넌트는 한 번만 조회)
+	TArray<AActor*> Stack;
+	Stack.Add(RootActor);
+
+	TArray<UStaticMeshComponent*> MeshComponents;
+	TArray<AActor*> AttachedActors;
+
+	while (Stack.Num() > 0)
+	{
+		AActor* Actor = Stack.Pop(EAllowShrinking::No);
+
+		MeshComponents.Reset();
+		Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+
+		for (UStaticMeshComponent* MeshComp : MeshComponents)
+		{
+			UStaticMesh* Mesh = MeshComp ? MeshComp->GetStaticMesh() : nullptr;
+			if (!Mesh)
+				continue;
+
+			// 인스턴스 컴포넌트는 인스턴스별 박스로 펼침
+			if (UInstancedStaticMeshComponent* InstancedComp = Cast<UInstancedStaticMeshComponent>(MeshComp))
+			{
+				const FBox LocalBox = Mesh->GetBounds().GetBox();
+				const int32 InstanceCount = InstancedComp->GetInstanceCount();
+				for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+				{
+					FTransform InstanceTransform;
+					if (InstancedComp->GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+					{
+						OutBounds.Add(LocalBox.TransformBy(InstanceTransform), InstancedComp, InstanceIndex);
+					}
+				}
+				continue;
+			}
+
+			OutBounds.Add(MeshComp->Bounds.GetBox(), MeshComp);
+		}
+
+		AttachedActors.Reset();
+		Actor->GetAttachedActors(AttachedActors, false);
+		for (AActor* Child : AttachedActors)
+		{
+			if (Child)
+			{
+				Stack.Add(Child);
+			}
+		}
+	}
+
+	return OutBounds.Num() - StartCount;
+}
+
+FBox FMeshBoundsEngine::ReduceTotalBounds(const FMeshBoundsSoA& Bounds)
+{
+	const int32 Count = Bounds.Num();
+	if (Count == 0)
+		return FBox(EForceInit::ForceInit);
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, MeshBoundsEngine::ChunkSize);
+
+	// 청크별 [MinX, MinY, MinZ, MaxX, MaxY, MaxZ]
+	TArray<float> ChunkResults;
+	ChunkResults.SetNumUninitialized(NumChunks * 6);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * MeshBoundsEngine::ChunkSize;
+		const int32 Num = FMath::Min(MeshBoundsEngine::ChunkSize, Count - Start);
+		float* Out = ChunkResults.GetData() + ChunkIndex * 6;
+
+		Out[0] = MeshBoundsEngine::ReduceMin(Bounds.MinX.GetData() + Start, Num);
+		Out[1] = MeshBoundsEngine::ReduceMin(Bounds.MinY.GetData() + Start, Num);
+		Out[2] = MeshBoundsEngine::ReduceMin(Bounds.MinZ.GetData() + Start, Num);
+		Out[3] = MeshBoundsEngine::ReduceMax(Bounds.MaxX.GetData() + Start, Num);
+		Out[4] = MeshBoundsEngine::ReduceMax(Bounds.MaxY.GetData() + Start, Num);
+		Out[5] = MeshBoundsEngine::ReduceMax(Bounds.MaxZ.GetData() + Start, Num);
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// 청크 결과 병합
+	FVector Min(MAX_flt);
+	FVector Max(-MAX_flt);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		const float* Chunk = ChunkResults.GetData() + ChunkIndex * 6;
+		Min = Min.ComponentMin(FVector(Chunk[0], Chunk[1], Chunk[2]));
+		Max = Max.ComponentMax(FVector(Chunk[3], Chunk[4], Chunk[5]));
+	}
+
+	return FBox(Min, Max);
+}
+
+void FMeshBoundsEngine::ComputeVolumes(const FMeshBoundsSoA& Bounds, TArray<float>& OutVolumes)
+{
+	const int32 Count = Bounds.Num();
+	OutVolumes.SetNumUninitialized(Count);
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, MeshBoundsEngine::ChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * MeshBoundsEngine::ChunkSize;
+		const int32 End = FMath::Min(Start + MeshBoundsEngine::ChunkSize, Count);
+
+		// 축별 배열을 순차 접근하므로 컴파일러 자동 벡터화 대상
+		for (int32 Index = Start; Index < End; ++Index)
+		{
+			OutVolumes[Index] = (Bounds.MaxX[Index] - Bounds.MinX[Index])
+				* (Bounds.MaxY[Index] - Bounds.MinY[Index])
+				* (Bounds.MaxZ[Index] - Bounds.MinZ[Index]);
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FMeshBoundsEngine::SelectLargestByVolume(const TArray<float>& Volumes, int32 TopN, TArray<int32>& OutIndices)
+{
+	const int32 Count = Volumes.Num();
+	const int32 ResultCount = (TopN > 0) ? FMath::Min(TopN, Count) : Count;
+
+	OutIndices.Reset();
+	if (ResultCount == 0)
+		return;
+
+	// 체적 내림차순 비교 (숫자 키만 사용)
+	auto IsLarger = [&Volumes](int32 A, int32 B) { return Volumes[A] > Volumes[B]; };
+
+	if (ResultCount == Count)
+	{
+		OutIndices.SetNumUninitialized(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			OutIndices[Index] = Index;
+		}
+		OutIndices.Sort(IsLarger);
+		return;
+	}
+
+	// 상위 N개만 유지하는 최소 힙 (힙의 루트가 현재 N번째로 큰 값)
+	auto IsSmaller = [&Volumes](int32 A, int32 B) { return Volumes[A] < Volumes[B]; };
+	OutIndices.Reserve(ResultCount);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (OutIndices.Num() < ResultCount)
+		{
+			OutIndices.HeapPush(Index, IsSmaller);
+		}
+		else if (Volumes[Index] > Volumes[OutIndices.HeapTop()])
+		{
+			OutIndices.HeapPopDiscard(IsSmaller, EAllowShrinking::No);
+			OutIndices.HeapPush(Index, IsSmaller);
+		}
+	}
+
+	OutIndices.Sort(IsLarger);
+}
@@ -0,0 +1,563 @@
+﻿// PartBoundsHierarchy.cpp
+#include "PartBoundsHierarchy.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "ImportedNodeManager.h"
+#include "PartInstancedMeshComponent.h"
+#include "UI/PartTreeItem.h"
+
+FPartBoundsHierarchy* FPartBoundsHierarchy::Instance = nullptr;
+
+void FPartBoundsOctreeSemantics::SetElementId(const FPartBoundsOctreeElement& Element, FOctreeElementId2 Id)
+{
+	Element.Owner->Leaves[Element.LeafIndex].OctreeId = Id;
+}
+
+FPartBoundsHierarchy& FPartBoundsHierarchy::Get()
+{
+	if (!Instance)
+	{
+		Instance = new FPartBoundsHierarchy();
+	}
+	return *Instance;
+}
+
+void FPartBoundsHierarchy::Shutdown()
+{
+	delete Instance;
+	Instance = nullptr;
+}
+
+FPartBoundsHierarchy::FPartBoundsHierarchy()
+	: LeafOctree(FVector::ZeroVector, HALF_WORLD_MAX)
+{
+	ImportedNodeChangedHandle = FImportedNodeManager::Get().OnImportedNodeChanged().AddRaw(
+		this, &FPartBoundsHierarchy::OnImportedNodeChanged);
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FPartBoundsHierarchy::OnActorMoved);
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FPartBoundsHierarchy::OnLevelActorDeleted);
+	}
+#endif
+}
+
+FPartBoundsHierarchy::~FPartBoundsHierarchy()
+{
+	FImportedNodeManager::Get().OnImportedNodeChanged().Remove(ImportedNodeChangedHandle);
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+	}
+#endif
+}
+
+void FPartBoundsHierarchy::SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems)
+{
+	BomParents.Empty();
+	BomItems.Empty();
+
+	// 트리를 한 번 순회하며 부모 관계 기록
+	TArray<FPartTreeItem*> Stack;
+	for (const TSharedPtr<FPartTreeItem>& Root : RootItems)
+	{
+		if (Root.IsValid())
+		{
+			BomItems.Add(Root->PartNo, Root);
+			Stack.Add(Root.Get());
+		}
+	}
+
+	while (Stack.Num() > 0)
+	{
+		FPartTreeItem* Item = Stack.Pop(EAllowShrinking::No);
+		for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+		{
+			if (Child.IsValid() && !BomItems.Contains(Child->PartNo))
+			{
+				BomItems.Add(Child->PartNo, Child);
+				BomParents.Add(Child->PartNo, Item->PartNo);
+				Stack.Add(Child.Get());
+			}
+		}
+	}
+
+	// 노드 대응 관계가 바뀌므로 전체 재구성
+	ResetHierarchy();
+	bPendingFullRebuild = true;
+}
+
+FBox FPartBoundsHierarchy::GetBounds(const FString& PartNo)
+{
+	FlushPendingAssemblies();
+
+	const FBoundsNode* Node = Nodes.Find(PartNo);
+	return Node ? Node->SubtreeBounds : FBox(EForceInit::ForceInit);
+}
+
+void FPartBoundsHierarchy::FindPartsIntersecting(const FBox& QueryBox, TArray<FString>& OutPartNos, float Radius)
+{
+	FlushPendingAssemblies();
+
+	OutPartNos.Reset();
+	if (!QueryBox.IsValid)
+		return;
+
+	// 반경만큼 넓힌 박스로 후보를 찾고, 박스 간 거리로 걸러냄
+	const float ClampedRadius = FMath::Max(Radius, 0.0f);
+	const FBox SearchBox = QueryBox.ExpandBy(ClampedRadius);
+	const double RadiusSquared = FMath::Square((double)ClampedRadius);
+
+	TSet<FString> FoundPartNos;
+	LeafOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(SearchBox), [&](const FPartBoundsOctreeElement& Element)
+	{
+		const FBoundsLeaf& Leaf = Leaves[Element.LeafIndex];
+		if (QueryBox.ComputeSquaredDistanceToBox(Leaf.Bounds) <= RadiusSquared)
+		{
+			bool bAlreadyFound = false;
+			FoundPartNos.Add(Leaf.NodePartNo, &bAlreadyFound);
+			if (!bAlreadyFound)
+			{
+				OutPartNos.Add(Leaf.NodePartNo);
+			}
+		}
+	});
+}
+
+void FPartBoundsHierarchy::FlushPendingAssemblies()
+{
+	if (!bPendingFullRebuild && PendingAssemblies.Num() == 0)
+		return;
+
+	FImportedNodeManager& NodeManager = FImportedNodeManager::Get();
+	TSet<FString> DirtyNodes;
+
+	if (bPendingFullRebuild)
+	{
+		ResetHierarchy();
+		for (const TPair<FString, TWeakObjectPtr<AActor>>& Pair : NodeManager.GetAllImportedNodes())
+		{
+			if (AActor* RootActor = Pair.Value.Get())
+			{
+				BuildAssembly(Pair.Key, RootActor, DirtyNodes);
+			}
+		}
+	}
+	else
+	{
+		for (const FString& AssemblyPartNo : PendingAssemblies)
+		{
+			RemoveAssembly(AssemblyPartNo, DirtyNodes);
+			if (AActor* RootActor = NodeManager.GetImportedActor(AssemblyPartNo))
+			{
+				BuildAssembly(AssemblyPartNo, RootActor, DirtyNodes);
+			}
+		}
+	}
+
+	bPendingFullRebuild = false;
+	PendingAssemblies.Empty();
+
+	Refit(DirtyNodes);
+
+	UE_LOG(LogTemp, Verbose, TEXT("파트 바운딩 박스 계층 갱신: 어셈블리 %d개, 노드 %d개, 잎 %d개"),
+		Assemblies.Num(), Nodes.Num(), Leaves.Num());
+}
+
+void FPartBoundsHierarchy::ResetHierarchy()
+{
+	Nodes.Empty();
+	RootNodes.Empty();
+	LeafOctree.Destroy();
+	Leaves.Empty();
+	ActorLeaves.Empty();
+	Assemblies.Empty();
+	PendingAssemblies.Empty();
+}
+
+void FPartBoundsHierarchy::BuildAssembly(const FString& AssemblyPartNo, AActor* RootActor, TSet<FString>& DirtyNodes)
+{
+	FBoundsAssembly& Assembly = Assemblies.Add(AssemblyPartNo);
+	Assembly.RootActor = RootActor;
+
+	// 어셈블리 하위 BOM 파트 집합 (라벨 대응용)
+	TSet<FString> SubtreeParts;
+	SubtreeParts.Add(AssemblyPartNo);
+	if (TSharedPtr<FPartTreeItem> AssemblyItem = BomItems.FindRef(AssemblyPartNo).Pin())
+	{
+		TArray<const FPartTreeItem*> ItemStack;
+		ItemStack.Add(AssemblyItem.Get());
+		while (ItemStack.Num() > 0)
+		{
+			const FPartTreeItem* Item = ItemStack.Pop(EAllowShrinking::No);
+			for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+			{
+				if (Child.IsValid())
+				{
+					SubtreeParts.Add(Child->PartNo);
+					ItemStack.Add(Child.Get());
+				}
+			}
+		}
+	}
+
+	auto AddLeaf = [&](FBoundsLeaf&& Leaf)
+	{
+		Leaf.AssemblyPartNo = AssemblyPartNo;
+		Leaf.Bounds = ComputeLeafBounds(Leaf);
+		if (!Leaf.Bounds.IsValid)
+			return;
+
+		const FString NodePartNo = Leaf.NodePartNo;
+		Leaf.ActorKey = TObjectKey<AActor>(Leaf.Actor.Get());
+		const TObjectKey<AActor> ActorKey = Leaf.ActorKey;
+		const int32 LeafIndex = Leaves.Add(MoveTemp(Leaf));
+
+		AddLeafToOctree(LeafIndex);
+		EnsureNode(NodePartNo).LeafIndices.Add(LeafIndex);
+		ActorLeaves.FindOrAdd(ActorKey).Add(LeafIndex);
+		Assembly.LeafIndices.Add(LeafIndex);
+		DirtyNodes.Add(NodePartNo);
+	};
+
+	// 부착 계층 순회 (라벨이 대응되지 않는 액터는 부모의 노드를 상속)
+	TArray<TPair<AActor*, FString>> Stack;
+	Stack.Emplace(RootActor, AssemblyPartNo);
+
+	TArray<UStaticMeshComponent*> MeshComponents;
+	TArray<AActor*> AttachedActors;
+
+	while (Stack.Num() > 0)
+	{
+		const TPair<AActor*, FString> Entry = Stack.Pop(EAllowShrinking::No);
+		AActor* Actor = Entry.Key;
+		const FString NodePartNo = (Actor == RootActor)
+			? AssemblyPartNo
+			: ResolveNodePartNo(Actor->GetActorLabel(), SubtreeParts, Entry.Value);
+
+		bool bHasOwnMesh = false;
+		MeshComponents.Reset();
+		Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
+		for (UStaticMeshComponent* MeshComp : MeshComponents)
+		{
+			UInstancedStaticMeshComponent* InstancedComp = Cast<UInstancedStaticMeshComponent>(MeshComp);
+			if (!InstancedComp)
+			{
+				bHasOwnMesh = true;
+				continue;
+			}
+
+			// 인스턴스는 인스턴스 라벨로 노드 대응
+			const UPartInstancedMeshComponent* PartInstancedComp = Cast<UPartInstancedMeshComponent>(InstancedComp);
+			for (int32 InstanceIndex = 0; InstanceIndex < InstancedComp->GetInstanceCount(); ++InstanceIndex)
+			{
+				const FString InstanceLabel = (PartInstancedComp && PartInstancedComp->InstancePartLabels.IsValidIndex(InstanceIndex))
+					? PartInstancedComp->InstancePartLabels[InstanceIndex]
+					: FString();
+
+				FBoundsLeaf Leaf;
+				Leaf.Actor = Actor;
+				Leaf.InstancedComponent = InstancedComp;
+				Leaf.InstanceIndex = InstanceIndex;
+				Leaf.NodePartNo = ResolveNodePartNo(InstanceLabel, SubtreeParts, NodePartNo);
+				AddLeaf(MoveTemp(Leaf));
+			}
+		}
+
+		// 일반 스태틱 메시 컴포넌트는 액터 단위 잎 하나
+		if (bHasOwnMesh)
+		{
+			FBoundsLeaf Leaf;
+			Leaf.Actor = Actor;
+			Leaf.NodePartNo = NodePartNo;
+			AddLeaf(MoveTemp(Leaf));
+		}
+
+		AttachedActors.Reset();
+		Actor->GetAttachedActors(AttachedActors, false);
+		for (AActor* Child : AttachedActors)
+		{
+			if (Child)
+			{
+				Stack.Emplace(Child, NodePartNo);
+			}
+		}
+	}
+}
+
+void FPartBoundsHierarchy::RemoveAssembly(const FString& AssemblyPartNo, TSet<FString>& DirtyNodes)
+{
+	FBoundsAssembly Assembly;
+	if (!Assemblies.RemoveAndCopyValue(AssemblyPartNo, Assembly))
+		return;
+
+	for (int32 LeafIndex : Assembly.LeafIndices)
+	{
+		RemoveLeaf(LeafIndex, DirtyNodes);
+	}
+}
+
+void FPartBoundsHierarchy::RemoveLeaf(int32 LeafIndex, TSet<FString>& DirtyNodes)
+{
+	if (!Leaves.IsValidIndex(LeafIndex))
+		return;
+
+	RemoveLeafFromOctree(LeafIndex);
+
+	const FBoundsLeaf& Leaf = Leaves[LeafIndex];
+
+	if (FBoundsNode* Node = Nodes.Find(Leaf.NodePartNo))
+	{
+		Node->LeafIndices.RemoveSingleSwap(LeafIndex, EAllowShrinking::No);
+		DirtyNodes.Add(Leaf.NodePartNo);
+	}
+
+	if (TArray<int32>* ActorLeafIndices = ActorLeaves.Find(Leaf.ActorKey))
+	{
+		ActorLeafIndices->RemoveSingleSwap(LeafIndex, EAllowShrinking::No);
+		if (ActorLeafIndices->Num() == 0)
+		{
+			ActorLeaves.Remove(Leaf.ActorKey);
+		}
+	}
+
+	if (FBoundsAssembly* Assembly = Assemblies.Find(Leaf.AssemblyPartNo))
+	{
+		Assembly->LeafIndices.RemoveSingleSwap(LeafIndex, EAllowShrinking::No);
+	}
+
+	Leaves.RemoveAt(LeafIndex);
+}
+
+FPartBoundsHierarchy::FBoundsNode& FPartBoundsHierarchy::EnsureNode(const FString& PartNo)
+{
+	if (FBoundsNode* Existing = Nodes.Find(PartNo))
+	{
+		return *Existing;
+	}
+
+	// 부모 체인을 먼저 만들어 깊이를 결정
+	const FString* ParentPartNo = BomParents.Find(PartNo);
+	int32 Depth = 0;
+	if (ParentPartNo)
+	{
+		FBoundsNode& ParentNode = EnsureNode(*ParentPartNo);
+		ParentNode.Children.Add(PartNo);
+		Depth = ParentNode.Depth + 1;
+	}
+
+	FBoundsNode& Node = Nodes.Add(PartNo);
+	Node.Depth = Depth;
+	if (ParentPartNo)
+	{
+		Node.ParentPartNo = *ParentPartNo;
+	}
+	else
+	{
+		RootNodes.Add(PartNo);
+	}
+	return Node;
+}
+
+void FPartBoundsHierarchy::Refit(const TSet<FString>& DirtyNodes)
+{
+	if (DirtyNodes.Num() == 0)
+		return;
+
+	// 더러운 노드의 자기 박스 재계산
+	TSet<FString> NodesToUpdate;
+	for (const FString& PartNo : DirtyNodes)
+	{
+		FBoundsNode* Node = Nodes.Find(PartNo);
+		if (!Node)
+			continue;
+
+		Node->OwnBounds = FBox(EForceInit::ForceInit);
+		for (int32 LeafIndex : Node->LeafIndices)
+		{
+			Node->OwnBounds += Leaves[LeafIndex].Bounds;
+		}
+
+		// 조상까지 갱신 대상에 추가 (이미 추가된 조상에서 중단)
+		for (const FString* Current = &PartNo; Current && !Current->IsEmpty(); )
+		{
+			bool bAlreadyQueued = false;
+			NodesToUpdate.Add(*Current, &bAlreadyQueued);
+			if (bAlreadyQueued)
+				break;
+
+			const FBoundsNode* CurrentNode = Nodes.Find(*Current);
+			Current = CurrentNode ? &CurrentNode->ParentPartNo : nullptr;
+		}
+	}
+
+	// 깊은 노드부터 하위 트리 박스 재계산 (각 노드 한 번씩)
+	TArray<FString> Ordered = NodesToUpdate.Array();
+	Ordered.Sort([this](const FString& A, const FString& B)
+	{
+		return Nodes[A].Depth > Nodes[B].Depth;
+	});
+
+	for (const FString& PartNo : Ordered)
+	{
+		FBoundsNode& Node = Nodes[PartNo];
+		Node.SubtreeBounds = Node.OwnBounds;
+		for (const FString& Child : Node.Children)
+		{
+			Node.SubtreeBounds += Nodes[Child].SubtreeBounds;
+		}
+
+		// 형상도 자식도 없는 노드는 계층에서 제거 (부모는 더 얕으므로 이후에 처리됨)
+		if (Node.LeafIndices.Num() == 0 && Node.Children.Num() == 0)
+		{
+			if (FBoundsNode* ParentNode = Nodes.Find(Node.ParentPartNo))
+			{
+				ParentNode->Children.RemoveSingleSwap(PartNo, EAllowShrinking::No);
+			}
+			RootNodes.Remove(PartNo);
+			Nodes.Remove(PartNo);
+		}
+	}
+}
+
+FBox FPartBoundsHierarchy::ComputeLeafBounds(const FBoundsLeaf& Leaf)
+{
+	FBox Bounds(EForceInit::ForceInit);
+
+	if (Leaf.InstanceIndex != INDEX_NONE)
+	{
+		UInstancedStaticMeshComponent* InstancedComp = Leaf.InstancedComponent.Get();
+		UStaticMesh* Mesh = InstancedComp ? InstancedComp->GetStaticMesh() : nullptr;
+		FTransform InstanceTransform;
+		if (Mesh && InstancedComp->GetInstanceTransform(Leaf.InstanceIndex, InstanceTransform, true))
+		{
+			Bounds = Mesh->GetBounds().GetBox().TransformBy(InstanceTransform);
+		}
+		return Bounds;
+	}
+
+	AActor* Actor = Leaf.Actor.Get();
+	if (!Actor)
+		return Bounds;
+
+	// 액터 자신의 스태틱 메시 컴포넌트만 (인스턴스 컴포넌트는 별도 잎)
+	Actor->ForEachComponent<UStaticMeshComponent>(false, [&Bounds](const UStaticMeshComponent* MeshComp)
+	{
+		if (MeshComp->GetStaticMesh() && !MeshComp->IsA<UInstancedStaticMeshComponent>())
+		{
+			Bounds += MeshComp->Bounds.GetBox();
+		}
+	});
+	return Bounds;
+}
+
+void FPartBoundsHierarchy::AddLeafToOctree(int32 LeafIndex)
+{
+	const FBoundsLeaf& Leaf = Leaves[LeafIndex];
+	if (!Leaf.Bounds.IsValid)
+		return;
+
+	FPartBoundsOctreeElement Element;
+	Element.Owner = this;
+	Element.LeafIndex = LeafIndex;
+	Element.Bounds = FBoxCenterAndExtent(Leaf.Bounds);
+	LeafOctree.AddElement(Element);
+}
+
+void FPartBoundsHierarchy::RemoveLeafFromOctree(int32 LeafIndex)
+{
+	FBoundsLeaf& Leaf = Leaves[LeafIndex];
+	if (Leaf.OctreeId.IsValidId())
+	{
+		LeafOctree.RemoveElement(Leaf.OctreeId);
+		Leaf.OctreeId = FOctreeElementId2();
+	}
+}
+
+FString FPartBoundsHierarchy::ResolveNodePartNo(const FString& Label, const TSet<FString>& SubtreeParts, const FString& Fallback)
+{
+	if (Label.IsEmpty())
+		return Fallback;
+
+	// 1. 라벨이 파트 번호와 정확히 일치
+	if (SubtreeParts.Contains(Label))
+		return Label;
+
+	// 2. "파트번호.인스턴스번호" 형식
+	int32 DotIndex = INDEX_NONE;
+	if (Label.FindChar(TEXT('.'), DotIndex))
+	{
+		const FString Base = Label.Left(DotIndex);
+		if (SubtreeParts.Contains(Base))
+			return Base;
+	}
+
+	return Fallback;
+}
+
+void FPartBoundsHierarchy::OnImportedNodeChanged(const FString& PartNo)
+{
+	// 빈 파트 번호는 전체 재구성 (맵 열기 등)
+	if (PartNo.IsEmpty())
+	{
+		bPendingFullRebuild = true;
+		return;
+	}
+
+	// 임포트 후처리 도중 여러 번 호출되므로 다음 조회 시 한 번만 재구성
+	PendingAssemblies.Add(PartNo);
+}
+
+void FPartBoundsHierarchy::OnActorMoved(AActor* Actor)
+{
+	if (!Actor || Leaves.Num() == 0)
+		return;
+
+	// 이동한 액터와 부착된 모든 하위 액터(손자 이하 포함)의 잎만 갱신
+	TArray<AActor*> MovedActors;
+	Actor->GetAttachedActors(MovedActors, true, true);
+	MovedActors.Add(Actor);
+
+	TSet<FString> DirtyNodes;
+	for (AActor* MovedActor : MovedActors)
+	{
+		const TArray<int32>* LeafIndices = ActorLeaves.Find(MovedActor);
+		if (!LeafIndices)
+			continue;
+
+		for (int32 LeafIndex : *LeafIndices)
+		{
+			RemoveLeafFromOctree(LeafIndex);
+			FBoundsLeaf& Leaf = Leaves[LeafIndex];
+			Leaf.Bounds = ComputeLeafBounds(Leaf);
+			DirtyNodes.Add(Leaf.NodePartNo);
+			AddLeafToOctree(LeafIndex);
+		}
+	}
+
+	Refit(DirtyNodes);
+}
+
+void FPartBoundsHierarchy::OnLevelActorDeleted(AActor* Actor)
+{
+	TArray<int32> LeafIndices;
+	if (!Actor || !ActorLeaves.RemoveAndCopyValue(Actor, LeafIndices))
+		return;
+
+	// ActorLeaves 항목은 이미 제거됨
+	TSet<FString> DirtyNodes;
+	for (int32 LeafIndex : LeafIndices)
+	{
+		RemoveLeaf(LeafIndex, DirtyNodes);
+	}
+
+	Refit(DirtyNodes);
+}
@@ -0,0 +1,320 @@
+﻿// PartFileIndex.cpp
+// 파트 번호 -> 파일 경로 인덱스 구현
+
+#include "PartFileIndex.h"
+
+#include "DirectoryWatcherModule.h"
+#include "HAL/FileManager.h"
+#include "IDirectoryWatcher.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "TreeViewUtils.h"
+#include "UI/PartTreeItem.h"
+
+FPartFileIndex::FPartFileIndex(const FString& InDirectoryPath, const FString& InFilePattern, int32 InPartIndexInFileName, bool bInRecursive)
+    : DirectoryPath(FPaths::ConvertRelativePathToFull(InDirectoryPath))
+    , FilePattern(InFilePattern)
+    , PartIndexInFileName(InPartIndexInFileName)
+    , bRecursive(bInRecursive)
+    , bIsBuilt(false)
+{
+}
+
+FPartFileIndex::~FPartFileIndex()
+{
+    StopWatching();
+}
+
+FString FPartFileIndex::GetDefaultCADDirectory()
+{
+    // 언리얼 프로젝트 루트 디렉토리에 있는 3DXML 폴더
+    return FPaths::Combine(FPaths::ProjectDir(), TEXT("3DXML"));
+}
+
+void FPartFileIndex::Rebuild()
+{
+    PartNoToFilePath.Empty();
+    bIsBuilt = true;
+    bSubtreeFlagsDirty = true;
+    
+    if (!IFileManager::Get().DirectoryExists(*DirectoryPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("파일 인덱스: 디렉토리가 존재하지 않습니다: %s"), *DirectoryPath);
+        return;
+    }
+    
+    // 디렉토리 한 번만 열거
+    TArray<FString> FoundFiles;
+    if (bRecursive)
+    {
+        IFileManager::Get().FindFilesRecursive(FoundFiles, *DirectoryPath, *FilePattern, true, false);
+    }
+    else
+    {
+        IFileManager::Get().FindFiles(FoundFiles, *(DirectoryPath / FilePattern), true, false);
+        for (FString& FileName : FoundFiles)
+        {
+            FileName = FPaths::Combine(DirectoryPath, FileName);
+        }
+    }
+    
+    PartNoToFilePath.Reserve(FoundFiles.Num());
+    for (const FString& FullPath : FoundFiles)
+    {
+        AddFile(FullPath);
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("파일 인덱스 구성 완료: %s (%s) - 파일 %d개, 파트 번호 %d개"),
+           *DirectoryPath, *FilePattern, FoundFiles.Num(), PartNoToFilePath.Num());
+}
+
+void FPartFileIndex::AddFile(const FString& FullPath)
+{
+    FString PartNo = FTreeViewUtils::ExtractPartNoFromAssetName(FPaths::GetBaseFilename(FullPath), PartIndexInFileName);
+    if (!PartNo.IsEmpty() && !PartNoToFilePath.Contains(PartNo))
+    {
+        PartNoToFilePath.Add(PartNo, FullPath);
+        bSubtreeFlagsDirty = true;
+    }
+}
+
+void FPartFileIndex::EnsureBuilt()
+{
+    if (!bIsBuilt)
+    {
+        Rebuild();
+    }
+}
+
+void FPartFileIndex::StartWatching()
+{
+    if (WatcherHandle.IsValid())
+        return;
+    
+    if (IFileManager::Get().DirectoryExists(*DirectoryPath))
+    {
+        RegisterWatch(DirectoryPath, bRecursive, &FPartFileIndex::OnDirectoryChanged);
+        return;
+    }
+    
+    // 디렉토리가 아직 없으면 상위 디렉토리를 감시하다가 생기면 전환
+    const FString ParentPath = FPaths::GetPath(DirectoryPath);
+    if (!ParentPath.IsEmpty() && IFileManager::Get().DirectoryExists(*ParentPath))
+    {
+        RegisterWatch(ParentPath, true, &FPartFileIndex::OnParentDirectoryChanged);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("파일 인덱스: 감시할 디렉토리와 상위 디렉토리가 없습니다: %s"), *DirectoryPath);
+    }
+}
+
+void FPartFileIndex::RegisterWatch(const FString& InWatchedPath, bool bIncludeDirectoryChanges, void (FPartFileIndex::*Callback)(const TArray<FFileChangeData>&))
+{
+    FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+    if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+    {
+        DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+            InWatchedPath,
+            IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, Callback),
+            WatcherHandle,
+            bIncludeDirectoryChanges ? IDirectoryWatcher::WatchOptions::IncludeDirectoryChanges : 0);
+        WatchedPath = InWatchedPath;
+        
+        UE_LOG(LogTemp, Display, TEXT("파일 인덱스 디렉토리 감시 시작: %s"), *WatchedPath);
+    }
+}
+
+void FPartFileIndex::StopWatching()
+{
+    if (WatchSwitchHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(WatchSwitchHandle);
+        WatchSwitchHandle.Reset();
+    }
+    
+    if (!WatcherHandle.IsValid())
+        return;
+    
+    if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+    {
+        if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+        {
+            DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedPath, WatcherHandle);
+        }
+    }
+    WatcherHandle.Reset();
+    WatchedPath.Empty();
+}
+
+void FPartFileIndex::OnParentDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+    if (WatchSwitchHandle.IsValid() || !IFileManager::Get().DirectoryExists(*DirectoryPath))
+        return;
+    
+    // 감시 콜백 도중에는 등록을 해제할 수 없으므로 다음 틱에 인덱스 디렉토리로 전환
+    WatchSwitchHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+    {
+        WatchSwitchHandle.Reset();
+        StopWatching();
+        StartWatching();
+        
+        // 감시 전에 들어온 파일을 반영하도록 다음 조회 시 전체 구성
+        bIsBuilt = false;
+        bSubtreeFlagsDirty = true;
+        return false;
+    }));
+}
+
+void FPartFileIndex::OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+    // 아직 구성되지 않았으면 다음 조회 시 전체 구성
+    if (!bIsBuilt)
+        return;
+    
+    const FString Extension = FPaths::GetExtension(FilePattern);
+    
+    for (const FFileChangeData& Change : FileChanges)
+    {
+        if (!Extension.IsEmpty() && !FPaths::GetExtension(Change.Filename).Equals(Extension, ESearchCase::IgnoreCase))
+            continue;
+        
+        const FString FullPath = FPaths::ConvertRelativePathToFull(Change.Filename);
+        
+        if (Change.Action == FFileChangeData::FCA_Added)
+        {
+            AddFile(FullPath);
+        }
+        else if (Change.Action == FFileChangeData::FCA_Modified)
+        {
+            // 복사/덮어쓰기는 플랫폼에 따라 변경으로만 알려지므로 아직 없는 파일이면 추가
+            if (IFileManager::Get().FileExists(*FullPath))
+            {
+                AddFile(FullPath);
+            }
+        }
+        else if (Change.Action == FFileChangeData::FCA_Removed)
+        {
+            // 같은 파트 번호의 다른 파일이 있을 수 있으므로 삭제된 파일이 대표 파일이면 다음 조회 때 재구성
+            FString PartNo = FTreeViewUtils::ExtractPartNoFromAssetName(FPaths::GetBaseFilename(FullPath), PartIndexInFileName);
+            const FString* Existing = PartNoToFilePath.Find(PartNo);
+            if (Existing && FPaths::IsSamePath(*Existing, FullPath))
+            {
+                bIsBuilt = false;
+                bSubtreeFlagsDirty = true;
+                return;
+            }
+        }
+    }
+}
+
+const FString* FPartFileIndex::FindFile(const FString& PartNo)
+{
+    EnsureBuilt();
+    return PartNoToFilePath.Find(PartNo);
+}
+
+bool FPartFileIndex::HasFile(const FString& PartNo)
+{
+    return FindFile(PartNo) != nullptr;
+}
+
+bool FPartFileIndex::HasChildWithFile(const TSharedPtr<FPartTreeItem>& Item)
+{
+    if (!Item.IsValid())
+        return false;
+    
+    EnsureBuilt();
+    
+    // 등록된 트리의 항목은 미리 계산한 플래그로 조회
+    if (PartTreeRoots.Num() > 0)
+    {
+        if (bSubtreeFlagsDirty)
+        {
+            RebuildSubtreeFlags();
+        }
+        
+        if (const bool* bHasFile = SubtreeHasFile.Find(Item.Get()))
+        {
+            return *bHasFile;
+        }
+    }
+    
+    // 등록되지 않은 항목: 직접 파일이 있는지 확인
+    if (HasFile(Item->PartNo))
+        return true;
+    
+    // 자식 항목들도 확인
+    for (const auto& Child : Item->Children)
+    {
+        if (HasChildWithFile(Child))
+            return true;
+    }
+    
+    return false;
+}
+
+void FPartFileIndex::SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems)
+{
+    PartTreeRoots = RootItems;
+    SubtreeHasFile.Empty();
+    bSubtreeFlagsDirty = true;
+}
+
+void FPartFileIndex::RebuildSubtreeFlags()
+{
+    SubtreeHasFile.Reset();
+    bSubtreeFlagsDirty = false;
+    
+    // 반복 후위 순회: 자식을 모두 처리한 뒤 부모의 플래그 결정
+    TArray<TPair<const FPartTreeItem*, bool>> Stack;
+    for (const TSharedPtr<FPartTreeItem>& Root : PartTreeRoots)
+    {
+        if (Root.IsValid())
+        {
+            Stack.Emplace(Root.Get(), false);
+        }
+    }
+    
+    while (Stack.Num() > 0)
+    {
+        const TPair<const FPartTreeItem*, bool> Entry = Stack.Pop(EAllowShrinking::No);
+        const FPartTreeItem* Item = Entry.Key;
+        
+        if (!Entry.Value)
+        {
+            Stack.Emplace(Item, true);
+            for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+            {
+                if (Child.IsValid())
+                {
+                    Stack.Emplace(Child.Get(), false);
+                }
+            }
+            continue;
+        }
+        
+        bool bHasFile = PartNoToFilePath.Contains(Item->PartNo);
+        for (int32 Index = 0; !bHasFile && Index < Item->Children.Num(); ++Index)
+        {
+            const bool* bChildHasFile = SubtreeHasFile.Find(Item->Children[Index].Get());
+            bHasFile = bChildHasFile && *bChildHasFile;
+        }
+        SubtreeHasFile.Add(Item, bHasFile);
+    }
+    
+    UE_LOG(LogTemp, Verbose, TEXT("파일 인덱스 하위 트리 플래그 계산: 항목 %d개"), SubtreeHasFile.Num());
+}
+
+bool FPartFileIndex::Matches(const FString& InDirectoryPath, const FString& InFilePattern, int32 InPartIndexInFileName) const
+{
+    return PartIndexInFileName == InPartIndexInFileName
+        && FilePattern.Equals(InFilePattern, ESearchCase::IgnoreCase)
+        && FPaths::IsSamePath(DirectoryPath, FPaths::ConvertRelativePathToFull(InDirectoryPath));
+}
+
+const TMap<FString, FString>& FPartFileIndex::GetAllFiles()
+{
+    EnsureBuilt();
+    return PartNoToFilePath;
+}
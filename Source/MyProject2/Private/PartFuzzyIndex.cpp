@@ -0,0 +1,355 @@
+﻿// PartFuzzyIndex.cpp
+// 파트 퍼지 검색 인덱스 구현
+
+#include "PartFuzzyIndex.h"
+
+#include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
+#include "UI/PartTreeItem.h"
+
+namespace PartFuzzy
+{
+	/** 채점 묶음 크기 (묶음마다 상위 N개 유지) */
+	static const int32 ChunkSize = 2048;
+
+	/** 세그먼트 구분 문자 */
+	bool IsSeparator(TCHAR Char)
+	{
+		return Char == TEXT(' ') || Char == TEXT('-') || Char == TEXT('_') || Char == TEXT('.') || Char == TEXT('/') || Char == TEXT(',');
+	}
+
+	/** 문자 비트 (영문자 26 + 숫자 10, 그 외는 한 비트) */
+	uint64 CharBit(TCHAR Char)
+	{
+		if (Char >= TEXT('a') && Char <= TEXT('z'))
+			return 1ull << (Char - TEXT('a'));
+		if (Char >= TEXT('0') && Char <= TEXT('9'))
+			return 1ull << (26 + Char - TEXT('0'));
+		return 1ull << 36;
+	}
+
+	uint64 MakeCharMask(const FString& Text)
+	{
+		uint64 Mask = 0;
+		for (TCHAR Char : Text)
+		{
+			if (!IsSeparator(Char))
+			{
+				Mask |= CharBit(Char);
+			}
+		}
+		return Mask;
+	}
+
+	/** 위치가 세그먼트 시작인지 여부 */
+	bool IsSegmentStart(const FString& Field, int32 Index)
+	{
+		return Index == 0 || IsSeparator(Field[Index - 1]);
+	}
+
+	/** 질의 토큰이 필드 세그먼트 접두사와 순서대로 일치하는지 (예: "wing spar" -> "WING-ASSY-SPAR-01") */
+	bool MatchesSegments(const TArray<FString>& Tokens, const FString& Field)
+	{
+		int32 SearchFrom = 0;
+		for (const FString& Token : Tokens)
+		{
+			bool bFound = false;
+			for (int32 Index = SearchFrom; Index + Token.Len() <= Field.Len(); ++Index)
+			{
+				if (IsSegmentStart(Field, Index) && FCString::Strncmp(*Field + Index, *Token, Token.Len()) == 0)
+				{
+					SearchFrom = Index + Token.Len();
+					bFound = true;
+					break;
+				}
+			}
+			if (!bFound)
+				return false;
+		}
+		return true;
+	}
+
+	/** 제한 편집 거리 (MaxEdits 초과면 MaxEdits + 1) */
+	int32 BoundedEditDistance(const TCHAR* A, int32 LenA, const TCHAR* B, int32 LenB, int32 MaxEdits)
+	{
+		if (FMath::Abs(LenA - LenB) > MaxEdits)
+			return MaxEdits + 1;
+
+		TArray<int32, TInlineAllocator<64>> Previous;
+		TArray<int32, TInlineAllocator<64>> Current;
+		Previous.SetNumUninitialized(LenB + 1);
+		Current.SetNumUninitialized(LenB + 1);
+		for (int32 J = 0; J <= LenB; ++J)
+		{
+			Previous[J] = J;
+		}
+
+		for (int32 I = 1; I <= LenA; ++I)
+		{
+			Current[0] = I;
+			int32 RowMin = Current[0];
+			for (int32 J = 1; J <= LenB; ++J)
+			{
+				const int32 Cost = A[I - 1] == B[J - 1] ? 0 : 1;
+				Current[J] = FMath::Min3(Previous[J] + 1, Current[J - 1] + 1, Previous[J - 1] + Cost);
+				RowMin = FMath::Min(RowMin, Current[J]);
+			}
+			if (RowMin > MaxEdits)
+				return MaxEdits + 1;
+			Swap(Previous, Current);
+		}
+		return Previous[LenB];
+	}
+
+	/** 부분 수열 일치 (글자가 순서대로 모두 있음), 건너뛴 글자 수 반환 (불일치면 -1) */
+	int32 SubsequenceGaps(const FString& Query, const FString& Field)
+	{
+		int32 FieldIndex = 0;
+		int32 Gaps = 0;
+		int32 LastMatch = INDEX_NONE;
+		for (TCHAR Char : Query)
+		{
+			if (IsSeparator(Char))
+				continue;
+			while (FieldIndex < Field.Len() && Field[FieldIndex] != Char)
+			{
+				++FieldIndex;
+			}
+			if (FieldIndex >= Field.Len())
+				return -1;
+			if (LastMatch != INDEX_NONE)
+			{
+				Gaps += FieldIndex - LastMatch - 1;
+			}
+			LastMatch = FieldIndex++;
+		}
+		return Gaps;
+	}
+
+	/** 질의 정보 (질의마다 한 번 준비) */
+	struct FPreparedQuery
+	{
+		FString Text;
+		TArray<FString> Tokens;
+		uint64 CharMask = 0;
+		int32 MaxEdits = 0;
+	};
+
+	/** 필드 하나의 점수 (0이면 불일치) */
+	int32 ScoreField(const FPreparedQuery& Query, const FString& Field, uint64 CandidateMask)
+	{
+		if (Field.IsEmpty())
+			return 0;
+
+		const FString& Text = Query.Text;
+
+		// 1. 완전 일치 / 접두사 (짧은 필드 우선)
+		if (Field.Len() == Text.Len() && Field == Text)
+			return 1000;
+		if (Field.StartsWith(Text, ESearchCase::CaseSensitive))
+			return 900 - FMath::Min(Field.Len() - Text.Len(), 100);
+
+		// 2. 부분 문자열 (세그먼트 시작이면 가산, 앞쪽일수록 가산)
+		const int32 FoundIndex = Field.Find(Text, ESearchCase::CaseSensitive);
+		if (FoundIndex != INDEX_NONE)
+		{
+			return (IsSegmentStart(Field, FoundIndex) ? 750 : 600) - FMath::Min(FoundIndex, 100);
+		}
+
+		// 3. 여러 토큰이 세그먼트 접두사와 순서대로 일치
+		if (Query.Tokens.Num() > 1 && MatchesSegments(Query.Tokens, Field))
+			return 650;
+
+		// 4. 편집 거리 (오타): 같은 길이의 접두사 또는 전체 필드와 비교
+		if (Query.MaxEdits > 0)
+		{
+			const int32 PrefixDistance = BoundedEditDistance(*Text, Text.Len(), *Field, FMath::Min(Field.Len(), Text.Len()), Query.MaxEdits);
+			const int32 FullDistance = BoundedEditDistance(*Text, Text.Len(), *Field, Field.Len(), Query.MaxEdits);
+			const int32 Distance = FMath::Min(PrefixDistance, FullDistance);
+			if (Distance <= Query.MaxEdits)
+				return 500 - Distance * 120;
+		}
+
+		// 5. 부분 수열 (글자가 모두 있을 때만 검사)
+		if ((Query.CharMask & ~CandidateMask) == 0)
+		{
+			const int32 Gaps = SubsequenceGaps(Text, Field);
+			if (Gaps >= 0)
+				return FMath::Max(300 - Gaps * 5, 100);
+		}
+
+		return 0;
+	}
+
+	/** 점수 비교 (높은 점수, 얕은 레벨, 파트 번호 순) */
+	bool IsBetter(const FPartFuzzyMatch& A, const FPartFuzzyMatch& B)
+	{
+		if (A.Score != B.Score)
+			return A.Score > B.Score;
+		if (A.Item->Level != B.Item->Level)
+			return A.Item->Level < B.Item->Level;
+		return A.Item->PartNo < B.Item->PartNo;
+	}
+}
+
+void FPartFuzzyIndex::Build(const TArray<TSharedPtr<FPartTreeItem>>& RootItems)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	Candidates.Reset();
+	ItemToIndex.Reset();
+
+	// 전위 순회하며 후보 준비 (부모 인덱스를 함께 기록)
+	TArray<TPair<TSharedPtr<FPartTreeItem>, int32>> Stack;
+	for (int32 Index = RootItems.Num() - 1; Index >= 0; --Index)
+	{
+		Stack.Emplace(RootItems[Index], INDEX_NONE);
+	}
+
+	while (Stack.Num() > 0)
+	{
+		TPair<TSharedPtr<FPartTreeItem>, int32> Entry = Stack.Pop(EAllowShrinking::No);
+		const TSharedPtr<FPartTreeItem>& Item = Entry.Key;
+		if (!Item.IsValid() || ItemToIndex.Contains(Item.Get()))
+			continue;
+
+		const int32 CandidateIndex = Candidates.AddDefaulted();
+		FCandidate& Candidate = Candidates[CandidateIndex];
+		Candidate.Item = Item;
+		Candidate.PartNoLower = Item->PartNo.ToLower();
+		Candidate.NomenclatureLower = Item->Nomenclature.ToLower();
+		Candidate.CharMask = PartFuzzy::MakeCharMask(Candidate.PartNoLower) | PartFuzzy::MakeCharMask(Candidate.NomenclatureLower);
+		Candidate.ParentIndex = Entry.Value;
+		ItemToIndex.Add(Item.Get(), CandidateIndex);
+
+		for (int32 Index = Item->Children.Num() - 1; Index >= 0; --Index)
+		{
+			Stack.Emplace(Item->Children[Index], CandidateIndex);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("파트 퍼지 검색 인덱스 구성: %d개 행 (%.1fms)"),
+		Candidates.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FPartFuzzyIndex::Query(const FString& InQuery, int32 MaxResults, TArray<FPartFuzzyMatch>& OutMatches) const
+{
+	OutMatches.Reset();
+
+	PartFuzzy::FPreparedQuery Query;
+	Query.Text = InQuery.TrimStartAndEnd().ToLower();
+	if (Query.Text.IsEmpty() || MaxResults <= 0 || Candidates.Num() == 0)
+		return;
+
+	Query.CharMask = PartFuzzy::MakeCharMask(Query.Text);
+	Query.MaxEdits = Query.Text.Len() >= 6 ? 2 : (Query.Text.Len() >= 3 ? 1 : 0);
+
+	// 구분 문자로 토큰 분리
+	FString Token;
+	for (TCHAR Char : Query.Text)
+	{
+		if (PartFuzzy::IsSeparator(Char))
+		{
+			if (!Token.IsEmpty())
+			{
+				Query.Tokens.Add(MoveTemp(Token));
+				Token.Reset();
+			}
+		}
+		else
+		{
+			Token.AppendChar(Char);
+		}
+	}
+	if (!Token.IsEmpty())
+	{
+		Query.Tokens.Add(MoveTemp(Token));
+	}
+
+	// 묶음별 병렬 채점, 묶음마다 최소 힙으로 상위 N개만 유지
+	const int32 NumChunks = FMath::DivideAndRoundUp(Candidates.Num(), PartFuzzy::ChunkSize);
+	TArray<TArray<FPartFuzzyMatch>> ChunkResults;
+	ChunkResults.SetNum(NumChunks);
+
+	const auto WorseFirst = [](const FPartFuzzyMatch& A, const FPartFuzzyMatch& B)
+	{
+		return PartFuzzy::IsBetter(B, A);
+	};
+
+	ParallelFor(NumChunks, [this, &Query, &ChunkResults, MaxResults, &WorseFirst](int32 ChunkIndex)
+	{
+		TArray<FPartFuzzyMatch>& Heap = ChunkResults[ChunkIndex];
+		const int32 Begin = ChunkIndex * PartFuzzy::ChunkSize;
+		const int32 End = FMath::Min(Begin + PartFuzzy::ChunkSize, Candidates.Num());
+
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FCandidate& Candidate = Candidates[Index];
+
+			// 파트 번호 일치를 명칭 일치보다 우선
+			const int32 PartNoScore = PartFuzzy::ScoreField(Query, Candidate.PartNoLower, Candidate.CharMask);
+			const int32 NomenclatureScore = PartFuzzy::ScoreField(Query, Candidate.NomenclatureLower, Candidate.CharMask) - 50;
+			const int32 Score = FMath::Max(PartNoScore, NomenclatureScore);
+			if (Score <= 0)
+				continue;
+
+			FPartFuzzyMatch Match;
+			Match.Item = Candidate.Item;
+			Match.Score = Score;
+			Match.bMatchedNomenclature = NomenclatureScore > PartNoScore;
+
+			if (Heap.Num() < MaxResults)
+			{
+				Heap.HeapPush(MoveTemp(Match), WorseFirst);
+			}
+			else if (PartFuzzy::IsBetter(Match, Heap.HeapTop()))
+			{
+				Heap.HeapPopDiscard(WorseFirst, EAllowShrinking::No);
+				Heap.HeapPush(MoveTemp(Match), WorseFirst);
+			}
+		}
+	});
+
+	for (TArray<FPartFuzzyMatch>& Chunk : ChunkResults)
+	{
+		OutMatches.Append(MoveTemp(Chunk));
+	}
+
+	OutMatches.Sort(&PartFuzzy::IsBetter);
+	if (OutMatches.Num() > MaxResults)
+	{
+		OutMatches.SetNum(MaxResults);
+	}
+}
+
+void FPartFuzzyIndex::GetAncestors(const FPartTreeItem* Item, TArray<TSharedPtr<FPartTreeItem>>& OutAncestors) const
+{
+	OutAncestors.Reset();
+
+	const int32* CandidateIndex = ItemToIndex.Find(Item);
+	if (!CandidateIndex)
+		return;
+
+	for (int32 ParentIndex = Candidates[*CandidateIndex].ParentIndex; ParentIndex != INDEX_NONE; ParentIndex = Candidates[ParentIndex].ParentIndex)
+	{
+		OutAncestors.Add(Candidates[ParentIndex].Item);
+	}
+	Algo::Reverse(OutAncestors);
+}
+
+FString FPartFuzzyIndex::GetAncestorPath(const FPartTreeItem* Item) const
+{
+	TArray<TSharedPtr<FPartTreeItem>> Ancestors;
+	GetAncestors(Item, Ancestors);
+
+	FString Path;
+	for (const TSharedPtr<FPartTreeItem>& Ancestor : Ancestors)
+	{
+		if (!Path.IsEmpty())
+		{
+			Path += TEXT(" > ");
+		}
+		Path += Ancestor->PartNo;
+	}
+	return Path;
+}
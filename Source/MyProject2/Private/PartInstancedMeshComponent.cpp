@@ -0,0 +1,39 @@
+﻿// PartInstancedMeshComponent.cpp
+// 파트 인스턴스 메시 컴포넌트 구현
+
+#include "PartInstancedMeshComponent.h"
+
+#include "Engine/StaticMesh.h"
+
+int32 UPartInstancedMeshComponent::FindInstanceByPartNo(const FString& PartNo) const
+{
+	if (PartNo.IsEmpty())
+		return INDEX_NONE;
+	
+	const int32 NumInstances = FMath::Min(InstancePartLabels.Num(), GetInstanceCount());
+	
+	// 라벨이 정확히 일치하는 인스턴스
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		if (InstancePartLabels[Index].Equals(PartNo, ESearchCase::IgnoreCase))
+			return Index;
+	}
+	
+	// 라벨에 파트 번호가 포함된 인스턴스 (액터 이름 검색과 같은 규칙)
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		if (InstancePartLabels[Index].Contains(PartNo, ESearchCase::IgnoreCase))
+			return Index;
+	}
+	
+	return INDEX_NONE;
+}
+
+FBox UPartInstancedMeshComponent::GetInstanceWorldBounds(int32 InstanceIndex) const
+{
+	FTransform InstanceTransform;
+	if (!GetStaticMesh() || !GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+		return FBox(ForceInit);
+	
+	return GetStaticMesh()->GetBounds().GetBox().TransformBy(InstanceTransform);
+}
@@ -4,6 +4,7 @@
 #include "ServiceLocator.h"
 #include "UI/PartImageManager.h"
 #include "ImportedNodeManager.h"
+#include "PartFileIndex.h"
 
 //=================================================================
 // FImportedNodeFilter 구현
@@ -53,6 +54,27 @@ bool FImageFilter::PassesFilter(const TSharedPtr<FPartTreeItem>& Item) const
 	return bHasImage || bHasChildWithImage;
 }
 
+//=================================================================
+// FCADFileFilter 구현
+//=================================================================
+bool FCADFileFilter::PassesFilter(const TSharedPtr<FPartTreeItem>& Item) const
+{
+	if (!bEnabled || !Item.IsValid())
+		return true;
+
+	// 인덱스가 등록되지 않았으면 필터링하지 않음
+	FPartFileIndex* CADFileIndex = FServiceLocator::GetCADFileIndex();
+	if (!CADFileIndex)
+		return true;
+
+	// 항목 자신 또는 하위 항목 중 3DXML 파일이 있는지 확인
+	bool bHasCADFile = CADFileIndex->HasChildWithFile(Item);
+    
+	UE_LOG(LogTemp, Verbose, TEXT("CAD 파일 필터 검사: PartNo=%s, HasCADFile=%d"), *Item->PartNo, bHasCADFile);
+    
+	return bHasCADFile;
+}
+
 //=================================================================
 // FDuplicateFilter 구현
 //=================================================================
@@ -81,6 +103,7 @@ FPartTreeViewFilterManager::FPartTreeViewFilterManager()
     AddFilter(MakeShared<FImageFilter>());
     AddFilter(MakeShared<FDuplicateFilter>());
 	AddFilter(MakeShared<FImportedNodeFilter>());
+	AddFilter(MakeShared<FCADFileFilter>());
 }
 
 FPartTreeViewFilterManager::~FPartTreeViewFilterManager()
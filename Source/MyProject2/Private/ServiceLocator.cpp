@@ -3,9 +3,11 @@
 
 #include "ServiceLocator.h"
 #include "UI/PartImageManager.h"
+#include "PartFileIndex.h"
 
 // 정적 멤버 초기화
 FPartImageManager* FServiceLocator::ImageManagerInstance = nullptr;
+FPartFileIndex* FServiceLocator::CADFileIndexInstance = nullptr;
 
 void FServiceLocator::RegisterImageManager(FPartImageManager* Manager)
 {
@@ -21,3 +23,13 @@ FPartImageManager* FServiceLocator::GetImageManager()
 	}
 	return ImageManagerInstance;
 }
+
+void FServiceLocator::RegisterCADFileIndex(FPartFileIndex* Index)
+{
+	CADFileIndexInstance = Index;
+}
+
+FPartFileIndex* FServiceLocator::GetCADFileIndex()
+{
+	return CADFileIndexInstance;
+}
@@ -0,0 +1,162 @@
+﻿// TreeViewStateStore.cpp
+// BOM별 트리뷰 상태 저장소 구현
+
+#include "TreeViewStateStore.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UI/PartTreeItem.h"
+
+namespace TreeViewStateJson
+{
+	/** 상태 파일 형식 버전 (행 번호 규칙이 바뀌면 올림) */
+	static const int32 FormatVersion = 1;
+
+	/** 오름차순 행 번호를 차이 배열로 기록 */
+	TArray<TSharedPtr<FJsonValue>> EncodeRows(TArray<int32> Rows)
+	{
+		Rows.Sort();
+
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(Rows.Num());
+		int32 Previous = 0;
+		for (int32 Row : Rows)
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Row - Previous));
+			Previous = Row;
+		}
+		return Values;
+	}
+
+	/** 차이 배열에서 행 번호 복원 */
+	void DecodeRows(const TArray<TSharedPtr<FJsonValue>>& Values, TArray<int32>& OutRows)
+	{
+		OutRows.Reset(Values.Num());
+		int32 Current = 0;
+		for (const TSharedPtr<FJsonValue>& Value : Values)
+		{
+			Current += static_cast<int32>(Value->AsNumber());
+			OutRows.Add(Current);
+		}
+	}
+}
+
+FString FTreeViewStateStore::ComputeBomHash(const FString& BomFilePath)
+{
+	FMD5Hash Hash = FMD5Hash::HashFile(*FPaths::ConvertRelativePathToFull(BomFilePath));
+	return Hash.IsValid() ? LexToString(Hash) : FString();
+}
+
+FString FTreeViewStateStore::GetStateFilePath(const FString& BomHash)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("TreeViewState"), BomHash + TEXT(".json"));
+}
+
+void FTreeViewStateStore::FlattenPreOrder(const TArray<TSharedPtr<FPartTreeItem>>& RootItems, TArray<TSharedPtr<FPartTreeItem>>& OutRows)
+{
+	OutRows.Reset();
+
+	// 스택에 역순으로 넣어 자식 순서대로 방문
+	TArray<TSharedPtr<FPartTreeItem>> Stack;
+	for (int32 Index = RootItems.Num() - 1; Index >= 0; --Index)
+	{
+		Stack.Add(RootItems[Index]);
+	}
+
+	while (Stack.Num() > 0)
+	{
+		TSharedPtr<FPartTreeItem> Item = Stack.Pop(EAllowShrinking::No);
+		if (!Item.IsValid())
+			continue;
+
+		OutRows.Add(Item);
+		for (int32 Index = Item->Children.Num() - 1; Index >= 0; --Index)
+		{
+			Stack.Add(Item->Children[Index]);
+		}
+	}
+}
+
+bool FTreeViewStateStore::Load(const FString& BomHash, FTreeViewSavedState& OutState)
+{
+	if (BomHash.IsEmpty())
+		return false;
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetStateFilePath(BomHash)))
+		return false;
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("트리뷰 상태 파일을 읽을 수 없습니다: %s"), *GetStateFilePath(BomHash));
+		return false;
+	}
+
+	if (RootObject->GetIntegerField(TEXT("Version")) != TreeViewStateJson::FormatVersion)
+		return false;
+
+	OutState = FTreeViewSavedState();
+
+	const TArray<TSharedPtr<FJsonValue>>* RowValues = nullptr;
+	if (RootObject->TryGetArrayField(TEXT("Expanded"), RowValues))
+	{
+		TreeViewStateJson::DecodeRows(*RowValues, OutState.ExpandedRows);
+	}
+	if (RootObject->TryGetArrayField(TEXT("Selected"), RowValues))
+	{
+		TreeViewStateJson::DecodeRows(*RowValues, OutState.SelectedRows);
+	}
+
+	double ScrollOffset = 0.0;
+	RootObject->TryGetNumberField(TEXT("Scroll"), ScrollOffset);
+	OutState.ScrollOffset = static_cast<float>(ScrollOffset);
+
+	RootObject->TryGetStringArrayField(TEXT("Filters"), OutState.EnabledFilters);
+	RootObject->TryGetStringField(TEXT("Search"), OutState.SearchText);
+
+	return true;
+}
+
+bool FTreeViewStateStore::Save(const FString& BomHash, const FTreeViewSavedState& State)
+{
+	if (BomHash.IsEmpty())
+		return false;
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetNumberField(TEXT("Version"), TreeViewStateJson::FormatVersion);
+	RootObject->SetArrayField(TEXT("Expanded"), TreeViewStateJson::EncodeRows(State.ExpandedRows));
+	RootObject->SetArrayField(TEXT("Selected"), TreeViewStateJson::EncodeRows(State.SelectedRows));
+	RootObject->SetNumberField(TEXT("Scroll"), State.ScrollOffset);
+
+	TArray<TSharedPtr<FJsonValue>> FilterValues;
+	for (const FString& FilterName : State.EnabledFilters)
+	{
+		FilterValues.Add(MakeShared<FJsonValueString>(FilterName));
+	}
+	RootObject->SetArrayField(TEXT("Filters"), FilterValues);
+	RootObject->SetStringField(TEXT("Search"), State.SearchText);
+
+	// 줄바꿈 없이 기록 (행 번호 배열이 길어질 수 있음)
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(RootObject, Writer);
+
+	const FString StateFilePath = GetStateFilePath(BomHash);
+	if (!FFileHelper::SaveStringToFile(JsonString, *StateFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("트리뷰 상태를 저장할 수 없습니다: %s"), *StateFilePath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("트리뷰 상태 저장: 펼침 %d, 선택 %d -> %s"),
+		State.ExpandedRows.Num(), State.SelectedRows.Num(), *StateFilePath);
+	return true;
+}
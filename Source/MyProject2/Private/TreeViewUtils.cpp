@@ -3,9 +3,15 @@
 
 #include "TreeViewUtils.h"
 
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "BatchImportScheduler.h"
 #include "DatasmithSceneManager.h"
 #include "ImportedNodeManager.h"
+#include "MeshBoundsEngine.h"
+#include "PartFileIndex.h"
 #include "Selection.h"
+#include "ServiceLocator.h"
 #include "Engine/StaticMeshActor.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "UI/LevelBasedTreeView.h" // FPartTreeItem 구조체 정의를 위해 필요
@@ -126,35 +132,210 @@ FText FTreeViewUtils::GetFormattedMetadata(const TSharedPtr<FPartTreeItem>& Item
         return FText::FromString("No item selected");
     }
     
-    // 선택된 항목의 메타데이터 구성
-    FString MetadataText = FString::Printf(
-        TEXT("S/N: %s\n")
-        TEXT("Level: %d\n")
-        TEXT("Type: %s\n")
-        TEXT("Part No: %s\n")
-        TEXT("Part Rev: %s\n")
-        TEXT("Part Status: %s\n")
-        TEXT("Latest: %s\n")
-        TEXT("Nomenclature: %s\n")
-        TEXT("Instance ID 총수량(ALL DB): %s\n")
-        TEXT("Qty: %s\n")
-        TEXT("NextPart: %s"),
-        *GetSafeString(Item->SN),
-        Item->Level,
-        *GetSafeString(Item->Type),
-        *GetSafeString(Item->PartNo),
-        *GetSafeString(Item->PartRev),
-        *GetSafeString(Item->PartStatus),
-        *GetSafeString(Item->Latest),
-        *GetSafeString(Item->Nomenclature),
-        *GetSafeString(Item->InstanceIDTotalAllDB),
-        *GetSafeString(Item->Qty),
-        *GetSafeString(Item->NextPart)
-    );
+    // 속성 목록을 "라벨: 값" 줄로 연결
+    TArray<TPair<FString, FString>> Fields;
+    GetMetadataFields(Item, Fields);
+    
+    FString MetadataText;
+    for (int32 i = 0; i < Fields.Num(); ++i)
+    {
+        if (i > 0)
+        {
+            MetadataText += TEXT("\n");
+        }
+        MetadataText += Fields[i].Key + TEXT(": ") + Fields[i].Value;
+    }
     
     return FText::FromString(MetadataText);
 }
 
+void FTreeViewUtils::GetMetadataFields(const TSharedPtr<FPartTreeItem>& Item, TArray<TPair<FString, FString>>& OutFields)
+{
+    OutFields.Reset();
+    
+    if (!Item.IsValid())
+    {
+        return;
+    }
+    
+    // 선택된 항목의 메타데이터 구성 (표시 순서 유지)
+    OutFields.Reserve(11);
+    OutFields.Emplace(TEXT("S/N"), GetSafeString(Item->SN));
+    OutFields.Emplace(TEXT("Level"), FString::FromInt(Item->Level));
+    OutFields.Emplace(TEXT("Type"), GetSafeString(Item->Type));
+    OutFields.Emplace(TEXT("Part No"), GetSafeString(Item->PartNo));
+    OutFields.Emplace(TEXT("Part Rev"), GetSafeString(Item->PartRev));
+    OutFields.Emplace(TEXT("Part Status"), GetSafeString(Item->PartStatus));
+    OutFields.Emplace(TEXT("Latest"), GetSafeString(Item->Latest));
+    OutFields.Emplace(TEXT("Nomenclature"), GetSafeString(Item->Nomenclature));
+    OutFields.Emplace(TEXT("Instance ID 총수량(ALL DB)"), GetSafeString(Item->InstanceIDTotalAllDB));
+    OutFields.Emplace(TEXT("Qty"), GetSafeString(Item->Qty));
+    OutFields.Emplace(TEXT("NextPart"), GetSafeString(Item->NextPart));
+}
+
+void FTreeViewUtils::ComputeSelectionStats(const TArray<TSharedPtr<FPartTreeItem>>& SelectedItems, FPartSelectionStats& OutStats)
+{
+    OutStats = FPartSelectionStats();
+    OutStats.SelectedCount = SelectedItems.Num();
+    
+    if (SelectedItems.Num() == 0)
+    {
+        return;
+    }
+    
+    // 1단계: 중복 제거한 선택 루트 (상위 레벨 먼저)
+    TArray<const FPartTreeItem*> Roots;
+    TMap<const FPartTreeItem*, int32> RootIndexMap;
+    {
+        TArray<TSharedPtr<FPartTreeItem>> SortedItems = SelectedItems;
+        SortedItems.RemoveAll([](const TSharedPtr<FPartTreeItem>& Item) { return !Item.IsValid(); });
+        SortedItems.StableSort([](const TSharedPtr<FPartTreeItem>& A, const TSharedPtr<FPartTreeItem>& B) {
+            return A->Level < B->Level;
+        });
+        
+        for (const TSharedPtr<FPartTreeItem>& Item : SortedItems)
+        {
+            if (!RootIndexMap.Contains(Item.Get()))
+            {
+                RootIndexMap.Add(Item.Get(), Roots.Add(Item.Get()));
+            }
+        }
+    }
+    
+    // 2단계: 임포트 상태 스냅샷 (약참조 검사는 게임 스레드에서만 수행)
+    TSet<FString> ImportedPartNos;
+    for (const TPair<FString, TWeakObjectPtr<AActor>>& Pair : FImportedNodeManager::Get().GetAllImportedNodes())
+    {
+        if (Pair.Value.IsValid())
+        {
+            ImportedPartNos.Add(Pair.Key);
+        }
+    }
+    
+    FPartImageManager* ImageManager = FServiceLocator::GetImageManager();
+    const TSet<FString> EmptyImageSet;
+    const TSet<FString>& PartsWithImage = ImageManager ? ImageManager->GetPartsWithImageSet() : EmptyImageSet;
+    
+    // 3단계: 선택 루트별로 워커 스레드에서 하위 트리 순회와 집계를 함께 수행
+    // 다른 선택 루트를 만나면 내려가지 않고 (루트 인덱스, 그 지점까지의 누적 수량 배수)만 기록하므로
+    // 조상과 자손이 함께 선택되어도 각 노드는 한 번만 순회됩니다.
+    // 누적 수량은 시작 배수에 비례하므로 루트마다 배수 1로 집계한 뒤 병합 단계에서 실제 배수를 곱합니다.
+    struct FRootResult
+    {
+        FPartSelectionStats Stats;
+        TArray<TPair<int32, double>> NestedRoots;
+    };
+    
+    TArray<FRootResult> RootResults;
+    RootResults.SetNum(Roots.Num());
+    
+    ParallelFor(Roots.Num(), [&](int32 RootIndex)
+    {
+        FRootResult& Result = RootResults[RootIndex];
+        FPartSelectionStats& Local = Result.Stats;
+        
+        TArray<TPair<const FPartTreeItem*, double>> Stack;
+        Stack.Emplace(Roots[RootIndex], 1.0);
+        
+        while (Stack.Num() > 0)
+        {
+            const TPair<const FPartTreeItem*, double> Entry = Stack.Pop(EAllowShrinking::No);
+            const FPartTreeItem* Node = Entry.Key;
+            
+            Local.TotalNodeCount++;
+            Local.TotalRolledUpQty += Entry.Value;
+            
+            if (ImportedPartNos.Contains(Node->PartNo))
+            {
+                Local.ImportedCount++;
+            }
+            if (PartsWithImage.Contains(Node->PartNo))
+            {
+                Local.WithImageCount++;
+            }
+            
+            Local.TypeCounts.FindOrAdd(GetSafeString(Node->Type))++;
+            Local.StatusCounts.FindOrAdd(GetSafeString(Node->PartStatus))++;
+            
+            for (const TSharedPtr<FPartTreeItem>& Child : Node->Children)
+            {
+                if (!Child.IsValid())
+                    continue;
+                
+                // 수량이 비어 있거나 파싱 불가하면 1개로 간주
+                double ChildQty = Child->Qty.IsEmpty() ? 1.0 : FCString::Atod(*Child->Qty);
+                if (ChildQty <= 0.0)
+                {
+                    ChildQty = 1.0;
+                }
+                
+                // 하위에 있는 다른 선택 루트는 그 루트의 작업에서 집계
+                if (const int32* NestedIndex = RootIndexMap.Find(Child.Get()))
+                {
+                    Result.NestedRoots.Emplace(*NestedIndex, Entry.Value * ChildQty);
+                    continue;
+                }
+                
+                Stack.Emplace(Child.Get(), Entry.Value * ChildQty);
+            }
+        }
+    });
+    
+    // 4단계: 루트별 실제 수량 배수 결정 (상위 레벨 루트부터 전파, 최상위 선택 루트는 1) 후 병합
+    TArray<double> RootMultipliers;
+    RootMultipliers.Init(1.0, Roots.Num());
+    for (int32 RootIndex = 0; RootIndex < Roots.Num(); ++RootIndex)
+    {
+        for (const TPair<int32, double>& Nested : RootResults[RootIndex].NestedRoots)
+        {
+            RootMultipliers[Nested.Key] = RootMultipliers[RootIndex] * Nested.Value;
+        }
+    }
+    
+    for (int32 RootIndex = 0; RootIndex < Roots.Num(); ++RootIndex)
+    {
+        FPartSelectionStats& Local = RootResults[RootIndex].Stats;
+        Local.TotalRolledUpQty *= RootMultipliers[RootIndex];
+        OutStats.Merge(Local);
+    }
+    
+    // 표시용으로 개수 내림차순 정렬
+    OutStats.TypeCounts.ValueSort([](int32 A, int32 B) { return A > B; });
+    OutStats.StatusCounts.ValueSort([](int32 A, int32 B) { return A > B; });
+    
+    UE_LOG(LogTemp, Verbose, TEXT("선택 집계 완료: 선택 %d개, 하위 포함 노드 %d개"), OutStats.SelectedCount, OutStats.TotalNodeCount);
+}
+
+void FTreeViewUtils::CollectImportedActorsInSubtree(const TSharedPtr<FPartTreeItem>& Item, TArray<AActor*>& OutActors)
+{
+    if (!Item.IsValid())
+        return;
+    
+    TSet<FPartTreeItem*> Visited;
+    TArray<FPartTreeItem*> Stack;
+    Stack.Add(Item.Get());
+    
+    while (Stack.Num() > 0)
+    {
+        FPartTreeItem* Current = Stack.Pop(EAllowShrinking::No);
+        if (!Current || Visited.Contains(Current))
+            continue;
+        Visited.Add(Current);
+        
+        // 임포트된 노드면 해당 액터만 수집 (하위 파트는 이미 그 액터 아래에 포함됨)
+        if (AActor* ImportedActor = FImportedNodeManager::Get().GetImportedActor(Current->PartNo))
+        {
+            OutActors.AddUnique(ImportedActor);
+            continue;
+        }
+        
+        for (const TSharedPtr<FPartTreeItem>& Child : Current->Children)
+        {
+            Stack.Add(Child.Get());
+        }
+    }
+}
+
 FString FTreeViewUtils::GetSafeString(const FString& InStr)
 {
     return InStr.IsEmpty() ? TEXT("N/A") : InStr;
@@ -288,6 +469,309 @@ int32 FTreeViewUtils::CreateAndGroupItems(
     return ValidItemCount;
 }
 
+void FTreeViewUtils::BuildTreeStructure(
+    const TMap<FString, TSharedPtr<FPartTreeItem>>& PartNoToItemMap,
+    TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& LevelToItemsMap,
+    int32 MaxLevel,
+    TArray<TSharedPtr<FPartTreeItem>>& InOutRootItems)
+{
+    UE_LOG(LogTemp, Display, TEXT("트리 구조 구축 시작: 최대 레벨 %d"), MaxLevel);
+    
+    // 레벨 0부터 MaxLevel-1까지 순회하며 부모-자식 관계 설정
+    for (int32 CurrentLevel = 0; CurrentLevel < MaxLevel; ++CurrentLevel)
+    {
+        // 현재 레벨의 항목이 있는지 확인
+        if (!LevelToItemsMap.Contains(CurrentLevel))
+            continue;
+            
+        // 다음 레벨의 항목이 있는지 확인
+        if (!LevelToItemsMap.Contains(CurrentLevel + 1))
+            continue;
+        
+        // 다음 레벨의 모든 항목
+        TArray<TSharedPtr<FPartTreeItem>>& NextLevelItems = LevelToItemsMap[CurrentLevel + 1];
+        
+        int32 ConnectionCount = 0;
+        
+        // 다음 레벨의 각 항목에 대해 부모 찾기
+        for (const TSharedPtr<FPartTreeItem>& ChildItem : NextLevelItems)
+        {
+            // NextPart가 현재 레벨의 항목 중 하나와 일치하는지 확인
+            if (!ChildItem->NextPart.IsEmpty() && !ChildItem->NextPart.Equals(TEXT("nan"), ESearchCase::IgnoreCase))
+            {
+                // 직접 맵을 사용하여 부모 항목 찾기 (더 효율적)
+                const TSharedPtr<FPartTreeItem>* ParentItemPtr = PartNoToItemMap.Find(ChildItem->NextPart);
+                
+                if (ParentItemPtr && (*ParentItemPtr)->Level == CurrentLevel)
+                {
+                    // 부모-자식 관계 설정
+                    (*ParentItemPtr)->Children.Add(ChildItem);
+                    ConnectionCount++;
+                }
+            }
+        }
+        
+        UE_LOG(LogTemp, Verbose, TEXT("레벨 %d -> %d 부모-자식 연결: %d개 설정됨"), 
+            CurrentLevel, CurrentLevel + 1, ConnectionCount);
+    }
+    
+    // 루트 항목들이 설정되지 않았으면, 레벨 0의 항목들을 루트로 설정
+    if (InOutRootItems.Num() == 0 && LevelToItemsMap.Contains(0))
+    {
+        InOutRootItems = LevelToItemsMap[0];
+        UE_LOG(LogTemp, Display, TEXT("루트 항목 자동 설정: 레벨 0의 모든 항목(%d개)이 루트로 설정됨"), InOutRootItems.Num());
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("트리 구조 구축 완료: 루트 항목 %d개"), InOutRootItems.Num());
+}
+
+bool FTreeViewUtils::LoadBomTree(
+    const FString& FilePath,
+    TMap<FString, TSharedPtr<FPartTreeItem>>& OutPartNoToItemMap,
+    TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& OutLevelToItemsMap,
+    int32& OutMaxLevel,
+    TArray<TSharedPtr<FPartTreeItem>>& OutRootItems)
+{
+    OutPartNoToItemMap.Empty();
+    OutLevelToItemsMap.Empty();
+    OutRootItems.Empty();
+    OutMaxLevel = 0;
+    
+    // CSV 파일 읽기
+    TArray<TArray<FString>> ExcelData;
+    if (!ReadCSVFile(FilePath, ExcelData))
+    {
+        UE_LOG(LogTemp, Error, TEXT("CSV 파일 읽기 실패: %s"), *FilePath);
+        return false;
+    }
+    
+    if (ExcelData.Num() < 2) // 헤더 + 최소 1개 이상의 데이터 행 필요
+    {
+        UE_LOG(LogTemp, Error, TEXT("데이터 행이 부족합니다"));
+        return false;
+    }
+    
+    // 헤더 행
+    const TArray<FString>& HeaderRow = ExcelData[0];
+    
+    // 필요한 열 인덱스 찾기
+    int32 PartNoColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
+        return HeaderName == TEXT("PartNo") || HeaderName == TEXT("Part No");
+    });
+    
+    int32 NextPartColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
+        return HeaderName == TEXT("NextPart");
+    });
+    
+    int32 LevelColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
+        return HeaderName == TEXT("Level");
+    });
+    
+    // 인덱스를 찾지 못했으면 기본값 사용 (실제 엑셀 파일 구조 기준)
+    PartNoColIdx = (PartNoColIdx != INDEX_NONE) ? PartNoColIdx : 3; // D열 (Part No)
+    NextPartColIdx = (NextPartColIdx != INDEX_NONE) ? NextPartColIdx : 13; // N열 (NextPart)
+    LevelColIdx = (LevelColIdx != INDEX_NONE) ? LevelColIdx : 1; // B열 (Level)
+    
+    UE_LOG(LogTemp, Display, TEXT("CSV 데이터 읽기 완료: %d개 행"), ExcelData.Num() - 1);
+    
+    // 1단계: 모든 항목 생성 및 레벨별 그룹화
+    CreateAndGroupItems(
+        ExcelData, 
+        PartNoColIdx, 
+        NextPartColIdx, 
+        LevelColIdx,
+        OutPartNoToItemMap,
+        OutLevelToItemsMap,
+        OutMaxLevel,
+        OutRootItems
+    );
+    
+    // 2단계: 트리 구조 구축
+    BuildTreeStructure(OutPartNoToItemMap, OutLevelToItemsMap, OutMaxLevel, OutRootItems);
+    
+    return true;
+}
+
+namespace BomPatch
+{
+    /** 행 매칭 키 (레벨 + 파트 번호 + 상위 파트, 같은 키가 여러 행이면 순번) */
+    void BuildRowKeys(const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& LevelToItemsMap,
+        TArray<TPair<FString, TSharedPtr<FPartTreeItem>>>& OutRows)
+    {
+        TArray<int32> Levels;
+        LevelToItemsMap.GetKeys(Levels);
+        Levels.Sort();
+        
+        TMap<FString, int32> Occurrences;
+        for (int32 Level : Levels)
+        {
+            for (const TSharedPtr<FPartTreeItem>& Item : LevelToItemsMap[Level])
+            {
+                FString Key = FString::Printf(TEXT("%d|%s|%s"), Level, *Item->PartNo, *Item->NextPart);
+                int32& Occurrence = Occurrences.FindOrAdd(Key);
+                if (Occurrence > 0)
+                {
+                    Key += FString::Printf(TEXT("#%d"), Occurrence);
+                }
+                ++Occurrence;
+                OutRows.Emplace(MoveTemp(Key), Item);
+            }
+        }
+    }
+    
+    /** 표시 필드 복사 (값이 바뀌었으면 true) */
+    bool CopyFields(FPartTreeItem& Target, const FPartTreeItem& Source)
+    {
+        bool bChanged = false;
+        auto CopyField = [&bChanged](FString& To, const FString& From)
+        {
+            if (!To.Equals(From, ESearchCase::CaseSensitive))
+            {
+                To = From;
+                bChanged = true;
+            }
+        };
+        
+        CopyField(Target.Type, Source.Type);
+        CopyField(Target.SN, Source.SN);
+        CopyField(Target.PartRev, Source.PartRev);
+        CopyField(Target.PartStatus, Source.PartStatus);
+        CopyField(Target.Latest, Source.Latest);
+        CopyField(Target.Nomenclature, Source.Nomenclature);
+        CopyField(Target.InstanceIDTotalAllDB, Source.InstanceIDTotalAllDB);
+        CopyField(Target.Qty, Source.Qty);
+        return bChanged;
+    }
+}
+
+bool FTreeViewUtils::PatchBomTree(
+    const FString& FilePath,
+    TMap<FString, TSharedPtr<FPartTreeItem>>& InOutPartNoToItemMap,
+    TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& InOutLevelToItemsMap,
+    int32& InOutMaxLevel,
+    TArray<TSharedPtr<FPartTreeItem>>& InOutRootItems,
+    FBomPatchStats& OutStats)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutStats = FBomPatchStats();
+    
+    // 새 BOM을 별도 모델로 읽기
+    TMap<FString, TSharedPtr<FPartTreeItem>> NewPartNoToItemMap;
+    TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> NewLevelToItemsMap;
+    TArray<TSharedPtr<FPartTreeItem>> NewRootItems;
+    int32 NewMaxLevel = 0;
+    if (!LoadBomTree(FilePath, NewPartNoToItemMap, NewLevelToItemsMap, NewMaxLevel, NewRootItems))
+        return false;
+    
+    // 1. 행 키로 기존 항목과 매칭 (매칭된 행은 기존 객체 유지)
+    TArray<TPair<FString, TSharedPtr<FPartTreeItem>>> OldRows;
+    TArray<TPair<FString, TSharedPtr<FPartTreeItem>>> NewRows;
+    BomPatch::BuildRowKeys(InOutLevelToItemsMap, OldRows);
+    BomPatch::BuildRowKeys(NewLevelToItemsMap, NewRows);
+    
+    TMap<FString, TSharedPtr<FPartTreeItem>> OldKeyToItem;
+    OldKeyToItem.Reserve(OldRows.Num());
+    for (const TPair<FString, TSharedPtr<FPartTreeItem>>& Row : OldRows)
+    {
+        OldKeyToItem.Add(Row.Key, Row.Value);
+    }
+    
+    // 새 항목 -> 유지할 항목 (매칭되면 기존 항목, 아니면 새 항목 그대로)
+    TMap<const FPartTreeItem*, TSharedPtr<FPartTreeItem>> Remap;
+    Remap.Reserve(NewRows.Num());
+    TSet<const FPartTreeItem*> ReusedItems;
+    ReusedItems.Reserve(NewRows.Num());
+    
+    for (const TPair<FString, TSharedPtr<FPartTreeItem>>& Row : NewRows)
+    {
+        TSharedPtr<FPartTreeItem> OldItem;
+        if (OldKeyToItem.RemoveAndCopyValue(Row.Key, OldItem))
+        {
+            if (BomPatch::CopyFields(*OldItem, *Row.Value))
+            {
+                ++OutStats.UpdatedCount;
+                OutStats.ChangedItems.Add(OldItem);
+            }
+            Remap.Add(Row.Value.Get(), OldItem);
+            ReusedItems.Add(OldItem.Get());
+        }
+        else
+        {
+            ++OutStats.AddedCount;
+            Remap.Add(Row.Value.Get(), Row.Value);
+        }
+    }
+    
+    // 남은 기존 행은 삭제
+    for (const TPair<FString, TSharedPtr<FPartTreeItem>>& Pair : OldKeyToItem)
+    {
+        OutStats.RemovedItems.Add(Pair.Value);
+    }
+    OutStats.RemovedCount = OutStats.RemovedItems.Num();
+    
+    // 2. 자식 목록을 유지 항목 기준으로 갱신 (바뀐 경우에만 교체)
+    TArray<TSharedPtr<FPartTreeItem>> MappedChildren;
+    for (const TPair<FString, TSharedPtr<FPartTreeItem>>& Row : NewRows)
+    {
+        const TSharedPtr<FPartTreeItem>& Target = Remap[Row.Value.Get()];
+        
+        MappedChildren.Reset(Row.Value->Children.Num());
+        for (const TSharedPtr<FPartTreeItem>& Child : Row.Value->Children)
+        {
+            MappedChildren.Add(Remap[Child.Get()]);
+        }
+        
+        if (Target->Children != MappedChildren)
+        {
+            Target->Children = MappedChildren;
+            if (ReusedItems.Contains(Target.Get()))
+            {
+                OutStats.bStructureChanged = true;
+                OutStats.ChangedItems.AddUnique(Target);
+            }
+        }
+    }
+    OutStats.bStructureChanged |= OutStats.AddedCount > 0 || OutStats.RemovedCount > 0;
+    
+    // 3. 변경이 있으면 컨테이너를 유지 항목으로 교체
+    if (OutStats.HasChanges())
+    {
+        InOutPartNoToItemMap.Reset();
+        InOutPartNoToItemMap.Reserve(NewPartNoToItemMap.Num());
+        for (const TPair<FString, TSharedPtr<FPartTreeItem>>& Pair : NewPartNoToItemMap)
+        {
+            InOutPartNoToItemMap.Add(Pair.Key, Remap[Pair.Value.Get()]);
+        }
+        
+        InOutLevelToItemsMap.Reset();
+        for (const TPair<int32, TArray<TSharedPtr<FPartTreeItem>>>& Pair : NewLevelToItemsMap)
+        {
+            TArray<TSharedPtr<FPartTreeItem>>& LevelItems = InOutLevelToItemsMap.Add(Pair.Key);
+            LevelItems.Reserve(Pair.Value.Num());
+            for (const TSharedPtr<FPartTreeItem>& Item : Pair.Value)
+            {
+                LevelItems.Add(Remap[Item.Get()]);
+            }
+        }
+        
+        InOutRootItems.Reset(NewRootItems.Num());
+        for (const TSharedPtr<FPartTreeItem>& Root : NewRootItems)
+        {
+            InOutRootItems.Add(Remap[Root.Get()]);
+        }
+        
+        InOutMaxLevel = NewMaxLevel;
+    }
+    
+    OutStats.Seconds = FPlatformTime::Seconds() - StartTime;
+    
+    UE_LOG(LogTemp, Display, TEXT("BOM 증분 갱신: 추가 %d, 삭제 %d, 값 변경 %d, 구조 변경 %s (%.1fms)"),
+        OutStats.AddedCount, OutStats.RemovedCount, OutStats.UpdatedCount,
+        OutStats.bStructureChanged ? TEXT("있음") : TEXT("없음"), OutStats.Seconds * 1000.0);
+    
+    return true;
+}
+
 FFileMatchResult FTreeViewUtils::FindMatchingFileForPartNo(
     const FString& DirectoryPath,
     const FString& FilePattern,
@@ -296,6 +780,24 @@ FFileMatchResult FTreeViewUtils::FindMatchingFileForPartNo(
 {
     FFileMatchResult Result;
     
+    // 등록된 파일 인덱스와 같은 규칙이면 디렉토리를 다시 열거하지 않고 인덱스에서 조회
+    FPartFileIndex* FileIndex = FServiceLocator::GetCADFileIndex();
+    if (FileIndex && FileIndex->Matches(DirectoryPath, FilePattern, PartIndexInFileName))
+    {
+        if (const FString* FoundPath = FileIndex->FindFile(PartNo))
+        {
+            Result.FilePath = *FoundPath;
+            Result.FileName = FPaths::GetBaseFilename(*FoundPath);
+            Result.bFound = true;
+        }
+        else
+        {
+            Result.ErrorMessage = FString::Printf(TEXT("%s 디렉토리에서 파트 번호 %s에 해당하는 파일을 찾을 수 없습니다."), 
+                                                 *DirectoryPath, *PartNo);
+        }
+        return Result;
+    }
+    
     // 디렉토리 존재 확인
     if (!FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*DirectoryPath))
     {
@@ -356,7 +858,7 @@ FString FTreeViewUtils::ExtractPartNoFromAssetName(const FString& AssetName, int
 }
 
 // UI/TreeViewUtils.cpp 파일에 함수 구현 추가
-    bool FTreeViewUtils::CalculateSelectedActorMeshBounds(const FString& ActorName)
+    bool FTreeViewUtils::CalculateSelectedActorMeshBounds(const FString& ActorName, int32 TopN)
 {
     // 에디터 API 사용 가능한지 확인
 #if WITH_EDITOR
@@ -379,6 +881,11 @@ FString FTreeViewUtils::ExtractPartNoFromAssetName(const FString& AssetName, int
     int32 TotalActorsScanned = 0;
     int32 TotalComponentsFound = 0;
     
+    // 액터 간에 재사용하는 작업 버퍼
+    FMeshBoundsSoA Bounds;
+    TArray<float> Volumes;
+    TArray<int32> TopIndices;
+    
     // 선택된 모든 액터 순회
     for (FSelectionIterator It(*SelectedActors); It; ++It)
     {
@@ -392,104 +899,54 @@ FString FTreeViewUtils::ExtractPartNoFromAssetName(const FString& AssetName, int
         
         TotalActorsScanned++;
         
-        // 액터와 그 자식들의 모든 스태틱 메시 컴포넌트 찾기
-        TArray<UStaticMeshComponent*> MeshComponents;
-        Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
-        
-        // 자식 액터들에 대한 컴포넌트도 찾기
-        TArray<AActor*> ChildActors;
-        Actor->GetAttachedActors(ChildActors, true); // true: 모든 하위 계층 포함
-        
-        for (AActor* ChildActor : ChildActors)
-        {
-            if (ChildActor)
-            {
-                TArray<UStaticMeshComponent*> ChildComponents;
-                ChildActor->GetComponents<UStaticMeshComponent>(ChildComponents);
-                MeshComponents.Append(ChildComponents);
-            }
-        }
-        
-        TotalComponentsFound += MeshComponents.Num();
+        // 액터와 그 자식들의 모든 스태틱 메시 박스를 SoA 버퍼로 수집
+        Bounds.Reset();
+        const int32 BoxCount = FMeshBoundsEngine::CollectFromActor(Actor, Bounds);
+        TotalComponentsFound += BoxCount;
         
         // 컴포넌트가 없으면 다음 액터로
-        if (MeshComponents.Num() == 0)
+        if (BoxCount == 0)
         {
             UE_LOG(LogTemp, Warning, TEXT("'%s' 액터에 스태틱 메시 컴포넌트가 없습니다."), *Actor->GetName());
             continue;
         }
         
-        // 바운딩 박스 정보 배열
-        TArray<FString> BoundsInfo;
+        // 전체 바운딩 박스 (병렬 축약) 및 체적 내림차순 상위 N개 선택
+        const FBox TotalBounds = FMeshBoundsEngine::ReduceTotalBounds(Bounds);
+        FMeshBoundsEngine::ComputeVolumes(Bounds, Volumes);
+        FMeshBoundsEngine::SelectLargestByVolume(Volumes, TopN, TopIndices);
         
-        // 전체 바운딩 박스 계산용
-        FBox TotalBounds(EForceInit::ForceInit);
+        // 결과 출력 - 로그 (상위 N개만 문자열로 형식화)
+        UE_LOG(LogTemp, Display, TEXT("===== '%s' 액터의 메시 바운딩 박스 정보 (총 %d개 중 체적 상위 %d개) ====="), 
+               *Actor->GetName(), BoxCount, TopIndices.Num());
         
-        // 각 컴포넌트의 바운딩 박스 계산
-        for (UStaticMeshComponent* MeshComp : MeshComponents)
+        for (int32 Index : TopIndices)
         {
-            if (MeshComp && MeshComp->GetStaticMesh())
+            const UStaticMeshComponent* MeshComp = Bounds.Components[Index].Get();
+            const AActor* Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+            const FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
+            FString CompName = MeshComp ? MeshComp->GetName() : TEXT("Unknown");
+            if (Bounds.InstanceIndices[Index] != INDEX_NONE)
             {
-                AActor* Owner = MeshComp->GetOwner();
-                FString CompName = MeshComp->GetName();
-                FString OwnerName = Owner ? Owner->GetName() : TEXT("Unknown");
-                
-                // 바운딩 박스 가져오기 (월드 스페이스)
-                FBoxSphereBounds WorldBounds = MeshComp->Bounds;
-                FBox BoundingBox = WorldBounds.GetBox();
-                FVector BoxSize = BoundingBox.GetSize();
-                FVector BoxCenter = BoundingBox.GetCenter();
-                float Volume = BoxSize.X * BoxSize.Y * BoxSize.Z;
-                
-                // 메시 이름 가져오기
-                FString MeshName = TEXT("Unknown");
-                if (MeshComp->GetStaticMesh())
-                {
-                    MeshName = MeshComp->GetStaticMesh()->GetName();
-                }
-                
-                // 삼축의 크기를 내림차순으로 정렬
-                TArray<float> SortedDimensions;
-                SortedDimensions.Add(BoxSize.X);
-                SortedDimensions.Add(BoxSize.Y);
-                SortedDimensions.Add(BoxSize.Z);
-                SortedDimensions.Sort([](float A, float B) { return A > B; });
-                
-                // 바운딩 박스 정보 문자열 생성
-                FString BoundsStr = FString::Printf(
-                    TEXT("%s - %s (%s): 크기=[%.2f, %.2f, %.2f] (길이순), 중심=[%.2f, %.2f, %.2f], 체적: %.2f)"),
-                    *OwnerName,
-                    *CompName,
-                    *MeshName,
-                    SortedDimensions[0], SortedDimensions[1], SortedDimensions[2],
-                    BoxCenter.X, BoxCenter.Y, BoxCenter.Z,
-                    Volume
-                );
-                
-                BoundsInfo.Add(BoundsStr);
-                
-                // 전체 바운딩 박스 업데이트
-                TotalBounds += BoundingBox;
+                CompName += FString::Printf(TEXT("[%d]"), Bounds.InstanceIndices[Index]);
             }
-        }
-        
-        // 체적이 큰 순서대로 정렬
-        BoundsInfo.Sort([](const FString& A, const FString& B) {
-            FString VolumeA = A.Right(A.Find(TEXT("체적:")) + 20);
-            VolumeA = VolumeA.Left(VolumeA.Find(TEXT(")")));
+            const FString MeshName = (MeshComp && MeshComp->GetStaticMesh()) ? MeshComp->GetStaticMesh()->GetName() : TEXT("Unknown");
             
-            FString VolumeB = B.Right(B.Find(TEXT("체적:")) + 20);
-            VolumeB = VolumeB.Left(VolumeB.Find(TEXT(")")));
+            const FBox BoundingBox = Bounds.GetBox(Index);
+            const FVector BoxSize = BoundingBox.GetSize();
+            const FVector BoxCenter = BoundingBox.GetCenter();
             
-            return FCString::Atof(*VolumeA) > FCString::Atof(*VolumeB);
-        });
-        
-        // 결과 출력 - 로그
-        UE_LOG(LogTemp, Display, TEXT("===== '%s' 액터의 메시 바운딩 박스 정보 (총 %d개) ====="), *Actor->GetName(), BoundsInfo.Num());
-        
-        for (const FString& Info : BoundsInfo)
-        {
-            UE_LOG(LogTemp, Display, TEXT("%s"), *Info);
+            // 삼축의 크기를 내림차순으로 정렬
+            float SortedDimensions[3] = { (float)BoxSize.X, (float)BoxSize.Y, (float)BoxSize.Z };
+            Algo::Sort(SortedDimensions, [](float A, float B) { return A > B; });
+            
+            UE_LOG(LogTemp, Display, TEXT("%s - %s (%s): 크기=[%.2f, %.2f, %.2f] (길이순), 중심=[%.2f, %.2f, %.2f], 체적: %.2f)"),
+                *OwnerName,
+                *CompName,
+                *MeshName,
+                SortedDimensions[0], SortedDimensions[1], SortedDimensions[2],
+                BoxCenter.X, BoxCenter.Y, BoxCenter.Z,
+                Volumes[Index]);
         }
         
         // 전체 바운딩 박스 정보 계산
@@ -507,7 +964,7 @@ FString FTreeViewUtils::ExtractPartNoFromAssetName(const FString& AssetName, int
         FString NotificationText = FString::Printf(
             TEXT("'%s' 액터의 바운딩 박스 계산 완료 (컴포넌트: %d개)\n크기: [%.2f, %.2f, %.2f], 체적: %.2f"),
             *Actor->GetName(),
-            BoundsInfo.Num(),
+            BoxCount,
             TotalSize.X, TotalSize.Y, TotalSize.Z,
             TotalVolume
         );
@@ -551,8 +1008,11 @@ bool FTreeViewUtils::SetActorPivotToCenter()
     int32 MeshCount = 0;
     AActor* FirstActor = nullptr;
     TArray<AStaticMeshActor*> StaticMeshActors;
+    TSet<AActor*> VisitedActors;
+    TArray<UStaticMeshComponent*> MeshComponents;
+    TArray<AActor*> ChildActors;
     
-    // 선택된 모든 액터 및 그 자식들의 메시 컴포넌트 위치 계산
+    // 선택된 모든 액터 및 그 자식들의 메시 컴포넌트 위치 계산 (중복 선택된 하위 액터는 한 번만)
     for (FSelectionIterator It(*SelectedActors); It; ++It)
     {
         AActor* Actor = Cast<AActor>(*It);
@@ -560,34 +1020,24 @@ bool FTreeViewUtils::SetActorPivotToCenter()
         
         if (!FirstActor) FirstActor = Actor;
         
-        // StaticMeshActor 수집
-        if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor))
-            StaticMeshActors.Add(StaticMeshActor);
-        
-        // 메시 컴포넌트 위치 계산
-        TArray<UStaticMeshComponent*> MeshComponents;
-        Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
-        
-        // 자식 액터들도 포함
-        TArray<AActor*> ChildActors;
+        ChildActors.Reset();
         Actor->GetAttachedActors(ChildActors, true);
+        ChildActors.Insert(Actor, 0);
         
-        for (AActor* ChildActor : ChildActors)
+        for (AActor* CurrentActor : ChildActors)
         {
-            if (!ChildActor) continue;
+            bool bAlreadyVisited = false;
+            VisitedActors.Add(CurrentActor, &bAlreadyVisited);
+            if (!CurrentActor || bAlreadyVisited) continue;
             
-            if (AStaticMeshActor* ChildStaticMeshActor = Cast<AStaticMeshActor>(ChildActor))
-                StaticMeshActors.Add(ChildStaticMeshActor);
+            // StaticMeshActor 수집
+            if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(CurrentActor))
+                StaticMeshActors.Add(StaticMeshActor);
             
-            TArray<UStaticMeshComponent*> ChildComponents;
-            ChildActor->GetComponents<UStaticMeshComponent>(ChildComponents);
-            MeshComponents.Append(ChildComponents);
-        }
-        
-        // 모든 메시 컴포넌트의 위치 합산
-        for (UStaticMeshComponent* MeshComp : MeshComponents)
-        {
-            if (MeshComp && MeshComp->IsValidLowLevel())
+            // 메시 컴포넌트 위치 합산
+            MeshComponents.Reset();
+            CurrentActor->GetComponents<UStaticMeshComponent>(MeshComponents);
+            for (UStaticMeshComponent* MeshComp : MeshComponents)
             {
                 TotalPosition += MeshComp->GetComponentLocation();
                 MeshCount++;
@@ -607,128 +1057,136 @@ bool FTreeViewUtils::SetActorPivotToCenter()
     // 평균 위치 계산
     FVector AveragePosition = TotalPosition / MeshCount;
     
-    // 에디터 트랜잭션 시작
-    GEditor->BeginTransaction(FText::FromString(TEXT("Create Center Actor")));
-    
     UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
     if (!EditorWorld)
-    {
-        GEditor->EndTransaction();
         return false;
+    
+    // 에디터 트랜잭션 시작 (하나의 Undo 단계)
+    GEditor->BeginTransaction(FText::FromString(TEXT("Set Pivot To Center")));
+    
+    // 첫 번째 선택 액터가 메시 액터가 아니면 그 액터를 피벗으로 사용 (라벨/태그/임포트 등록 유지)
+    AActor* PivotActor = FirstActor;
+    if (!PivotActor || PivotActor->IsA<AStaticMeshActor>())
+    {
+        // 메시 액터만 선택된 경우에만 중심에 새 부모 액터 생성 (이름은 엔진이 고유하게 생성)
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        PivotActor = EditorWorld->SpawnActor<AActor>(AActor::StaticClass(), FTransform(AveragePosition), SpawnParams);
+        if (PivotActor)
+        {
+            PivotActor->SetActorLabel(TEXT("MeshCenter"));
+        }
     }
     
-    // 첫 번째 액터의 정보 저장
-    FString OriginalLabel;
-    TArray<FName> OriginalTags;
+    const int32 AttachedCount = MovePivotAndReparent(PivotActor, StaticMeshActors, AveragePosition);
+    
+    GEditor->EndTransaction();
+    
+    if (!PivotActor)
+        return false;
+    
+    // 알림 표시
+    FString NotificationText = FString::Printf(
+        TEXT("'%s' 액터의 피벗을 메시 중심으로 옮겼습니다. %d개의 StaticMeshActor가 연결되었습니다."),
+        *PivotActor->GetActorLabel(), AttachedCount);
+        
+    FNotificationInfo Info(FText::FromString(NotificationText));
+    Info.ExpireDuration = 5.0f;
+    Info.bUseSuccessFailIcons = true;
+    
+    TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+    if (NotificationItem.IsValid())
+        NotificationItem->SetCompletionState(SNotificationItem::CS_Success);
     
-    if (FirstActor)
+    // 피벗 액터 선택
+    GEditor->SelectNone(false, true);
+    GEditor->SelectActor(PivotActor, true, true);
+    
+    return true;
+#else
+    return false;
+#endif
+}
+
+int32 FTreeViewUtils::MovePivotAndReparent(AActor* PivotActor, const TArray<AStaticMeshActor*>& MeshActors, const FVector& PivotLocation)
+{
+    if (!PivotActor)
+        return 0;
+    
+    PivotActor->Modify();
+    
+    // 루트 컴포넌트가 없으면 정적 씬 컴포넌트 생성
+    USceneComponent* PivotRoot = PivotActor->GetRootComponent();
+    if (!PivotRoot)
     {
-        OriginalLabel = FirstActor->GetActorLabel();
-        OriginalTags = FirstActor->Tags;
+        PivotRoot = NewObject<USceneComponent>(PivotActor, TEXT("Root"), RF_Transactional);
+        PivotRoot->SetMobility(EComponentMobility::Static);
+        PivotActor->SetRootComponent(PivotRoot);
+        PivotActor->AddInstanceComponent(PivotRoot);
+        PivotRoot->RegisterComponent();
     }
+    PivotRoot->Modify();
     
-    // 새 액터 생성
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Name = *FString::Printf(TEXT("MeshCenter_%d"), FMath::RandRange(0, 9999));
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    FTransform NewPivotTransform = PivotRoot->GetComponentTransform();
+    NewPivotTransform.SetLocation(PivotLocation);
     
-    AActor* NewActor = EditorWorld->SpawnActor<AActor>(AActor::StaticClass(), FTransform(AveragePosition), SpawnParams);
+    // 상대 변환만 기록 (변환 전파 없음)
+    auto SetRelativeDirect = [](USceneComponent* Component, const FTransform& Relative)
+    {
+        Component->SetRelativeLocation_Direct(Relative.GetLocation());
+        Component->SetRelativeRotation_Direct(Relative.Rotator());
+        Component->SetRelativeScale3D_Direct(Relative.GetScale3D());
+    };
     
-    if (NewActor)
+    // 1단계: 이동 전 월드 변환 기준으로 새 상대 변환을 한 번에 계산
+    TSet<USceneComponent*> MeshRoots;
+    TArray<USceneComponent*> ComponentsToAttach;
+    for (AStaticMeshActor* MeshActor : MeshActors)
     {
-        // 스태틱 루트 컴포넌트 생성
-        UStaticMeshComponent* RootComp = NewObject<UStaticMeshComponent>(NewActor, UStaticMeshComponent::StaticClass(), TEXT("RootComp"));
-        if (RootComp)
-        {
-            RootComp->RegisterComponent();
-            NewActor->SetRootComponent(RootComp);
-            RootComp->SetWorldLocation(AveragePosition);
-            RootComp->SetMobility(EComponentMobility::Static);
-            RootComp->SetVisibility(false);
-            RootComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-        }
+        USceneComponent* MeshRoot = MeshActor ? MeshActor->GetRootComponent() : nullptr;
+        if (!MeshRoot || MeshActor == PivotActor)
+            continue;
         
-        // StaticMeshActor들을 새 부모에 연결
-        int32 AttachedCount = 0;
-        for (AStaticMeshActor* MeshActor : StaticMeshActors)
-        {
-            if (!MeshActor) continue;
-            
-            MeshActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
-            MeshActor->AttachToActor(NewActor, FAttachmentTransformRules::KeepWorldTransform);
-            
-            if (MeshActor->GetAttachParentActor() == NewActor)
-                AttachedCount++;
-        }
+        bool bAlreadyAdded = false;
+        MeshRoots.Add(MeshRoot, &bAlreadyAdded);
+        if (bAlreadyAdded)
+            continue;
+        
+        MeshRoot->Modify();
+        SetRelativeDirect(MeshRoot, MeshRoot->GetComponentTransform().GetRelativeTransform(NewPivotTransform));
         
-        // 원본 액터 삭제 및 태그 복사
-        if (FirstActor && AttachedCount > 0)
+        if (MeshRoot->GetAttachParent() != PivotRoot)
         {
-            // 태그 복사
-            for (const FName& Tag : OriginalTags)
-                NewActor->Tags.Add(Tag);
-            
-            // 라벨 설정
-            NewActor->SetActorLabel(*OriginalLabel);
-            
-            // ImportedNodeManager에 등록 정보 업데이트
-            bool bWasImported = FirstActor->ActorHasTag(FImportedNodeManager::ImportedTag);
-            
-            if (bWasImported)
-            {
-                // 파트 번호 추출 - "ImportedPart_파트번호" 형식의 태그를 찾음
-                FString PartNo;
-                for (const FName& Tag : OriginalTags)
-                {
-                    FString TagStr = Tag.ToString();
-                    if (TagStr.StartsWith(TEXT("ImportedPart_")))
-                    {
-                        // 접두사 제거하여 파트 번호 추출
-                        PartNo = TagStr.RightChop(13); // "ImportedPart_" 길이는 13
-                        break;
-                    }
-                }
-                
-                // 파트 번호가 확인되면 매니저에 새 액터 등록
-                if (!PartNo.IsEmpty())
-                {
-                    // 원본 매핑 제거 후 새 액터 등록
-                    FImportedNodeManager::Get().RemoveImportedNode(PartNo);
-                    FImportedNodeManager::Get().RegisterImportedNode(PartNo, NewActor);
-                }
-            }
-            
-            // 원본 액터 제거
-            FirstActor->Destroy();
+            ComponentsToAttach.Add(MeshRoot);
         }
-        else
+    }
+    
+    // 피벗에 직접 붙어 있는 다른 컴포넌트도 월드 위치 유지
+    for (USceneComponent* Child : PivotRoot->GetAttachChildren())
+    {
+        if (Child && !MeshRoots.Contains(Child))
         {
-            NewActor->SetActorLabel(TEXT("MeshCenter"));
+            Child->Modify();
+            SetRelativeDirect(Child, Child->GetComponentTransform().GetRelativeTransform(NewPivotTransform));
         }
-        
-        // 알림 표시
-        FString NotificationText = FString::Printf(
-            TEXT("메시 중심에 '%s' 액터가 생성되었습니다. %d개의 StaticMeshActor가 연결되었습니다."),
-            *NewActor->GetActorLabel(), AttachedCount);
-            
-        FNotificationInfo Info(FText::FromString(NotificationText));
-        Info.ExpireDuration = 5.0f;
-        Info.bUseSuccessFailIcons = true;
-        
-        TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
-        if (NotificationItem.IsValid())
-            NotificationItem->SetCompletionState(SNotificationItem::CS_Success);
-        
-        // 생성된 액터 선택
-        GEditor->SelectNone(false, true);
-        GEditor->SelectActor(NewActor, true, true);
     }
     
-    GEditor->EndTransaction();
-    return NewActor != nullptr;
-#else
-    return false;
-#endif
+    // 2단계: 피벗 이동 (직접 자식은 이 한 번의 전파로 월드 변환 갱신)
+    PivotRoot->SetWorldLocation(PivotLocation);
+    
+    // 3단계: 다른 부모 아래 있던 메시 액터만 연결 (상대 변환은 이미 계산됨)
+    for (USceneComponent* MeshRoot : ComponentsToAttach)
+    {
+        MeshRoot->AttachToComponent(PivotRoot, FAttachmentTransformRules::KeepRelativeTransform);
+    }
+    
+    // 4단계: 변경 알림은 피벗 액터에 한 번만
+    PivotActor->PostEditChange();
+    
+    UE_LOG(LogTemp, Display, TEXT("피벗 이동 및 일괄 연결 완료: %s (메시 액터 %d개, 재연결 %d개)"), 
+           *PivotActor->GetActorLabel(), MeshRoots.Num(), ComponentsToAttach.Num());
+    
+    return MeshRoots.Num();
 }
 
 int32 FTreeViewUtils::ImportXMLToSelectedNodes(
@@ -748,23 +1206,19 @@ int32 FTreeViewUtils::ImportXMLToSelectedNodes(
     FImportSettings ImportSettings = UImportSettingsManager::Get()->GetSettings();
 
     // 언리얼 프로젝트 루트 디렉토리에 있는 3DXML 폴더 경로 설정 
-    FString XMLDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("3DXML"));
+    FString XMLDir = FPartFileIndex::GetDefaultCADDirectory();
     
-    int32 SuccessCount = 0;
-    int32 FailCount = 0;
-    int32 AlreadyImportedCount = 0;
+#if WITH_EDITOR
+    // 배치 스케줄러 구성 - 파일 매칭은 먼저 모두 끝내고 임포트는 한 번에 실행
+    FBatchImportScheduler Scheduler(ImportSettings);
     TArray<FString> FailedParts;
-    TArray<FString> ImportedParts;
-    TArray<FString> AlreadyImportedParts;
     
-    // 전체 항목 수 저장
-    int32 TotalItems = SelectedItems.Num();
-    
-    // 선택된 모든 항목에 대해 처리
-    for (int32 ItemIndex = 0; ItemIndex < SelectedItems.Num(); ItemIndex++)
+    for (const TSharedPtr<FPartTreeItem>& SelectedItem : SelectedItems)
     {
-        TSharedPtr<FPartTreeItem> SelectedItem = SelectedItems[ItemIndex];
-        FString PartNo = SelectedItem->PartNo;
+        if (!SelectedItem.IsValid())
+            continue;
+        
+        const FString& PartNo = SelectedItem->PartNo;
         
         // 일치하는 파일 찾기
         FFileMatchResult FileResult = FindMatchingFileForPartNo(
@@ -776,61 +1230,45 @@ int32 FTreeViewUtils::ImportXMLToSelectedNodes(
         // 파일을 찾지 못한 경우 다음 항목으로 넘어감
         if (!FileResult.bFound)
         {
-            FailCount++;
             FailedParts.Add(PartNo);
             UE_LOG(LogTemp, Warning, TEXT("파일을 찾을 수 없음: %s - %s"), *PartNo, *FileResult.ErrorMessage);
             continue;
         }
-
-#if WITH_EDITOR
-        // DatasmithSceneManager를 사용하여 임포트 및 처리
-        FDatasmithSceneManager SceneManager;
-        
-        // ImportSettings 적용
-        SceneManager.SetImportSettings(ImportSettings);
-
-        // 이미 임포트된 노드인지 확인
-        if (SceneManager.IsAlreadyImportedInLevel(PartNo))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("이미 임포트된 액터가 있음: %s"), *PartNo);
-            AlreadyImportedCount++;
-            AlreadyImportedParts.Add(PartNo);
-            continue; // 이미 임포트된 경우 건너뛰기
-        }
-        
-        // 현재 인덱스(1부터 시작)와 전체 갯수를 전달하여 진행 상황 표시
-        AActor* ResultActor = SceneManager.ImportAndProcessDatasmith(
-            FileResult.FilePath,     // 임포트할 파일 경로
-            PartNo,                  // 파트 번호
-            ItemIndex + 1,           // 현재 처리 중인 인덱스(1부터 시작)
-            TotalItems               // 전체 항목 수
-        );
         
-        if (ResultActor)
-        {
-            SuccessCount++;
-            ImportedParts.Add(PartNo);
-            
-            // 설정에 따라 마지막으로 처리된 액터 선택
-            if (ImportSettings.bSelectActorAfterImport && SelectedItem == SelectedItems.Last())
-            {
-                GEditor->SelectNone(true, true, false);
-                GEditor->SelectActor(ResultActor, true, true, true);
-            }
-        }
-        else
-        {
-            FailCount++;
-            FailedParts.Add(PartNo);
-        }
-#else
-        // 에디터가 아닌 환경에서는 임포트 불가
-        FNotificationInfo Info(FText::FromString(TEXT("3DXML 파일 임포트는 에디터 모드에서만 가능합니다.")));
+        Scheduler.AddJob(PartNo, FileResult.FilePath);
+    }
+    
+    // 배치 실행 (단일 진행 대화상자, 취소 가능)
+    FBatchImportResult BatchResult = Scheduler.Run();
+    FailedParts.Append(BatchResult.FailedParts);
+    
+    const TArray<FString>& AlreadyImportedParts = BatchResult.AlreadyImportedParts;
+    int32 SuccessCount = BatchResult.ImportedParts.Num();
+    int32 FailCount = FailedParts.Num();
+    int32 AlreadyImportedCount = AlreadyImportedParts.Num();
+    
+    // 설정에 따라 마지막으로 처리된 액터 선택
+    if (ImportSettings.bSelectActorAfterImport && BatchResult.LastImportedActor.IsValid())
+    {
+        GEditor->SelectNone(true, true, false);
+        GEditor->SelectActor(BatchResult.LastImportedActor.Get(), true, true, true);
+    }
+    
+    // 취소된 경우 알림
+    if (BatchResult.bCancelled)
+    {
+        FNotificationInfo Info(FText::FromString(FString::Printf(
+            TEXT("3DXML 임포트가 취소되었습니다. 미처리 %d개"), BatchResult.CancelledParts.Num())));
         Info.ExpireDuration = 4.0f;
         FSlateNotificationManager::Get().AddNotification(Info);
-        return 0;
-#endif
     }
+#else
+    // 에디터가 아닌 환경에서는 임포트 불가
+    FNotificationInfo Info(FText::FromString(TEXT("3DXML 파일 임포트는 에디터 모드에서만 가능합니다.")));
+    Info.ExpireDuration = 4.0f;
+    FSlateNotificationManager::Get().AddNotification(Info);
+    return 0;
+#endif
     
     // 이미 임포트된 노드가 있는 경우 알림
     if (AlreadyImportedCount > 0)
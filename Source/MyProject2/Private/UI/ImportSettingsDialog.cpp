@@ -22,8 +22,14 @@ void SImportSettingsDialog::Construct(const FArguments& InArgs)
     MaterialUpdateOptions.Add(MakeShareable(new FString(TEXT("Keep existing"))));
     MaterialUpdateOptions.Add(MakeShareable(new FString(TEXT("Always create new"))));
 
+    // 품질 단계 옵션 초기화
+    QualityTierOptions.Add(MakeShareable(new FString(TEXT("Preview"))));
+    QualityTierOptions.Add(MakeShareable(new FString(TEXT("Standard"))));
+    QualityTierOptions.Add(MakeShareable(new FString(TEXT("High"))));
+    CurrentSettings.QualityTier = FMath::Clamp(CurrentSettings.QualityTier, 0, QualityTierOptions.Num() - 1);
+
     // 체크박스 위젯 배열 초기화
-    CheckboxWidgets.SetNum(3); // 4개의 체크박스 위젯을 위한 공간 확보
+    CheckboxWidgets.SetNum(7); // 7개의 체크박스 위젯을 위한 공간 확보
 
     ChildSlot
     [
@@ -113,6 +119,90 @@ void SImportSettingsDialog::Construct(const FArguments& InArgs)
                 ]
             ]
 
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0, 5)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .FillWidth(1.0f)
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString(TEXT("반복 메쉬 인스턴스 통합")))
+                    .ToolTipText(FText::FromString(TEXT("같은 메쉬/재질의 반복 파트를 인스턴스로 묶어 액터 수와 드로우콜을 줄입니다")))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SAssignNew(CheckboxWidgets[3], SCheckBox)
+                    .IsChecked(CurrentSettings.bConsolidateInstancedMeshes ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+                    .OnCheckStateChanged(this, &SImportSettingsDialog::OnCheckboxStateChanged, FName("bConsolidateInstancedMeshes"))
+                ]
+            ]
+
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0, 5)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .FillWidth(1.0f)
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString(TEXT("배치 완료 후 에셋 일괄 저장")))
+                    .ToolTipText(FText::FromString(TEXT("파트마다 저장하지 않고 배치가 끝날 때 변경된 패키지를 한 번에 저장합니다")))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SAssignNew(CheckboxWidgets[4], SCheckBox)
+                    .IsChecked(CurrentSettings.bDeferAssetSaving ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+                    .OnCheckStateChanged(this, &SImportSettingsDialog::OnCheckboxStateChanged, FName("bDeferAssetSaving"))
+                ]
+            ]
+
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0, 5)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .FillWidth(1.0f)
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString(TEXT("에셋 저장 안 함 (검토용)")))
+                    .ToolTipText(FText::FromString(TEXT("임포트한 에셋을 디스크에 저장하지 않습니다. 임포트 결과 캐시도 기록되지 않습니다")))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SAssignNew(CheckboxWidgets[5], SCheckBox)
+                    .IsChecked(CurrentSettings.bSkipAssetSaving ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+                    .OnCheckStateChanged(this, &SImportSettingsDialog::OnCheckboxStateChanged, FName("bSkipAssetSaving"))
+                ]
+            ]
+
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0, 5)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .FillWidth(1.0f)
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString(TEXT("어셈블리별 서브레벨로 임포트")))
+                    .ToolTipText(FText::FromString(TEXT("상위 어셈블리마다 스트리밍 서브레벨을 만들어 배치합니다. 트리뷰의 어셈블리 체크박스로 로드/언로드할 수 있습니다")))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SAssignNew(CheckboxWidgets[6], SCheckBox)
+                    .IsChecked(CurrentSettings.bStreamAssembliesToSubLevels ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+                    .OnCheckStateChanged(this, &SImportSettingsDialog::OnCheckboxStateChanged, FName("bStreamAssembliesToSubLevels"))
+                ]
+            ]
+
             + SVerticalBox::Slot()
             .AutoHeight()
             .Padding(0, 10, 0, 5)
@@ -149,6 +239,44 @@ void SImportSettingsDialog::Construct(const FArguments& InArgs)
                     ]
                 ]
             ]
+
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(0, 5)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .FillWidth(1.0f)
+                [
+                    SNew(STextBlock)
+                    .Text(FText::FromString(TEXT("Quality tier")))
+                    .ToolTipText(FText::FromString(TEXT("Preview: 거친 테셀레이션, 라이트맵 UV 없음, 단순 재질 (빠른 배치 검토용)\nStandard: Datasmith 기본 테셀레이션\nHigh: 정밀 테셀레이션, 고해상도 라이트맵")))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .HAlign(HAlign_Right)
+                .VAlign(VAlign_Center)
+                [
+                    SAssignNew(QualityTierComboBox, SComboBox<TSharedPtr<FString>>)
+                    .OptionsSource(&QualityTierOptions)
+                    .InitiallySelectedItem(QualityTierOptions[CurrentSettings.QualityTier])
+                    .OnSelectionChanged(this, &SImportSettingsDialog::OnComboBoxSelectionChanged, FName("QualityTier"))
+                    .OnGenerateWidget_Lambda([](TSharedPtr<FString> Item) {
+                        return SNew(STextBlock).Text(FText::FromString(*Item.Get()));
+                    })
+                    [
+                        SNew(STextBlock)
+                        .Text_Lambda([this]() {
+                            if (CurrentSettings.QualityTier >= 0 && 
+                                CurrentSettings.QualityTier < QualityTierOptions.Num())
+                            {
+                                return FText::FromString(*QualityTierOptions[CurrentSettings.QualityTier].Get());
+                            }
+                            return FText::FromString(TEXT("Standard"));
+                        })
+                    ]
+                ]
+            ]
             
             // 두 번째 구분선 추가
             + SVerticalBox::Slot()
@@ -240,6 +368,10 @@ FReply SImportSettingsDialog::OnResetToDefaultsClicked()
                 case 0: bIsChecked = CurrentSettings.bRemoveTransparentMeshes; break;
                 case 1: bIsChecked = CurrentSettings.bCleanupNonStaticMeshActors; break;
                 case 2: bIsChecked = CurrentSettings.bSelectActorAfterImport; break;
+                case 3: bIsChecked = CurrentSettings.bConsolidateInstancedMeshes; break;
+                case 4: bIsChecked = CurrentSettings.bDeferAssetSaving; break;
+                case 5: bIsChecked = CurrentSettings.bSkipAssetSaving; break;
+                case 6: bIsChecked = CurrentSettings.bStreamAssembliesToSubLevels; break;
             }
             
             // 체크박스 상태 갱신
@@ -252,6 +384,10 @@ FReply SImportSettingsDialog::OnResetToDefaultsClicked()
     {
         MaterialPolicyComboBox.Pin()->SetSelectedItem(MaterialUpdateOptions[CurrentSettings.MaterialUpdatePolicy]);
     }
+    if (QualityTierComboBox.IsValid())
+    {
+        QualityTierComboBox.Pin()->SetSelectedItem(QualityTierOptions[CurrentSettings.QualityTier]);
+    }
     
     return FReply::Handled();
 }
@@ -273,6 +409,22 @@ void SImportSettingsDialog::OnCheckboxStateChanged(ECheckBoxState NewState, FNam
     {
         CurrentSettings.bSelectActorAfterImport = bChecked;
     }
+    else if (PropertyName == "bConsolidateInstancedMeshes")
+    {
+        CurrentSettings.bConsolidateInstancedMeshes = bChecked;
+    }
+    else if (PropertyName == "bDeferAssetSaving")
+    {
+        CurrentSettings.bDeferAssetSaving = bChecked;
+    }
+    else if (PropertyName == "bSkipAssetSaving")
+    {
+        CurrentSettings.bSkipAssetSaving = bChecked;
+    }
+    else if (PropertyName == "bStreamAssembliesToSubLevels")
+    {
+        CurrentSettings.bStreamAssembliesToSubLevels = bChecked;
+    }
 }
 
 void SImportSettingsDialog::OnComboBoxSelectionChanged(TSharedPtr<FString> NewSelection, ESelectInfo::Type SelectInfo, FName PropertyName)
@@ -289,6 +441,17 @@ void SImportSettingsDialog::OnComboBoxSelectionChanged(TSharedPtr<FString> NewSe
             }
         }
     }
+    else if (PropertyName == "QualityTier")
+    {
+        for (int32 i = 0; i < QualityTierOptions.Num(); ++i)
+        {
+            if (QualityTierOptions[i] == NewSelection)
+            {
+                CurrentSettings.QualityTier = i;
+                break;
+            }
+        }
+    }
 }
 
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
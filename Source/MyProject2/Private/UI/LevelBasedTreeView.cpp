@@ -2,18 +2,33 @@
 
 #include "UI/LevelBasedTreeView.h"
 
+#include "AssemblyProxyManager.h"
+#include "AssemblyStreamingManager.h"
 #include "AssetViewUtils.h"
 #include "AssetToolsModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "BomDiff.h"
 #include "DatasmithSceneManager.h"
+#include "DesktopPlatformModule.h"
 #include "Dialogs/Dialogs.h"
+#include "DirectoryWatcherModule.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "IDesktopPlatform.h"
+#include "IDirectoryWatcher.h"
 #include "ImportedNodeManager.h"
+#include "LazyGeometryManager.h"
 #include "ObjectTools.h"
+#include "PartBoundsHierarchy.h"
+#include "PartInstancedMeshComponent.h"
+#include "PartFileIndex.h"
 #include "ServiceLocator.h"
 #include "SlateOptMacros.h"
 #include "UI/ImportSettingsDialog.h"
+#include "UI/PartFuzzyFinder.h"
 #include "UI/PartMetadataWidget.h"
+#include "TreeViewStateStore.h"
 #include "TreeViewUtils.h"
 #include "Widgets/Views/SHeaderRow.h"
 #include "Widgets/Views/STableRow.h"
@@ -25,7 +40,6 @@
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
 #include "Engine/Selection.h"
-#include "EngineUtils.h"
 #endif
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -60,6 +74,7 @@ void SLevelBasedTreeView::Construct(const FArguments& InArgs)
 	bIsSearching = false;  // 검색 상태 초기화
 	SearchText = "";       // 검색어 초기화
 	bShowFilterPanel = false; // 필터 패널 초기 상태 숨김
+	CachedSelectedMetadata = FText::FromString("No item selected"); // 선택 캐시 초기화
 
 	// 필터 관리자 초기화
 	FilterManager = MakeShared<FPartTreeViewFilterManager>();
@@ -70,14 +85,14 @@ void SLevelBasedTreeView::Construct(const FArguments& InArgs)
     // 위젯 구성
     ChildSlot
     [
-        SAssignNew(TreeView, STreeView<TSharedPtr<FPartTreeItem>>)
+        SAssignNew(TreeView, SListView<TSharedPtr<FPartTreeItem>>)
             .ItemHeight(24.0f)
-            .TreeItemsSource(&AllRootItems)
+            .ListItemsSource(&VisibleRows)
             .OnGenerateRow(this, &SLevelBasedTreeView::OnGenerateRow)
-            .OnGetChildren(this, &SLevelBasedTreeView::OnGetChildren)
             .OnSelectionChanged(this, &SLevelBasedTreeView::OnSelectionChanged)
             .OnContextMenuOpening(this, &SLevelBasedTreeView::OnContextMenuOpening)
             .OnMouseButtonDoubleClick(this, &SLevelBasedTreeView::OnTreeItemDoubleClick)
+            .OnKeyDownHandler(this, &SLevelBasedTreeView::OnTreeKeyDown)
             .HeaderRow
             (
                 SNew(SHeaderRow)
@@ -91,9 +106,21 @@ void SLevelBasedTreeView::Construct(const FArguments& InArgs)
     if (!InArgs._ExcelFilePath.IsEmpty())
     {
         BuildTreeView(InArgs._ExcelFilePath);
+        
+        // 같은 BOM으로 마지막에 보던 상태 복원
+        RestoreTreeState();
+        
+        // 파일이 교체되면 탭을 다시 열지 않아도 증분 갱신
+        StartWatchingBomFile();
     }
 }
 
+SLevelBasedTreeView::~SLevelBasedTreeView()
+{
+    SaveTreeState();
+    StopWatchingBomFile();
+}
+
 // 액터 선택 함수
 AActor* SLevelBasedTreeView::SelectActorByPartNo(const FString& PartNo)
 {
@@ -115,55 +142,30 @@ AActor* SLevelBasedTreeView::SelectActorByPartNo(const FString& PartNo)
             return FoundActor;
         }
         
-        // 2. 월드의 모든 액터에서 태그로 검색
-        if (UWorld* EditorWorld = GEditor->GetEditorWorldContext().World())
+        // 1-1. 인스턴스로 통합된 파트이면 소유 액터와 해당 인스턴스 선택
+        UPartInstancedMeshComponent* InstancedComp = nullptr;
+        int32 InstanceIndex = INDEX_NONE;
+        if (FImportedNodeManager::Get().FindImportedInstance(PartNo, InstancedComp, InstanceIndex))
         {
-            // ImportedPart_[PartNo] 태그 생성
-            FName PartTag = FName(*FString::Printf(TEXT("ImportedPart_%s"), *PartNo));
-            
-            // 모든 액터 순회하며 태그 검색
-            for (TActorIterator<AActor> ActorItr(EditorWorld); ActorItr; ++ActorItr)
-            {
-                AActor* CurrentActor = *ActorItr;
-                if (CurrentActor && CurrentActor->ActorHasTag(PartTag))
-                {
-                    // 태그가 일치하는 액터 선택
-                    GEditor->SelectActor(CurrentActor, true, true, true);
-                    FoundActor = CurrentActor;
-                    UE_LOG(LogTemp, Display, TEXT("태그로 액터 찾음: %s"), *CurrentActor->GetName());
-                    break; // 첫 번째 일치 액터만 선택
-                }
-            }
-            
-            // 3. 태그에서도 찾지 못했으면 이름으로 검색
-            if (!FoundActor)
-            {
-                for (TActorIterator<AActor> ActorItr(EditorWorld); ActorItr; ++ActorItr)
-                {
-                    AActor* CurrentActor = *ActorItr;
-                    if (CurrentActor)
-                    {
-                        // 액터 이름과 PartNo 비교
-                        FString ActorName = CurrentActor->GetName();
-                        
-                        // 정확히 일치하거나 부분 문자열로 포함되는지 검사
-                        if (ActorName.Equals(PartNo, ESearchCase::IgnoreCase) || 
-                            ActorName.Contains(PartNo, ESearchCase::IgnoreCase))
-                        {
-                            // 액터 선택
-                            GEditor->SelectActor(CurrentActor, true, true, true);
-                            FoundActor = CurrentActor;
-                            UE_LOG(LogTemp, Display, TEXT("이름으로 액터 찾음: %s"), *CurrentActor->GetName());
-                            break; // 첫 번째 일치 액터만 선택
-                        }
-                    }
-                }
-            }
-            
-            if (!FoundActor)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("일치하는 액터를 찾을 수 없음: %s"), *PartNo);
-            }
+            AActor* OwnerActor = InstancedComp->GetOwner();
+            GEditor->SelectActor(OwnerActor, true, true, true);
+            InstancedComp->SelectInstance(true, InstanceIndex);
+            UE_LOG(LogTemp, Display, TEXT("인스턴스로 통합된 파트 찾음: %s (%s, 인스턴스 %d)"), 
+                   *PartNo, *InstancedComp->GetName(), InstanceIndex);
+            FoundActor = OwnerActor;
+            return FoundActor;
+        }
+        
+        // 2. 임포트 태그가 없는 액터는 라벨로 조회 (인덱스 조회, 월드 검색 없음)
+        if (AActor* LabeledActor = FImportedNodeManager::Get().FindActorByLabel(PartNo))
+        {
+            GEditor->SelectActor(LabeledActor, true, true, true);
+            FoundActor = LabeledActor;
+            UE_LOG(LogTemp, Display, TEXT("라벨로 액터 찾음: %s"), *LabeledActor->GetName());
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("일치하는 액터를 찾을 수 없음: %s"), *PartNo);
         }
     }
 #endif
@@ -221,6 +223,20 @@ TSharedRef<SWidget> SLevelBasedTreeView::GetSearchWidget()
 		]
 	];
     
+	// CAD 파일 필터 체크박스 추가
+	FilterPanel->AddSlot()
+	.AutoHeight()
+	.Padding(4, 2, 0, 2)
+	[
+		SAssignNew(CADFileFilterCheckbox, SCheckBox)
+		.IsChecked(FilterManager->IsFilterEnabled("CADFileFilter") ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+		.OnCheckStateChanged(this, &SLevelBasedTreeView::OnCADFileFilterCheckedChanged)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(TEXT("Show Only Nodes with CAD Files")))
+		]
+	];
+    
     // 필터 초기화 버튼 추가
     /*FilterPanel->AddSlot()
     .AutoHeight()
@@ -290,6 +306,7 @@ TSharedRef<SWidget> SLevelBasedTreeView::GetSearchWidget()
               .FillWidth(1.0f)
               [
                   SNew(SSearchBox)
+                  .InitialText(FText::FromString(SearchText))
                   .HintText(FText::FromString("Enter text to search..."))
                   .OnTextChanged(this, &SLevelBasedTreeView::OnSearchTextChanged)
                   .OnTextCommitted(this, &SLevelBasedTreeView::OnSearchTextCommitted)
@@ -363,15 +380,16 @@ void SLevelBasedTreeView::OnSearchTextChanged(const FText& InText)
     {
         // 검색어가 비었으면 검색 중지
         bIsSearching = false;
+        SearchPathItems.Empty();
         
-        // 모든 필터 해제 및 트리뷰 갱신
+        // 모든 필터 해제 및 바뀐 하위 트리만 갱신
     	if (FilterManager->IsFilterEnabled("ImageFilter"))
         {
             ToggleImageFiltering(false);
         }
         else
         {
-            TreeView->RequestTreeRefresh();
+            RefreshVisibleRows(AllRootItems);
         }
     }
     else
@@ -385,7 +403,7 @@ void SLevelBasedTreeView::OnSearchTextChanged(const FText& InText)
 }
 
 // 검색 실행 함수
-void SLevelBasedTreeView::PerformSearch(const FString& InSearchText)
+void SLevelBasedTreeView::PerformSearch(const FString& InSearchText, bool bSelectFirstResult)
 {
     // 검색 결과 초기화
     SearchResults.Empty();
@@ -406,8 +424,11 @@ void SLevelBasedTreeView::PerformSearch(const FString& InSearchText)
     
     UE_LOG(LogTemp, Display, TEXT("검색 결과: %d개 항목 발견"), SearchResults.Num());
     
+    // 검색 결과까지의 경로를 한 번만 계산 (자식 표시 판정에 사용)
+    RebuildSearchPaths();
+    
     // 트리가 접혀있고 검색 결과가 있는 경우에만 경로 펼치기 실행
-    if (SearchResults.Num() > 0 && TreeView.IsValid())
+    if (bSelectFirstResult && SearchResults.Num() > 0 && TreeView.IsValid())
     {
         // 검색 결과가 있으면 잠시 지연 후 결과로 경로 펼치기
         GEditor->GetTimerManager()->SetTimer(
@@ -426,8 +447,8 @@ void SLevelBasedTreeView::PerformSearch(const FString& InSearchText)
         );
     }
     
-    // 트리뷰 갱신 (필터링 적용)
-    TreeView->RequestTreeRefresh();
+    // 검색 결과가 바뀐 하위 트리만 보이는 행에 반영
+    RefreshVisibleRows(AllRootItems);
 }
 
 // 설정 핸들러
@@ -489,11 +510,8 @@ FReply SLevelBasedTreeView::OnResetFiltersClicked()
             ImageFilterCheckbox->SetIsChecked(ECheckBoxState::Unchecked);
         }
         
-        // 트리뷰 갱신
-        if (TreeView.IsValid())
-        {
-            TreeView->RequestTreeRefresh();
-        }
+        // 바뀐 하위 트리만 갱신
+        RefreshVisibleRows(AllRootItems);
         
         UE_LOG(LogTemp, Display, TEXT("모든 필터가 초기화되었습니다."));
     }
@@ -519,38 +537,12 @@ void SLevelBasedTreeView::FoldLevelZeroItems()
         return;
     }
 
-    int32 FoldedItemCount = 0;
-    
-    // 최상위 레벨 0 항목 접기
-    if (LevelToItemsMap.Contains(0))
-    {
-        const TArray<TSharedPtr<FPartTreeItem>>& Level0Items = LevelToItemsMap[0];
-        for (const auto& Level0Item : Level0Items)
-        {
-            // 최상위 레벨 0 항목만 접기
-            TreeView->SetItemExpansion(Level0Item, false);
-            FoldedItemCount++;
-        }
-        
-        UE_LOG(LogTemp, Display, TEXT("레벨 0 항목 접기 완료: %d개 항목"), FoldedItemCount);
-    }
-    else
-    {
-        // LevelToItemsMap에 레벨 0 항목이 없으면 루트 항목 접기
-        for (auto& RootItem : AllRootItems)
-        {
-            TreeView->SetItemExpansion(RootItem, false);
-            FoldedItemCount++;
-        }
-        
-        UE_LOG(LogTemp, Display, TEXT("루트 항목 접기 완료: %d개 항목"), FoldedItemCount);
-    }
+    // 최상위 레벨 0 항목 접기 (레벨 0 항목이 없으면 루트 항목), 보이는 행은 한 번만 재구성
+    const TArray<TSharedPtr<FPartTreeItem>>* Level0Items = LevelToItemsMap.Find(0);
+    const TArray<TSharedPtr<FPartTreeItem>>& ItemsToFold = Level0Items ? *Level0Items : AllRootItems;
+    SetItemsExpansion(ItemsToFold, false);
     
-    // 트리뷰 갱신
-    if (FoldedItemCount > 0)
-    {
-        TreeView->RequestTreeRefresh();
-    }
+    UE_LOG(LogTemp, Display, TEXT("%s 항목 접기 완료: %d개 항목"), Level0Items ? TEXT("레벨 0") : TEXT("루트"), ItemsToFold.Num());
 }
 
 // 임포트된 노드 필터 체크박스 변경 이벤트 핸들러
@@ -575,6 +567,17 @@ void SLevelBasedTreeView::OnDuplicateFilterCheckedChanged(ECheckBoxState NewStat
 		bEnable ? TEXT("활성화") : TEXT("비활성화"));
 }
 
+// CAD 파일 필터 체크박스 변경 이벤트 핸들러
+void SLevelBasedTreeView::OnCADFileFilterCheckedChanged(ECheckBoxState NewState)
+{
+	// 체크박스 상태에 따라 CAD 파일 필터 활성화/비활성화
+	bool bEnable = (NewState == ECheckBoxState::Checked);
+	ToggleCADFileFiltering(bEnable);
+    
+	UE_LOG(LogTemp, Display, TEXT("CAD 파일 필터 %s: 체크박스 변경 이벤트"), 
+		bEnable ? TEXT("활성화") : TEXT("비활성화"));
+}
+
 // 검색 텍스트 확정 이벤트 핸들러
 void SLevelBasedTreeView::OnSearchTextCommitted(const FText& InText, ETextCommit::Type CommitType)
 {
@@ -592,11 +595,80 @@ void SLevelBasedTreeView::OnSearchTextCommitted(const FText& InText, ETextCommit
 // 항목 선택 변경 이벤트 핸들러
 void SLevelBasedTreeView::OnSelectionChanged(TSharedPtr<FPartTreeItem> Item, ESelectInfo::Type SelectInfo)
 {
-    // 선택 변경 시 메타데이터 위젯에 선택 항목 전달
-    if (Item.IsValid() && MetadataWidget.IsValid())
+    // 선택 변경 시 메타데이터 캐시 갱신
+    UpdateSelectionCache(Item);
+    
+    // 지연 형상 노드는 선택 시 임포트 요청 (상태 복원으로 선택된 경우 제외)
+    if (Item.IsValid() && !bRestoringTreeState)
     {
-        MetadataWidget->SetSelectedItem(Item);
+        FLazyGeometryManager::Get().RequestLoad(Item->PartNo);
+    }
+    
+    // 선택 변경 시 메타데이터 위젯에 전체 선택 목록 전달 (방금 선택된 항목을 첫 번째로)
+    if (MetadataWidget.IsValid() && TreeView.IsValid())
+    {
+        TArray<TSharedPtr<FPartTreeItem>> SelectedItems = TreeView->GetSelectedItems();
+        if (Item.IsValid() && SelectedItems.Num() > 1)
+        {
+            SelectedItems.Remove(Item);
+            SelectedItems.Insert(Item, 0);
+        }
+        
+        // 선택이 모두 해제된 경우도 전달하여 선택 요약을 초기화
+        MetadataWidget->SetSelectedItems(SelectedItems);
+    }
+}
+
+// 트리뷰 항목 펼침/접힘 이벤트 핸들러
+void SLevelBasedTreeView::OnItemExpansionChanged(TSharedPtr<FPartTreeItem> Item, bool bExpanded)
+{
+    // 펼친 노드와 직접 자식의 지연 형상 임포트 요청
+    if (bExpanded && !bRestoringTreeState && FLazyGeometryManager::Get().HasRegisteredParts())
+    {
+        FLazyGeometryManager::Get().RequestLoadExpanded(Item);
+    }
+}
+
+// 어셈블리 서브레벨 체크박스 상태
+ECheckBoxState SLevelBasedTreeView::GetCellCheckState(TSharedPtr<FPartTreeItem> Item) const
+{
+    return Item.IsValid() && FAssemblyStreamingManager::Get().IsCellLoaded(Item->PartNo)
+        ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+// 어셈블리 서브레벨 체크박스 변경: 체크하면 로드, 해제하면 저장 후 언로드
+void SLevelBasedTreeView::OnCellCheckStateChanged(ECheckBoxState NewState, TSharedPtr<FPartTreeItem> Item)
+{
+    if (!Item.IsValid())
+        return;
+    
+    if (FAssemblyStreamingManager::Get().SetCellLoaded(Item->PartNo, NewState == ECheckBoxState::Checked))
+    {
+        // 임포트 표시 색상이 바뀌므로 갱신
+        if (TreeView.IsValid())
+        {
+            TreeView->RequestListRefresh();
+        }
+    }
+}
+
+// 선택 캐시 갱신 함수
+void SLevelBasedTreeView::UpdateSelectionCache(TSharedPtr<FPartTreeItem> Item)
+{
+    // 선택 해제 이벤트(Item == nullptr)에서는 남은 선택이 있는지 한 번만 확인
+    if (!Item.IsValid() && TreeView.IsValid() && TreeView->GetNumItemsSelected() > 0)
+    {
+        TArray<TSharedPtr<FPartTreeItem>> SelectedItems = TreeView->GetSelectedItems();
+        Item = SelectedItems[0];
+    }
+    
+    if (Item == CachedSelectedItem && !CachedSelectedMetadata.IsEmpty())
+    {
+        return;
     }
+    
+    CachedSelectedItem = Item;
+    CachedSelectedMetadata = FTreeViewUtils::GetFormattedMetadata(Item);
 }
 
 // 트리뷰 항목 더블클릭 이벤트 핸들러
@@ -609,6 +681,30 @@ void SLevelBasedTreeView::OnTreeItemDoubleClick(TSharedPtr<FPartTreeItem> Item)
         
         // 선택된 액터에 카메라 초점 맞추기
 #if WITH_EDITOR
+        // 노드 하위 트리의 캐시된 바운딩 박스로 이동 (컴포넌트 재수집 없음)
+        const FBox NodeBounds = FPartBoundsHierarchy::Get().GetBounds(Item->PartNo);
+        if (GEditor && NodeBounds.IsValid)
+        {
+            GEditor->MoveViewportCamerasToBox(NodeBounds, true);
+            GEditor->RedrawLevelEditingViewports();
+            return;
+        }
+        
+        // 인스턴스로 통합된 파트는 해당 인스턴스 영역으로 이동
+        UPartInstancedMeshComponent* InstancedComp = nullptr;
+        int32 InstanceIndex = INDEX_NONE;
+        if (GEditor && !FImportedNodeManager::Get().GetImportedActor(Item->PartNo)
+            && FImportedNodeManager::Get().FindImportedInstance(Item->PartNo, InstancedComp, InstanceIndex))
+        {
+            const FBox InstanceBounds = InstancedComp->GetInstanceWorldBounds(InstanceIndex);
+            if (InstanceBounds.IsValid)
+            {
+                GEditor->MoveViewportCamerasToBox(InstanceBounds, true);
+                GEditor->RedrawLevelEditingViewports();
+                return;
+            }
+        }
+        
         if (GEditor)
         {
             // 현재 선택된 액터 가져오기
@@ -684,6 +780,18 @@ TSharedPtr<SWidget> SLevelBasedTreeView::OnContextMenuOpening()
             )
         );
         
+        // 파트 찾기 메뉴
+        MenuBuilder.AddMenuEntry(
+            FText::FromString(TEXT("Find Part... (Ctrl+P)")),
+            FText::FromString(TEXT("Fuzzy search by part number or nomenclature and select the exact instance")),
+            FSlateIcon(),
+            FUIAction(
+                FExecuteAction::CreateLambda([this]() {
+                    OpenFuzzyFinder();
+                })
+            )
+        );
+        
         // 분리선 추가
         MenuBuilder.AddMenuSeparator();
 
@@ -734,6 +842,188 @@ TSharedPtr<SWidget> SLevelBasedTreeView::OnContextMenuOpening()
                 })
             )
         );
+        
+        // 근접 파트 선택 메뉴 (겹침 또는 반경 이내)
+        MenuBuilder.AddSubMenu(
+            FText::FromString(TEXT("Select Parts Near")),
+            FText::FromString(TEXT("Select and highlight the tree nodes of parts overlapping or within a distance of the selected part")),
+            FNewMenuDelegate::CreateLambda([this, SelectedItem](FMenuBuilder& SubMenuBuilder) {
+                // 선택 노드에 임포트된 형상이 있는지 하위 메뉴를 만들 때 한 번만 확인 (메뉴 갱신마다 계층을 재구성하지 않음)
+                const bool bHasSourceBounds = SelectedItem.IsValid() && FPartBoundsHierarchy::Get().GetBounds(SelectedItem->PartNo).IsValid;
+                
+                const float RadiusOptionsMm[] = { 0.0f, 10.0f, 50.0f, 100.0f };
+                for (float RadiusMm : RadiusOptionsMm)
+                {
+                    SubMenuBuilder.AddMenuEntry(
+                        FText::FromString(RadiusMm > 0.0f ? FString::Printf(TEXT("Within %.0f mm"), RadiusMm) : FString(TEXT("Overlapping"))),
+                        FText::GetEmpty(),
+                        FSlateIcon(),
+                        FUIAction(
+                            FExecuteAction::CreateLambda([this, SelectedItem, RadiusMm]() {
+                                SelectPartsNear(SelectedItem, RadiusMm);
+                            }),
+                            FCanExecuteAction::CreateLambda([bHasSourceBounds]() {
+                                // 선택 노드에 임포트된 형상이 있을 때만 활성화
+                                return bHasSourceBounds;
+                            })
+                        )
+                    );
+                }
+                
+                SubMenuBuilder.AddMenuSeparator();
+                SubMenuBuilder.AddMenuEntry(
+                    FText::FromString(TEXT("Clear Highlight")),
+                    FText::GetEmpty(),
+                    FSlateIcon(),
+                    FUIAction(
+                        FExecuteAction::CreateLambda([this]() {
+                            ClearProximityHighlight();
+                        }),
+                        FCanExecuteAction::CreateLambda([this]() {
+                            return ProximityHighlightPartNos.Num() > 0;
+                        })
+                    )
+                );
+            })
+        );
+        
+        // BOM 비교 메뉴 (이전 CSV와 비교하여 변경 노드 색상 표시)
+        MenuBuilder.AddSubMenu(
+            FText::FromString(TEXT("BOM Diff")),
+            FText::FromString(TEXT("Compare the loaded BOM with a previous CSV export and color changed nodes")),
+            FNewMenuDelegate::CreateLambda([this](FMenuBuilder& SubMenuBuilder) {
+                SubMenuBuilder.AddMenuEntry(
+                    FText::FromString(TEXT("Compare with Previous BOM...")),
+                    FText::FromString(TEXT("Added: cyan, Moved: purple, Revised: yellow, Quantity changed: pink, Child removed: red italic")),
+                    FSlateIcon(),
+                    FUIAction(
+                        FExecuteAction::CreateLambda([this]() {
+                            PromptCompareWithBom();
+                        }),
+                        FCanExecuteAction::CreateLambda([this]() {
+                            return !LoadedBomFilePath.IsEmpty();
+                        })
+                    )
+                );
+                
+                SubMenuBuilder.AddMenuEntry(
+                    FText::FromString(TEXT("Clear BOM Diff")),
+                    FText::GetEmpty(),
+                    FSlateIcon(),
+                    FUIAction(
+                        FExecuteAction::CreateLambda([this]() {
+                            ClearBomDiff();
+                        }),
+                        FCanExecuteAction::CreateLambda([this]() {
+                            return BomDiffResult.IsValid();
+                        })
+                    )
+                );
+            })
+        );
+        
+        // 지연 형상 메뉴 (플레이스홀더 등록 후 펼침/선택/뷰포트 진입 시 임포트)
+        MenuBuilder.AddSubMenu(
+            FText::FromString(TEXT("Lazy Geometry")),
+            FText::FromString(TEXT("Register parts as bounding box placeholders and import them only when expanded, selected or seen in the viewport")),
+            FNewMenuDelegate::CreateLambda([SelectedItem](FMenuBuilder& SubMenuBuilder) {
+                SubMenuBuilder.AddMenuEntry(
+                    FText::FromString(TEXT("Register Subtree as Placeholders")),
+                    FText::FromString(TEXT("Register not-yet-imported parts under the selected node as placeholders")),
+                    FSlateIcon(),
+                    FUIAction(
+                        FExecuteAction::CreateLambda([SelectedItem]() {
+                            FLazyGeometryManager::Get().RegisterSubtree(SelectedItem);
+                        }),
+                        FCanExecuteAction::CreateLambda([SelectedItem]() {
+                            return SelectedItem.IsValid();
+                        })
+                    )
+                );
+                
+                SubMenuBuilder.AddMenuEntry(
+                    FText::FromString(TEXT("Clear Placeholders")),
+                    FText::FromString(TEXT("Remove all placeholders (imported geometry is kept)")),
+                    FSlateIcon(),
+                    FUIAction(
+                        FExecuteAction::CreateLambda([]() {
+                            FLazyGeometryManager::Get().UnregisterAll();
+                        }),
+                        FCanExecuteAction::CreateLambda([]() {
+                            return FLazyGeometryManager::Get().HasRegisteredParts();
+                        })
+                    )
+                );
+                
+                // 메모리 예산 선택
+                SubMenuBuilder.AddMenuSeparator();
+                const int32 BudgetOptionsMB[] = { 1024, 2048, 4096, 8192 };
+                for (int32 BudgetMB : BudgetOptionsMB)
+                {
+                    SubMenuBuilder.AddMenuEntry(
+                        FText::FromString(FString::Printf(TEXT("Memory Budget %d MB"), BudgetMB)),
+                        FText::FromString(TEXT("Evict least recently viewed parts back to placeholders above this estimated mesh memory")),
+                        FSlateIcon(),
+                        FUIAction(
+                            FExecuteAction::CreateLambda([BudgetMB]() {
+                                FLazyGeometryManager::Get().SetMemoryBudgetMB(BudgetMB);
+                            }),
+                            FCanExecuteAction(),
+                            FIsActionChecked::CreateLambda([BudgetMB]() {
+                                return FLazyGeometryManager::Get().GetMemoryBudgetMB() == BudgetMB;
+                            })
+                        ),
+                        NAME_None,
+                        EUserInterfaceActionType::RadioButton
+                    );
+                }
+            })
+        );
+        
+        // 분리선 추가
+        MenuBuilder.AddMenuSeparator();
+        
+        // 병합 프록시 생성 메뉴 (활성화 여부는 메뉴를 만들 때 한 번만 계산, 메뉴 갱신마다 하위 트리를 순회하지 않음)
+        bool bHasImportedActors = false;
+        if (SelectedItem.IsValid())
+        {
+            TArray<AActor*> ImportedActors;
+            FTreeViewUtils::CollectImportedActorsInSubtree(SelectedItem, ImportedActors);
+            bHasImportedActors = ImportedActors.Num() > 0;
+        }
+        MenuBuilder.AddMenuEntry(
+            FText::FromString(TEXT("Build Merged Proxy")),
+            FText::FromString(TEXT("Merge all imported meshes under the selected node into one proxy mesh with LODs and hide the originals")),
+            FSlateIcon(),
+            FUIAction(
+                FExecuteAction::CreateLambda([SelectedItem]() {
+                    TArray<AActor*> ImportedActors;
+                    FTreeViewUtils::CollectImportedActorsInSubtree(SelectedItem, ImportedActors);
+                    FAssemblyProxyManager::Get().BuildProxy(SelectedItem->PartNo, ImportedActors);
+                }),
+                FCanExecuteAction::CreateLambda([bHasImportedActors]() { 
+                    // 선택된 항목 아래에 임포트된 액터가 있을 때만 활성화
+                    return bHasImportedActors;
+                })
+            )
+        );
+        
+        // 프록시/원본 전환 메뉴
+        const bool bProxyShown = SelectedItem.IsValid() && FAssemblyProxyManager::Get().IsProxyShown(SelectedItem->PartNo);
+        MenuBuilder.AddMenuEntry(
+            FText::FromString(bProxyShown ? TEXT("Show Original Parts") : TEXT("Show Merged Proxy")),
+            FText::FromString(TEXT("Swap between the merged proxy and the original part actors")),
+            FSlateIcon(),
+            FUIAction(
+                FExecuteAction::CreateLambda([SelectedItem, bProxyShown]() {
+                    FAssemblyProxyManager::Get().SetProxyShown(SelectedItem->PartNo, !bProxyShown);
+                }),
+                FCanExecuteAction::CreateLambda([SelectedItem]() { 
+                    // 프록시가 있을 때만 활성화
+                    return SelectedItem.IsValid() && FAssemblyProxyManager::Get().HasProxy(SelectedItem->PartNo);
+                })
+            )
+        );
     }
     MenuBuilder.EndSection();
 
@@ -745,15 +1035,22 @@ void SLevelBasedTreeView::ExpandItemRecursively(TSharedPtr<FPartTreeItem> Item,
 {
     if (!Item.IsValid() || !TreeView.IsValid())
         return;
-        
-    // 현재 항목 펼치기/접기
-    TreeView->SetItemExpansion(Item, bExpand);
     
-    // 자식 항목들도 재귀적으로 펼치기/접기
-    for (auto& Child : Item->Children)
+    // 하위 트리 전체를 모은 뒤 한 번에 펼치기/접기 (보이는 행 재구성 한 번)
+    TArray<TSharedPtr<FPartTreeItem>> SubtreeItems;
+    TArray<TSharedPtr<FPartTreeItem>> Stack;
+    Stack.Add(Item);
+    while (Stack.Num() > 0)
     {
-        ExpandItemRecursively(Child, bExpand);
+        TSharedPtr<FPartTreeItem> Current = Stack.Pop(EAllowShrinking::No);
+        if (Current->Children.Num() == 0)
+            continue;
+        
+        SubtreeItems.Add(Current);
+        Stack.Append(Current->Children);
     }
+    
+    SetItemsExpansion(SubtreeItems, bExpand);
 }
 
 // 이미지 필터링 활성화/비활성화 함수
@@ -767,11 +1064,8 @@ void SLevelBasedTreeView::ToggleImageFiltering(bool bEnable)
     UE_LOG(LogTemp, Display, TEXT("이미지 필터링 %s: 이미지 있는 파트 %d개"), 
         bEnable ? TEXT("활성화") : TEXT("비활성화"), FServiceLocator::GetImageManager()->GetPartsWithImageSet().Num());
     
-    // OnGetChildren 함수에서 필터링하도록 트리뷰 갱신만 요청
-    if (TreeView.IsValid())
-    {
-        TreeView->RequestTreeRefresh();
-    }
+    // 필터 결과가 바뀐 하위 트리만 보이는 행에 반영
+    RefreshVisibleRows(AllRootItems);
 }
 
 
@@ -786,11 +1080,8 @@ void SLevelBasedTreeView::ToggleImportedNodesFiltering(bool bEnable)
     UE_LOG(LogTemp, Display, TEXT("임포트된 노드 필터링 %s: 임포트된 노드 %d개"), 
         bEnable ? TEXT("활성화") : TEXT("비활성화"), FImportedNodeManager::Get().GetImportedNodeCount());
     
-    // 트리뷰 갱신 (필터링 적용)
-    if (TreeView.IsValid())
-    {
-        TreeView->RequestTreeRefresh();
-    }
+    // 필터 결과가 바뀐 하위 트리만 보이는 행에 반영
+    RefreshVisibleRows(AllRootItems);
 }
 
 // 중복 노드 필터 활성화/비활성화 함수
@@ -804,39 +1095,36 @@ void SLevelBasedTreeView::ToggleDuplicateFiltering(bool bEnable)
     UE_LOG(LogTemp, Display, TEXT("중복 노드 필터링 %s"), 
         bEnable ? TEXT("활성화") : TEXT("비활성화"));
     
-    // 트리뷰 갱신 (필터링 적용)
-    if (TreeView.IsValid())
-    {
-        TreeView->RequestTreeRefresh();
-    }
+    // 필터 결과가 바뀐 하위 트리만 보이는 행에 반영
+    RefreshVisibleRows(AllRootItems);
+}
+
+// CAD 파일 필터 활성화/비활성화 함수
+void SLevelBasedTreeView::ToggleCADFileFiltering(bool bEnable)
+{
+    // 이미 같은 상태면 아무것도 하지 않음
+    if (FilterManager->IsFilterEnabled("CADFileFilter") == bEnable) { return; }
+        
+    FilterManager->SetFilterEnabled("CADFileFilter", bEnable);
+    
+    FPartFileIndex* CADFileIndex = FServiceLocator::GetCADFileIndex();
+    UE_LOG(LogTemp, Display, TEXT("CAD 파일 필터링 %s: 3DXML 파일 있는 파트 %d개"), 
+        bEnable ? TEXT("활성화") : TEXT("비활성화"), CADFileIndex ? CADFileIndex->Num() : 0);
+    
+    // 필터 결과가 바뀐 하위 트리만 보이는 행에 반영
+    RefreshVisibleRows(AllRootItems);
 }
 
 // 메타데이터 위젯 반환 함수
 TSharedRef<SWidget> SLevelBasedTreeView::GetMetadataWidget()
 {
-    // 메타데이터 표시를 위한 텍스트 블록 생성
+    // 메타데이터 표시를 위한 텍스트 블록 생성 (캐시된 텍스트만 반환하므로 폴링 비용 없음)
     TSharedRef<STextBlock> MetadataText = SNew(STextBlock)
         .Text(TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SLevelBasedTreeView::GetSelectedItemMetadata)));
     
     return MetadataText;
 }
 
-// 선택된 항목의 메타데이터를 텍스트로 반환하는 메서드
-FText SLevelBasedTreeView::GetSelectedItemMetadata() const
-{
-    // 선택된 항목 가져오기
-    TArray<TSharedPtr<FPartTreeItem>> SelectedItems = TreeView->GetSelectedItems();
-    
-    if (SelectedItems.Num() == 0)
-    {
-        return FText::FromString("No item selected");
-    }
-    
-    TSharedPtr<FPartTreeItem> SelectedItem = SelectedItems[0];
-    
-    return FTreeViewUtils::GetFormattedMetadata(SelectedItem);
-}
-
 // 트리뷰 구성 함수
 bool SLevelBasedTreeView::BuildTreeView(const FString& FilePath)
 {
@@ -844,76 +1132,46 @@ bool SLevelBasedTreeView::BuildTreeView(const FString& FilePath)
     AllRootItems.Empty();
     PartNoToItemMap.Empty();
     LevelToItemsMap.Empty();
+    ExpandedItems.Empty();
+    VisibleRows.Empty();
+    RowIndexMap.Empty();
+    ProximityHighlightPartNos.Empty();
+    BomDiffResult.Reset();
     MaxLevel = 0;
+    LoadedBomFilePath = FilePath;
+    LoadedBomHash = FTreeViewStateStore::ComputeBomHash(FilePath);
     
     UE_LOG(LogTemp, Display, TEXT("트리뷰 구성 시작: %s"), *FilePath);
     
-    // CSV 파일 읽기
-    TArray<TArray<FString>> ExcelData;
-    if (!FTreeViewUtils::ReadCSVFile(FilePath, ExcelData))
-    {
-        UE_LOG(LogTemp, Error, TEXT("CSV 파일 읽기 실패: %s"), *FilePath);
-        return false;
-    }
-    
-    if (ExcelData.Num() < 2) // 헤더 + 최소 1개 이상의 데이터 행 필요
+    // CSV 읽기, 항목 생성, 트리 구조 구축 (커맨드렛과 같은 경로)
+    if (!FTreeViewUtils::LoadBomTree(FilePath, PartNoToItemMap, LevelToItemsMap, MaxLevel, AllRootItems))
     {
-        UE_LOG(LogTemp, Error, TEXT("데이터 행이 부족합니다"));
         return false;
     }
     
-    // 헤더 행
-    const TArray<FString>& HeaderRow = ExcelData[0];
-    
-    // 필요한 열 인덱스 찾기
-    int32 PartNoColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
-        return HeaderName == TEXT("PartNo") || HeaderName == TEXT("Part No");
-    });
-    
-    int32 NextPartColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
-        return HeaderName == TEXT("NextPart");
-    });
-    
-    int32 LevelColIdx = HeaderRow.IndexOfByPredicate([](const FString& HeaderName) {
-        return HeaderName == TEXT("Level");
-    });
-    
-    // 인덱스를 찾지 못했으면 기본값 사용 (실제 엑셀 파일 구조 기준)
-    PartNoColIdx = (PartNoColIdx != INDEX_NONE) ? PartNoColIdx : 3; // D열 (Part No)
-    NextPartColIdx = (NextPartColIdx != INDEX_NONE) ? NextPartColIdx : 13; // N열 (NextPart)
-    LevelColIdx = (LevelColIdx != INDEX_NONE) ? LevelColIdx : 1; // B열 (Level)
+    // 노드별 바운딩 박스 계층에 BOM 구조 전달
+    FPartBoundsHierarchy::Get().SetPartTree(AllRootItems);
     
-    UE_LOG(LogTemp, Display, TEXT("CSV 데이터 읽기 완료: %d개 행"), ExcelData.Num() - 1);
+    // 파트 찾기용 퍼지 검색 인덱스 구성 (로드 시 한 번)
+    FuzzyIndex = MakeShared<FPartFuzzyIndex>();
+    FuzzyIndex->Build(AllRootItems);
     
+    // 어셈블리 서브레벨 셀 구성
+    FAssemblyStreamingManager::Get().SetPartTree(AllRootItems);
     
-    // 1단계: 모든 항목 생성 및 레벨별 그룹화 (TreeViewUtils 사용)
-    int32 ValidItemCount = FTreeViewUtils::CreateAndGroupItems(
-        ExcelData, 
-        PartNoColIdx, 
-        NextPartColIdx, 
-        LevelColIdx,
-        PartNoToItemMap,
-        LevelToItemsMap,
-        MaxLevel,
-        AllRootItems
-    );
-    
-    // 2단계: 트리 구조 구축
-    BuildTreeStructure();
+    // CAD 파일 필터의 하위 트리 플래그 계산 대상 트리
+    if (FPartFileIndex* CADFileIndex = FServiceLocator::GetCADFileIndex())
+    {
+        CADFileIndex->SetPartTree(AllRootItems);
+    }
     
     // 이미지 존재 여부 캐싱 (FPartImageManager 사용)
     FServiceLocator::GetImageManager()->CacheImageExistence(PartNoToItemMap);
     
-    // 트리뷰 갱신
+    // 루트 항목 확장 및 보이는 행 구성
     if (TreeView.IsValid())
     {
-        TreeView->RequestTreeRefresh();
-        
-        // 루트 항목 확장
-        for (auto& RootItem : AllRootItems)
-        {
-            TreeView->SetItemExpansion(RootItem, true);
-        }
+        SetItemsExpansion(AllRootItems, true);
     }
 
     // 트리뷰 구성 요약 로그 출력
@@ -942,62 +1200,6 @@ bool SLevelBasedTreeView::BuildTreeView(const FString& FilePath)
     return AllRootItems.Num() > 0;
 }
 
-// 트리 구조 구축 함수
-void SLevelBasedTreeView::BuildTreeStructure()
-{
-    UE_LOG(LogTemp, Display, TEXT("트리 구조 구축 시작: 최대 레벨 %d"), MaxLevel);
-    
-    // 레벨 0부터 MaxLevel-1까지 순회하며 부모-자식 관계 설정
-    for (int32 CurrentLevel = 0; CurrentLevel < MaxLevel; ++CurrentLevel)
-    {
-        // 현재 레벨의 항목이 있는지 확인
-        if (!LevelToItemsMap.Contains(CurrentLevel))
-            continue;
-            
-        // 다음 레벨의 항목이 있는지 확인
-        if (!LevelToItemsMap.Contains(CurrentLevel + 1))
-            continue;
-            
-        // 현재 레벨의 모든 항목
-        const TArray<TSharedPtr<FPartTreeItem>>& CurrentLevelItems = LevelToItemsMap[CurrentLevel];
-        
-        // 다음 레벨의 모든 항목
-        TArray<TSharedPtr<FPartTreeItem>>& NextLevelItems = LevelToItemsMap[CurrentLevel + 1];
-        
-        int32 ConnectionCount = 0;
-        
-        // 다음 레벨의 각 항목에 대해 부모 찾기
-        for (const TSharedPtr<FPartTreeItem>& ChildItem : NextLevelItems)
-        {
-            // NextPart가 현재 레벨의 항목 중 하나와 일치하는지 확인
-            if (!ChildItem->NextPart.IsEmpty() && !ChildItem->NextPart.Equals(TEXT("nan"), ESearchCase::IgnoreCase))
-            {
-                // 직접 맵을 사용하여 부모 항목 찾기 (더 효율적)
-                TSharedPtr<FPartTreeItem>* ParentItemPtr = PartNoToItemMap.Find(ChildItem->NextPart);
-                
-                if (ParentItemPtr && (*ParentItemPtr)->Level == CurrentLevel)
-                {
-                    // 부모-자식 관계 설정
-                    (*ParentItemPtr)->Children.Add(ChildItem);
-                    ConnectionCount++;
-                }
-            }
-        }
-        
-        UE_LOG(LogTemp, Verbose, TEXT("레벨 %d -> %d 부모-자식 연결: %d개 설정됨"), 
-            CurrentLevel, CurrentLevel + 1, ConnectionCount);
-    }
-    
-    // 루트 항목들이 설정되지 않았으면, 레벨 0의 항목들을 루트로 설정
-    if (AllRootItems.Num() == 0 && LevelToItemsMap.Contains(0))
-    {
-        AllRootItems = LevelToItemsMap[0];
-        UE_LOG(LogTemp, Display, TEXT("루트 항목 자동 설정: 레벨 0의 모든 항목(%d개)이 루트로 설정됨"), AllRootItems.Num());
-    }
-    
-    UE_LOG(LogTemp, Display, TEXT("트리 구조 구축 완료: 루트 항목 %d개"), AllRootItems.Num());
-}
-
 // 트리뷰 행 생성 델리게이트
 TSharedRef<ITableRow> SLevelBasedTreeView::OnGenerateRow(TSharedPtr<FPartTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
@@ -1005,9 +1207,47 @@ TSharedRef<ITableRow> SLevelBasedTreeView::OnGenerateRow(TSharedPtr<FPartTreeIte
     FSlateColor TextColor = FSlateColor(FLinearColor::White);
     FSlateFontInfo FontInfo = FCoreStyle::GetDefaultFontStyle("Regular", 9);
     bool bShowImportIcon = false;
+    FText ToolTipText;
     
+    const EBomDiffFlags DiffFlags = BomDiffResult.IsValid() ? BomDiffResult->GetPartFlags(Item->PartNo) : EBomDiffFlags::None;
+    
+    // 근접 파트 질의 결과 강조 (주황색)
+    if (ProximityHighlightPartNos.Contains(Item->PartNo))
+    {
+        TextColor = FSlateColor(FLinearColor(1.0f, 0.55f, 0.0f));
+        FontInfo = FCoreStyle::GetDefaultFontStyle("Bold", 9);
+        bShowImportIcon = FImportedNodeManager::Get().IsNodeImported(Item->PartNo);
+    }
+    // BOM 비교 결과 (가장 큰 변경 종류 색상)
+    else if (DiffFlags != EBomDiffFlags::None)
+    {
+        FontInfo = FCoreStyle::GetDefaultFontStyle("Bold", 9);
+        if (EnumHasAnyFlags(DiffFlags, EBomDiffFlags::Added))
+        {
+            TextColor = FSlateColor(FLinearColor(0.2f, 0.9f, 1.0f)); // 하늘색
+        }
+        else if (EnumHasAnyFlags(DiffFlags, EBomDiffFlags::Moved))
+        {
+            TextColor = FSlateColor(FLinearColor(0.7f, 0.5f, 1.0f)); // 보라색
+        }
+        else if (EnumHasAnyFlags(DiffFlags, EBomDiffFlags::Revised))
+        {
+            TextColor = FSlateColor(FLinearColor(1.0f, 0.85f, 0.2f)); // 노란색
+        }
+        else if (EnumHasAnyFlags(DiffFlags, EBomDiffFlags::QuantityChanged))
+        {
+            TextColor = FSlateColor(FLinearColor(0.95f, 0.45f, 0.6f)); // 분홍색
+        }
+        else
+        {
+            TextColor = FSlateColor(FLinearColor(1.0f, 0.4f, 0.4f)); // 하위 삭제만 있음
+            FontInfo = FCoreStyle::GetDefaultFontStyle("Italic", 9);
+        }
+        ToolTipText = FText::FromString(FBomDiff::DescribeFlags(DiffFlags));
+        bShowImportIcon = FImportedNodeManager::Get().IsNodeImported(Item->PartNo);
+    }
     // 임포트된 노드 확인
-    if (FImportedNodeManager::Get().IsNodeImported(Item->PartNo))
+    else if (FImportedNodeManager::Get().IsNodeImported(Item->PartNo))
     {
         TextColor = FSlateColor(FLinearColor(0.0f, 0.8f, 0.4f)); // 밝은 녹색
         FontInfo = FCoreStyle::GetDefaultFontStyle("Bold", 9);
@@ -1040,10 +1280,51 @@ TSharedRef<ITableRow> SLevelBasedTreeView::OnGenerateRow(TSharedPtr<FPartTreeIte
         }
     }
     
-    // 각 트리 항목에 대한 행 위젯 생성
+    // 펼침 화살표는 보이는 자식이 있을 때만 표시 (자리는 유지하여 들여쓰기 정렬)
+    const bool bHasVisibleChildren = GetVisibleChildren(Item).Num() > 0;
+    
+    // 각 트리 항목에 대한 행 위젯 생성 (레벨만큼 들여쓰기)
     return SNew(STableRow<TSharedPtr<FPartTreeItem>>, OwnerTable)
         [
             SNew(SHorizontalBox)
+            // 들여쓰기 및 펼침 화살표
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(FMargin(Item->Level * 12.0f, 0, 0, 0))
+            [
+                SNew(SButton)
+                .ButtonStyle(FAppStyle::Get(), "NoBorder")
+                .ContentPadding(FMargin(2, 0))
+                .ClickMethod(EButtonClickMethod::MouseDown)
+                .OnClicked(this, &SLevelBasedTreeView::OnExpanderClicked, Item)
+                .Visibility(bHasVisibleChildren ? EVisibility::Visible : EVisibility::Hidden)
+                [
+                    SNew(SImage)
+                    .Image_Lambda([this, Item]()
+                    {
+                        return FAppStyle::GetBrush(IsItemExpanded(Item) ? "TreeArrow_Expanded" : "TreeArrow_Collapsed");
+                    })
+                    .ColorAndOpacity(FSlateColor::UseForeground())
+                ]
+            ]
+            // 어셈블리 서브레벨 로드/언로드 체크박스 (서브레벨이 만들어진 셀 노드만)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(FMargin(2, 0, 0, 0))
+            [
+                SNew(SCheckBox)
+                .IsChecked(this, &SLevelBasedTreeView::GetCellCheckState, Item)
+                .OnCheckStateChanged(this, &SLevelBasedTreeView::OnCellCheckStateChanged, Item)
+                .ToolTipText(FText::FromString(TEXT("어셈블리 서브레벨 로드/언로드")))
+                .Visibility_Lambda([Item]()
+                {
+                    const FAssemblyStreamingManager& StreamingManager = FAssemblyStreamingManager::Get();
+                    return StreamingManager.IsCellNode(Item->PartNo) && StreamingManager.HasCellLevel(Item->PartNo)
+                        ? EVisibility::Visible : EVisibility::Collapsed;
+                })
+            ]
             + SHorizontalBox::Slot()
             .AutoWidth()
             .VAlign(VAlign_Center)
@@ -1053,6 +1334,7 @@ TSharedRef<ITableRow> SLevelBasedTreeView::OnGenerateRow(TSharedPtr<FPartTreeIte
                 .Text(FText::FromString(Item->PartNo))
                 .ColorAndOpacity(TextColor)
                 .Font(FontInfo)
+                .ToolTipText(ToolTipText)
             ]
             // 임포트된 노드에 아이콘 추가
             + SHorizontalBox::Slot()
@@ -1067,38 +1349,24 @@ TSharedRef<ITableRow> SLevelBasedTreeView::OnGenerateRow(TSharedPtr<FPartTreeIte
         ];
 }
 
-// 트리뷰 자식 항목 반환 델리게이트
-void SLevelBasedTreeView::OnGetChildren(TSharedPtr<FPartTreeItem> Item, TArray<TSharedPtr<FPartTreeItem>>& OutChildren)
+// 항목의 보이는 자식 반환 (필터/검색 상태가 바뀔 때까지 캐시)
+const TArray<TSharedPtr<FPartTreeItem>>& SLevelBasedTreeView::GetVisibleChildren(const TSharedPtr<FPartTreeItem>& Item)
 {
-	if (bIsSearching && !SearchText.IsEmpty())
+	if (const TArray<TSharedPtr<FPartTreeItem>>* Cached = VisibleChildrenCache.Find(Item.Get()))
 	{
-		// 검색 중인 경우: 검색 결과에 있는 자식 항목이나 
-		// 검색 결과의 부모 경로에 있는 항목만 표시
-		for (const auto& Child : Item->Children)
+		return *Cached;
+	}
+	
+	TArray<TSharedPtr<FPartTreeItem>>& OutChildren = VisibleChildrenCache.Add(Item.Get());
+	if (bIsSearching && !SearchText.IsEmpty())
+	{
+		// 검색 중인 경우: 검색 결과이거나 검색 결과의 상위 경로에 있는 자식만 표시
+		for (const auto& Child : Item->Children)
 		{
-			if (SearchResults.Contains(Child))
+			if (SearchPathItems.Contains(Child.Get()))
 			{
-				// 직접 검색 결과인 경우
 				OutChildren.Add(Child);
 			}
-			else
-			{
-				// 자식 항목 중에 검색 결과가 있는지 확인
-				bool bHasSearchResultChild = false;
-				for (const auto& Result : SearchResults)
-				{
-					if (FTreeViewUtils::IsChildOf(Result, Child))
-					{
-						bHasSearchResultChild = true;
-						break;
-					}
-				}
-                
-				if (bHasSearchResultChild)
-				{
-					OutChildren.Add(Child);
-				}
-			}
 		}
 	}
 	else
@@ -1113,6 +1381,391 @@ void SLevelBasedTreeView::OnGetChildren(TSharedPtr<FPartTreeItem> Item, TArray<T
 	        }
 	    }
 	}
+	return OutChildren;
+}
+
+// 항목 아래의 보이는 하위 행을 전위 순서로 추가하는 함수
+void SLevelBasedTreeView::AppendVisibleDescendants(const TSharedPtr<FPartTreeItem>& Item, TArray<TSharedPtr<FPartTreeItem>>& OutRows)
+{
+	if (!ExpandedItems.Contains(Item))
+		return;
+	
+	// 스택에 역순으로 넣어 자식 순서대로 방문
+	TArray<TSharedPtr<FPartTreeItem>> Stack;
+	const TArray<TSharedPtr<FPartTreeItem>>& RootChildren = GetVisibleChildren(Item);
+	for (int32 Index = RootChildren.Num() - 1; Index >= 0; --Index)
+	{
+		Stack.Add(RootChildren[Index]);
+	}
+	
+	while (Stack.Num() > 0)
+	{
+		TSharedPtr<FPartTreeItem> Current = Stack.Pop(EAllowShrinking::No);
+		OutRows.Add(Current);
+		
+		if (ExpandedItems.Contains(Current))
+		{
+			const TArray<TSharedPtr<FPartTreeItem>>& Children = GetVisibleChildren(Current);
+			for (int32 Index = Children.Num() - 1; Index >= 0; --Index)
+			{
+				Stack.Add(Children[Index]);
+			}
+		}
+	}
+}
+
+// 보이는 행 전체 재구성 함수
+void SLevelBasedTreeView::RebuildVisibleRows()
+{
+	// 필터 상태(중복 필터의 처리 목록 등)와 자식 캐시를 비우고 루트부터 다시 구성
+	VisibleChildrenCache.Empty();
+	FilterManager->ResetFilters();
+	
+	VisibleRows.Reset();
+	for (const TSharedPtr<FPartTreeItem>& RootItem : AllRootItems)
+	{
+		VisibleRows.Add(RootItem);
+		AppendVisibleDescendants(RootItem, VisibleRows);
+	}
+	
+	RowIndexMap.Reset();
+	ReindexRows(0);
+	
+	// 필터/검색에 따라 색상과 펼침 화살표가 바뀌므로 행 위젯도 다시 생성 (화면에 보이는 행만)
+	if (TreeView.IsValid())
+	{
+		TreeView->RebuildList();
+	}
+}
+
+// 필터/검색 변경 후 바뀐 하위 트리만 잘라 붙이는 함수
+void SLevelBasedTreeView::RefreshVisibleRows(const TArray<TSharedPtr<FPartTreeItem>>& PreviousRootItems)
+{
+	// 이전 자식 캐시는 현재 보이는 행과 일치하므로 비교 기준으로 보관
+	const TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>> PreviousChildren = MoveTemp(VisibleChildrenCache);
+	VisibleChildrenCache.Reset();
+	FilterManager->ResetFilters();
+	
+	// 루트는 필터링하지 않으므로 이전 루트와 현재 루트를 자식 목록처럼 비교
+	TArray<FRowSplice> Splices;
+	DiffVisibleChildren(PreviousRootItems, AllRootItems, 0, VisibleRows.Num(), PreviousChildren, Splices);
+	
+	const int32 SpliceCount = Splices.Num();
+	ApplyRowSplices(Splices);
+	
+	UE_LOG(LogTemp, Verbose, TEXT("보이는 행 갱신: 편집 %d개, 행 %d개"), SpliceCount, VisibleRows.Num());
+	
+	// 필터/검색에 따라 색상과 펼침 화살표가 바뀌므로 행 위젯도 다시 생성 (화면에 보이는 행만)
+	if (TreeView.IsValid())
+	{
+		TreeView->RebuildList();
+	}
+}
+
+// 이전/새 자식 목록 비교 함수
+void SLevelBasedTreeView::DiffVisibleChildren(const TArray<TSharedPtr<FPartTreeItem>>& OldChildren, const TArray<TSharedPtr<FPartTreeItem>>& NewChildren,
+	int32 FirstRowIndex, int32 EndRowIndex, const TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>>& PreviousChildren,
+	TArray<FRowSplice>& OutSplices)
+{
+	// 이전 자식의 행 범위는 다음 이전 형제의 행 위치 또는 부모 범위 끝까지
+	auto GetOldChildEnd = [&](int32 OldIndex)
+	{
+		return OldIndex + 1 < OldChildren.Num() ? RowIndexMap.FindChecked(OldChildren[OldIndex + 1].Get()) : EndRowIndex;
+	};
+	
+	// 자식 목록이 같으면 각 자식의 하위 트리만 확인
+	if (OldChildren == NewChildren)
+	{
+		int32 Cursor = FirstRowIndex;
+		for (int32 OldIndex = 0; OldIndex < OldChildren.Num(); ++OldIndex)
+		{
+			const int32 ChildEnd = GetOldChildEnd(OldIndex);
+			DiffVisibleSubtree(OldChildren[OldIndex], Cursor, ChildEnd, PreviousChildren, OutSplices);
+			Cursor = ChildEnd;
+		}
+		return;
+	}
+	
+	TSet<const FPartTreeItem*> OldSet;
+	OldSet.Reserve(OldChildren.Num());
+	for (const TSharedPtr<FPartTreeItem>& Child : OldChildren)
+	{
+		OldSet.Add(Child.Get());
+	}
+	
+	TSet<const FPartTreeItem*> NewSet;
+	NewSet.Reserve(NewChildren.Num());
+	for (const TSharedPtr<FPartTreeItem>& Child : NewChildren)
+	{
+		NewSet.Add(Child.Get());
+	}
+	
+	// 순서가 바뀐 자식은 이전 위치에서 삭제하고 새 위치에서 다시 삽입
+	TSet<const FPartTreeItem*> MovedChildren;
+	
+	// 두 목록은 같은 순서로 걸으며 유지/삭제/삽입을 판정 (편집은 행 인덱스 오름차순으로 쌓임)
+	int32 OldIndex = 0;
+	int32 NewIndex = 0;
+	int32 Cursor = FirstRowIndex;
+	while (OldIndex < OldChildren.Num() || NewIndex < NewChildren.Num())
+	{
+		const TSharedPtr<FPartTreeItem> OldChild = OldIndex < OldChildren.Num() ? OldChildren[OldIndex] : TSharedPtr<FPartTreeItem>();
+		const TSharedPtr<FPartTreeItem> NewChild = NewIndex < NewChildren.Num() ? NewChildren[NewIndex] : TSharedPtr<FPartTreeItem>();
+		
+		if (OldChild.IsValid() && OldChild == NewChild)
+		{
+			// 유지: 하위 트리만 비교
+			const int32 ChildEnd = GetOldChildEnd(OldIndex);
+			DiffVisibleSubtree(OldChild, Cursor, ChildEnd, PreviousChildren, OutSplices);
+			Cursor = ChildEnd;
+			++OldIndex;
+			++NewIndex;
+		}
+		else if (NewChild.IsValid() && (!OldSet.Contains(NewChild.Get()) || MovedChildren.Contains(NewChild.Get())))
+		{
+			// 삽입: 새 자식과 펼쳐진 하위 행
+			FRowSplice& Splice = OutSplices.AddDefaulted_GetRef();
+			Splice.Index = Cursor;
+			Splice.InsertedRows.Add(NewChild);
+			AppendVisibleDescendants(NewChild, Splice.InsertedRows);
+			++NewIndex;
+		}
+		else if (OldChild.IsValid())
+		{
+			// 삭제 (새 목록에 있으면 뒤에서 다시 삽입)
+			if (NewSet.Contains(OldChild.Get()))
+			{
+				MovedChildren.Add(OldChild.Get());
+			}
+			
+			const int32 ChildEnd = GetOldChildEnd(OldIndex);
+			FRowSplice& Splice = OutSplices.AddDefaulted_GetRef();
+			Splice.Index = Cursor;
+			Splice.RemovedCount = ChildEnd - Cursor;
+			Cursor = ChildEnd;
+			++OldIndex;
+		}
+		else
+		{
+			// 남은 새 자식이 이전 목록에만 있는 경우는 없지만 무한 루프 방지
+			++NewIndex;
+		}
+	}
+}
+
+// 유지되는 항목의 하위 행 비교 함수
+void SLevelBasedTreeView::DiffVisibleSubtree(const TSharedPtr<FPartTreeItem>& Item, int32 RowIndex, int32 EndRowIndex,
+	const TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>>& PreviousChildren, TArray<FRowSplice>& OutSplices)
+{
+	const int32 FirstChildRow = RowIndex + 1;
+	const bool bHadChildRows = EndRowIndex > FirstChildRow;
+	
+	// 접힌 항목은 자식을 평가하지 않음 (남은 하위 행이 있으면 삭제)
+	if (!ExpandedItems.Contains(Item))
+	{
+		if (bHadChildRows)
+		{
+			FRowSplice& Splice = OutSplices.AddDefaulted_GetRef();
+			Splice.Index = FirstChildRow;
+			Splice.RemovedCount = EndRowIndex - FirstChildRow;
+		}
+		return;
+	}
+	
+	// 하위 행이 없던 펼친 항목은 새로 보이는 자식만 삽입
+	const TArray<TSharedPtr<FPartTreeItem>>* OldChildren = PreviousChildren.Find(Item.Get());
+	if (!bHadChildRows || !OldChildren)
+	{
+		FRowSplice Splice;
+		Splice.Index = FirstChildRow;
+		Splice.RemovedCount = EndRowIndex - FirstChildRow;
+		AppendVisibleDescendants(Item, Splice.InsertedRows);
+		if (Splice.RemovedCount > 0 || Splice.InsertedRows.Num() > 0)
+		{
+			OutSplices.Add(MoveTemp(Splice));
+		}
+		return;
+	}
+	
+	// 캐시 참조는 하위 비교 중 맵이 커지면 무효가 되므로 복사
+	const TArray<TSharedPtr<FPartTreeItem>> NewChildren = GetVisibleChildren(Item);
+	DiffVisibleChildren(*OldChildren, NewChildren, FirstChildRow, EndRowIndex, PreviousChildren, OutSplices);
+}
+
+// 편집 목록 적용 함수
+void SLevelBasedTreeView::ApplyRowSplices(TArray<FRowSplice>& Splices)
+{
+	if (Splices.Num() == 0)
+		return;
+	
+	// 첫 편집 위치 앞의 행은 그대로 두고 뒷부분만 한 번에 다시 채움
+	const int32 FirstIndex = Splices[0].Index;
+	TArray<TSharedPtr<FPartTreeItem>> TailRows;
+	TailRows.Reserve(VisibleRows.Num() - FirstIndex);
+	
+	int32 ReadIndex = FirstIndex;
+	for (FRowSplice& Splice : Splices)
+	{
+		for (; ReadIndex < Splice.Index; ++ReadIndex)
+		{
+			TailRows.Add(MoveTemp(VisibleRows[ReadIndex]));
+		}
+		for (int32 Removed = 0; Removed < Splice.RemovedCount; ++Removed, ++ReadIndex)
+		{
+			RowIndexMap.Remove(VisibleRows[ReadIndex].Get());
+		}
+		TailRows.Append(MoveTemp(Splice.InsertedRows));
+	}
+	for (; ReadIndex < VisibleRows.Num(); ++ReadIndex)
+	{
+		TailRows.Add(MoveTemp(VisibleRows[ReadIndex]));
+	}
+	
+	VisibleRows.SetNum(FirstIndex, EAllowShrinking::No);
+	VisibleRows.Append(MoveTemp(TailRows));
+	ReindexRows(FirstIndex);
+}
+
+// 행 인덱스 맵 갱신 함수
+void SLevelBasedTreeView::ReindexRows(int32 StartIndex)
+{
+	for (int32 RowIndex = StartIndex; RowIndex < VisibleRows.Num(); ++RowIndex)
+	{
+		RowIndexMap.Add(VisibleRows[RowIndex].Get(), RowIndex);
+	}
+}
+
+// 항목의 보이는 행 인덱스 반환 함수
+int32 SLevelBasedTreeView::FindRowIndex(const TSharedPtr<FPartTreeItem>& Item) const
+{
+	const int32* RowIndex = RowIndexMap.Find(Item.Get());
+	return RowIndex ? *RowIndex : INDEX_NONE;
+}
+
+// 항목 펼침/접힘 함수
+void SLevelBasedTreeView::SetItemExpansion(const TSharedPtr<FPartTreeItem>& Item, bool bExpand)
+{
+	if (!Item.IsValid() || IsItemExpanded(Item) == bExpand)
+		return;
+	
+	const int32 RowIndex = FindRowIndex(Item);
+	TArray<FRowSplice> Splices;
+	if (!bExpand && RowIndex != INDEX_NONE)
+	{
+		// 접기: 바로 뒤에 이어지는 더 깊은 행만 삭제 (펼침 상태를 바꾸기 전에 범위 계산)
+		int32 EndIndex = RowIndex + 1;
+		while (EndIndex < VisibleRows.Num() && VisibleRows[EndIndex]->Level > Item->Level)
+		{
+			++EndIndex;
+		}
+		FRowSplice& Splice = Splices.AddDefaulted_GetRef();
+		Splice.Index = RowIndex + 1;
+		Splice.RemovedCount = EndIndex - RowIndex - 1;
+	}
+	
+	if (bExpand)
+	{
+		ExpandedItems.Add(Item);
+		
+		// 펼치기: 보이는 하위 행만 항목 바로 뒤에 삽입
+		if (RowIndex != INDEX_NONE)
+		{
+			FRowSplice& Splice = Splices.AddDefaulted_GetRef();
+			Splice.Index = RowIndex + 1;
+			AppendVisibleDescendants(Item, Splice.InsertedRows);
+		}
+	}
+	else
+	{
+		ExpandedItems.Remove(Item);
+	}
+	
+	ApplyRowSplices(Splices);
+	
+	if (RowIndex != INDEX_NONE && TreeView.IsValid())
+	{
+		TreeView->RequestListRefresh();
+	}
+	
+	OnItemExpansionChanged(Item, bExpand);
+}
+
+// 여러 항목 펼침/접힘 함수
+void SLevelBasedTreeView::SetItemsExpansion(const TArray<TSharedPtr<FPartTreeItem>>& Items, bool bExpand)
+{
+	for (const TSharedPtr<FPartTreeItem>& Item : Items)
+	{
+		if (!Item.IsValid() || IsItemExpanded(Item) == bExpand)
+			continue;
+		
+		if (bExpand)
+		{
+			ExpandedItems.Add(Item);
+		}
+		else
+		{
+			ExpandedItems.Remove(Item);
+		}
+		OnItemExpansionChanged(Item, bExpand);
+	}
+	
+	RebuildVisibleRows();
+}
+
+// 검색 결과 상위 경로 집합 재구성 함수
+void SLevelBasedTreeView::RebuildSearchPaths()
+{
+	SearchPathItems.Empty();
+	
+	// 후위 순회: 자신이 검색 결과이거나 자식 중 경로에 포함된 항목이 있으면 경로에 포함
+	const TSet<TSharedPtr<FPartTreeItem>> ResultSet(SearchResults);
+	TFunction<bool(const TSharedPtr<FPartTreeItem>&)> MarkPath = [&](const TSharedPtr<FPartTreeItem>& Item) -> bool
+	{
+		bool bOnPath = ResultSet.Contains(Item);
+		for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+		{
+			bOnPath |= MarkPath(Child);
+		}
+		if (bOnPath)
+		{
+			SearchPathItems.Add(Item.Get());
+		}
+		return bOnPath;
+	};
+	
+	for (const TSharedPtr<FPartTreeItem>& RootItem : AllRootItems)
+	{
+		MarkPath(RootItem);
+	}
+}
+
+// 펼침 화살표 클릭 이벤트 핸들러
+FReply SLevelBasedTreeView::OnExpanderClicked(TSharedPtr<FPartTreeItem> Item)
+{
+	SetItemExpansion(Item, !IsItemExpanded(Item));
+	return FReply::Handled();
+}
+
+// 키 입력 이벤트 핸들러
+FReply SLevelBasedTreeView::OnTreeKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	// Ctrl+P: 파트 찾기 팝업
+	if (InKeyEvent.IsControlDown() && InKeyEvent.GetKey() == EKeys::P)
+	{
+		OpenFuzzyFinder();
+		return FReply::Handled();
+	}
+	
+	const bool bExpandKey = InKeyEvent.GetKey() == EKeys::Right;
+	const bool bCollapseKey = InKeyEvent.GetKey() == EKeys::Left;
+	if (!TreeView.IsValid() || (!bExpandKey && !bCollapseKey))
+		return FReply::Unhandled();
+	
+	for (const TSharedPtr<FPartTreeItem>& Item : TreeView->GetSelectedItems())
+	{
+		SetItemExpansion(Item, bExpandKey);
+	}
+	return FReply::Handled();
 }
 
 // 항목의 경로를 펼치는 함수
@@ -1123,7 +1776,7 @@ void SLevelBasedTreeView::ExpandPathToItem(const TSharedPtr<FPartTreeItem>& Item
 	if (ParentItem.IsValid())
 	{
 		ExpandPathToItem(ParentItem);
-		TreeView->SetItemExpansion(ParentItem, true);
+		SetItemExpansion(ParentItem, true);
 	}
 }
 
@@ -1139,8 +1792,21 @@ void SLevelBasedTreeView::ImportXMLToSelectedNode()
     // 성공적으로 임포트된 항목이 있으면 트리뷰 갱신
     if (SuccessCount > 0 && TreeView.IsValid())
     {
-        // 트리뷰 강제 갱신
-        TreeView->RebuildList();
+        // 임포트 노드 필터가 켜져 있으면 보이는 행이 바뀌므로 바뀐 부분만 갱신, 아니면 색상만 갱신
+        if (FilterManager->IsFilterEnabled("ImportedNodeFilter"))
+        {
+            RefreshVisibleRows(AllRootItems);
+        }
+        else
+        {
+            TreeView->RebuildList();
+        }
+        
+        // 임포트 상태가 바뀌었으므로 다중 선택 집계 재계산
+        if (MetadataWidget.IsValid())
+        {
+            MetadataWidget->InvalidateSelectionStats();
+        }
     }
 }
 
@@ -1168,6 +1834,9 @@ bool SLevelBasedTreeView::SelectNodeByPartNo(const FString& PartNo)
     TreeView->SetItemSelection(Item, true);
     TreeView->RequestScrollIntoView(Item);
     
+    // 선택 캐시 갱신 (선택 이벤트가 지연되어도 메타데이터 조회가 즉시 반영되도록)
+    UpdateSelectionCache(Item);
+    
     // 노드 정보 로그 출력
     UE_LOG(LogTemp, Display, TEXT("파트 번호 '%s'에 해당하는 노드를 선택했습니다. (PartNo=%s, Level=%d)"), 
            *PartNo, *Item->PartNo, Item->Level);
@@ -1180,6 +1849,572 @@ bool SLevelBasedTreeView::SelectNodeByPartNo(const FString& PartNo)
     
     return true;
 }
+
+// 특정 인스턴스 노드 선택 함수
+bool SLevelBasedTreeView::SelectItemInstance(const TSharedPtr<FPartTreeItem>& Item)
+{
+    if (!TreeView.IsValid() || !Item.IsValid())
+        return false;
+    
+    // 파트 번호 맵은 마지막 인스턴스만 가지므로 인덱스의 실제 상위 경로를 위에서부터 펼침
+    TArray<TSharedPtr<FPartTreeItem>> Ancestors;
+    if (FuzzyIndex.IsValid())
+    {
+        FuzzyIndex->GetAncestors(Item.Get(), Ancestors);
+    }
+    for (const TSharedPtr<FPartTreeItem>& Ancestor : Ancestors)
+    {
+        SetItemExpansion(Ancestor, true);
+    }
+    
+    // 검색이나 필터로 숨겨진 항목은 선택할 수 없음
+    if (FindRowIndex(Item) == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("검색 또는 필터로 숨겨진 노드는 선택할 수 없습니다: %s"), *Item->PartNo);
+        return false;
+    }
+    
+    TreeView->ClearSelection();
+    TreeView->SetItemSelection(Item, true);
+    TreeView->RequestScrollIntoView(Item);
+    
+    // 선택 캐시 갱신 (선택 이벤트가 지연되어도 메타데이터 조회가 즉시 반영되도록)
+    UpdateSelectionCache(Item);
+    
+    if (MetadataWidget.IsValid())
+    {
+        MetadataWidget->SetSelectedItem(Item);
+    }
+    
+    return true;
+}
+
+// 파트 찾기 팝업 열기 함수
+void SLevelBasedTreeView::OpenFuzzyFinder()
+{
+    if (!FuzzyIndex.IsValid() || FuzzyIndex->Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("로드된 BOM이 없어 파트 찾기를 열 수 없습니다."));
+        return;
+    }
+    
+    // 이미 열려 있으면 닫고 새로 열기
+    if (TSharedPtr<IMenu> OpenMenu = FuzzyFinderMenu.Pin())
+    {
+        OpenMenu->Dismiss();
+    }
+    
+    TSharedRef<SPartFuzzyFinder> Finder = SNew(SPartFuzzyFinder)
+        .FuzzyIndex(FuzzyIndex)
+        .OnPartChosen_Lambda([this](TSharedPtr<FPartTreeItem> Item)
+        {
+            if (TSharedPtr<IMenu> OpenMenu = FuzzyFinderMenu.Pin())
+            {
+                OpenMenu->Dismiss();
+            }
+            SelectItemInstance(Item);
+            FSlateApplication::Get().SetKeyboardFocus(TreeView, EFocusCause::SetDirectly);
+        })
+        .OnCancelled_Lambda([this]()
+        {
+            if (TSharedPtr<IMenu> OpenMenu = FuzzyFinderMenu.Pin())
+            {
+                OpenMenu->Dismiss();
+            }
+        });
+    
+    // 트리뷰 상단에 팝업 표시
+    const FVector2D PopupPosition = GetCachedGeometry().GetAbsolutePosition() + FVector2D(16.0f, 16.0f);
+    FuzzyFinderMenu = FSlateApplication::Get().PushMenu(
+        AsShared(),
+        FWidgetPath(),
+        Finder,
+        PopupPosition,
+        FPopupTransitionEffect(FPopupTransitionEffect::TypeInPopup),
+        true);
+    
+    FSlateApplication::Get().SetKeyboardFocus(Finder->GetWidgetToFocus(), EFocusCause::SetDirectly);
+}
+
+// 근접 파트 선택 함수
+int32 SLevelBasedTreeView::SelectPartsNear(const TSharedPtr<FPartTreeItem>& SourceItem, float RadiusMm)
+{
+    if (!SourceItem.IsValid() || !TreeView.IsValid())
+        return 0;
+    
+    // 기준 노드의 캐시된 하위 트리 바운딩 박스
+    FPartBoundsHierarchy& BoundsHierarchy = FPartBoundsHierarchy::Get();
+    const FBox SourceBounds = BoundsHierarchy.GetBounds(SourceItem->PartNo);
+    if (!SourceBounds.IsValid)
+    {
+        FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("'%s' 노드에 임포트된 형상이 없습니다."), *SourceItem->PartNo)));
+        Info.ExpireDuration = 4.0f;
+        FSlateNotificationManager::Get().AddNotification(Info);
+        return 0;
+    }
+    
+    // 옥트리 질의 (mm -> 언리얼 단위 cm)
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<FString> NearPartNos;
+    BoundsHierarchy.FindPartsIntersecting(SourceBounds, NearPartNos, RadiusMm * 0.1f);
+    const double QueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // 기준 노드와 하위 노드는 제외
+    TSet<FString> SourceSubtree;
+    TArray<const FPartTreeItem*> Stack;
+    Stack.Add(SourceItem.Get());
+    while (Stack.Num() > 0)
+    {
+        const FPartTreeItem* Current = Stack.Pop(EAllowShrinking::No);
+        SourceSubtree.Add(Current->PartNo);
+        for (const TSharedPtr<FPartTreeItem>& Child : Current->Children)
+        {
+            if (Child.IsValid())
+            {
+                Stack.Add(Child.Get());
+            }
+        }
+    }
+    
+    // 결과 노드 선택 및 강조
+    ProximityHighlightPartNos.Empty();
+    TreeView->ClearSelection();
+    
+    TArray<TSharedPtr<FPartTreeItem>> NearItems;
+    for (const FString& PartNo : NearPartNos)
+    {
+        if (SourceSubtree.Contains(PartNo))
+            continue;
+        
+        TSharedPtr<FPartTreeItem> Item = PartNoToItemMap.FindRef(PartNo);
+        if (!Item.IsValid())
+            continue;
+        
+        ProximityHighlightPartNos.Add(PartNo);
+        ExpandPathToItem(Item);
+        NearItems.Add(Item);
+    }
+    
+    // 결과 전체를 한 번에 선택 (선택 변경 이벤트와 지연 형상 요청이 결과 수만큼 발생하지 않도록)
+    if (NearItems.Num() > 0)
+    {
+        TreeView->SetItemSelection(MakeArrayView(NearItems), true, ESelectInfo::Direct);
+        TreeView->RequestScrollIntoView(NearItems[0]);
+    }
+    
+    // 강조 색상 반영을 위해 행 다시 생성
+    TreeView->RebuildList();
+    
+    const int32 FoundCount = ProximityHighlightPartNos.Num();
+    UE_LOG(LogTemp, Display, TEXT("근접 파트 질의: '%s' 기준 %.1fmm 이내 %d개 (질의 %.2fms)"), 
+           *SourceItem->PartNo, RadiusMm, FoundCount, QueryMs);
+    
+    FNotificationInfo Info(FText::FromString(FString::Printf(
+        TEXT("'%s' 주변 %.0fmm 이내 파트 %d개 선택"), *SourceItem->PartNo, RadiusMm, FoundCount)));
+    Info.ExpireDuration = 4.0f;
+    FSlateNotificationManager::Get().AddNotification(Info);
+    
+    return FoundCount;
+}
+
+// 근접 파트 강조 해제 함수
+void SLevelBasedTreeView::ClearProximityHighlight()
+{
+    if (ProximityHighlightPartNos.Num() == 0)
+        return;
+    
+    ProximityHighlightPartNos.Empty();
+    if (TreeView.IsValid())
+    {
+        TreeView->RebuildList();
+    }
+}
+
+// 이전 BOM 파일 선택 후 비교
+void SLevelBasedTreeView::PromptCompareWithBom()
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform)
+        return;
+    
+    TArray<FString> SelectedFiles;
+    const bool bOpened = DesktopPlatform->OpenFileDialog(
+        FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+        TEXT("Select Previous BOM CSV"),
+        FPaths::GetPath(LoadedBomFilePath),
+        TEXT(""),
+        TEXT("CSV files (*.csv)|*.csv"),
+        EFileDialogFlags::None,
+        SelectedFiles);
+    
+    if (bOpened && SelectedFiles.Num() > 0)
+    {
+        CompareWithBom(SelectedFiles[0]);
+    }
+}
+
+// BOM 비교 함수
+bool SLevelBasedTreeView::CompareWithBom(const FString& OldFilePath)
+{
+    if (!TreeView.IsValid())
+        return false;
+    
+    // 이전 BOM은 트리뷰와 같은 로더로 읽고, 새 BOM은 현재 로드된 모델을 그대로 사용
+    TMap<FString, TSharedPtr<FPartTreeItem>> OldPartNoToItemMap;
+    TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> OldLevelToItemsMap;
+    TArray<TSharedPtr<FPartTreeItem>> OldRootItems;
+    int32 OldMaxLevel = 0;
+    if (!FTreeViewUtils::LoadBomTree(OldFilePath, OldPartNoToItemMap, OldLevelToItemsMap, OldMaxLevel, OldRootItems))
+    {
+        FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("이전 BOM을 읽을 수 없습니다: %s"), *OldFilePath)));
+        Info.ExpireDuration = 4.0f;
+        FSlateNotificationManager::Get().AddNotification(Info);
+        return false;
+    }
+    
+    TSharedPtr<FBomDiffResult> Result = MakeShared<FBomDiffResult>();
+    FBomDiff::DiffTrees(OldLevelToItemsMap, OldPartNoToItemMap, LevelToItemsMap, PartNoToItemMap, *Result);
+    BomDiffResult = Result;
+    
+    // 변경 노드까지 경로의 상위 노드를 모아 한 번에 펼치기 (펼침이 과도하지 않도록 상한)
+    const int32 MaxExpandedPaths = 500;
+    int32 ExpandedPaths = 0;
+    TSet<TSharedPtr<FPartTreeItem>> PathItems;
+    for (const TPair<FString, EBomDiffFlags>& PartFlag : Result->PartFlags)
+    {
+        if (ExpandedPaths >= MaxExpandedPaths)
+            break;
+        
+        if (TSharedPtr<FPartTreeItem> Item = PartNoToItemMap.FindRef(PartFlag.Key))
+        {
+            for (TSharedPtr<FPartTreeItem> Parent = FTreeViewUtils::FindParentItem(Item, PartNoToItemMap);
+                 Parent.IsValid() && !PathItems.Contains(Parent);
+                 Parent = FTreeViewUtils::FindParentItem(Parent, PartNoToItemMap))
+            {
+                PathItems.Add(Parent);
+            }
+            ++ExpandedPaths;
+        }
+    }
+    
+    // 보이는 행 재구성 시 비교 색상 반영을 위해 행도 다시 생성됨
+    SetItemsExpansion(PathItems.Array(), true);
+    
+    FNotificationInfo Info(FText::FromString(FString::Printf(
+        TEXT("BOM 비교: 추가 %d, 삭제 %d, 이동 %d, 개정 %d, 수량 변경 %d (%.2f초)"),
+        Result->Count(EBomDiffFlags::Added), Result->Count(EBomDiffFlags::Removed), Result->Count(EBomDiffFlags::Moved),
+        Result->Count(EBomDiffFlags::Revised), Result->Count(EBomDiffFlags::QuantityChanged), Result->Seconds)));
+    Info.ExpireDuration = 6.0f;
+    FSlateNotificationManager::Get().AddNotification(Info);
+    
+    return true;
+}
+
+// BOM 비교 표시 해제 함수
+void SLevelBasedTreeView::ClearBomDiff()
+{
+    if (!BomDiffResult.IsValid())
+        return;
+    
+    BomDiffResult.Reset();
+    if (TreeView.IsValid())
+    {
+        TreeView->RebuildList();
+    }
+}
+// BOM 파일 디렉토리 감시 시작
+void SLevelBasedTreeView::StartWatchingBomFile()
+{
+    const FString Directory = FPaths::GetPath(FPaths::ConvertRelativePathToFull(LoadedBomFilePath));
+    if (BomWatcherHandle.IsValid() || Directory.IsEmpty() || !IFileManager::Get().DirectoryExists(*Directory))
+        return;
+    
+    FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+    if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+    {
+        WatchedBomDirectory = Directory;
+        DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+            WatchedBomDirectory,
+            IDirectoryWatcher::FDirectoryChanged::CreateSP(this, &SLevelBasedTreeView::OnBomDirectoryChanged),
+            BomWatcherHandle,
+            0);
+        
+        UE_LOG(LogTemp, Display, TEXT("BOM 파일 감시 시작: %s"), *LoadedBomFilePath);
+    }
+}
+
+// BOM 파일 감시 해제
+void SLevelBasedTreeView::StopWatchingBomFile()
+{
+    if (BomReloadTimerHandle.IsValid())
+    {
+        UnRegisterActiveTimer(BomReloadTimerHandle.ToSharedRef());
+        BomReloadTimerHandle.Reset();
+    }
+    
+    if (!BomWatcherHandle.IsValid())
+        return;
+    
+    if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+    {
+        if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+        {
+            DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedBomDirectory, BomWatcherHandle);
+        }
+    }
+    BomWatcherHandle.Reset();
+    WatchedBomDirectory.Empty();
+}
+
+// BOM 디렉토리 변경 콜백
+void SLevelBasedTreeView::OnBomDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+    // 파일 교체는 삭제 + 추가(이름 변경)로 올 수 있으므로 삭제 외 모든 변경을 대상으로 함
+    const bool bBomChanged = FileChanges.ContainsByPredicate([this](const FFileChangeData& Change)
+    {
+        return Change.Action != FFileChangeData::FCA_Removed
+            && FPaths::IsSamePath(FPaths::ConvertRelativePathToFull(Change.Filename), FPaths::ConvertRelativePathToFull(LoadedBomFilePath));
+    });
+    
+    if (!bBomChanged)
+        return;
+    
+    // 저장 중 연속 알림을 묶기 위해 타이머 재시작
+    if (BomReloadTimerHandle.IsValid())
+    {
+        UnRegisterActiveTimer(BomReloadTimerHandle.ToSharedRef());
+    }
+    BomReloadTimerHandle = RegisterActiveTimer(0.5f, FWidgetActiveTimerDelegate::CreateSP(this, &SLevelBasedTreeView::OnBomReloadTimer));
+}
+
+// 지연 타이머 만료: 증분 갱신
+EActiveTimerReturnType SLevelBasedTreeView::OnBomReloadTimer(double InCurrentTime, float InDeltaTime)
+{
+    BomReloadTimerHandle.Reset();
+    ReloadBomIncremental();
+    return EActiveTimerReturnType::Stop;
+}
+
+// BOM 증분 갱신 함수
+bool SLevelBasedTreeView::ReloadBomIncremental()
+{
+    if (LoadedBomFilePath.IsEmpty() || !TreeView.IsValid())
+        return false;
+    
+    // 보이는 행은 이전 루트 기준이므로 비교용으로 보관
+    const TArray<TSharedPtr<FPartTreeItem>> PreviousRootItems = AllRootItems;
+    
+    FBomPatchStats Stats;
+    if (!FTreeViewUtils::PatchBomTree(LoadedBomFilePath, PartNoToItemMap, LevelToItemsMap, MaxLevel, AllRootItems, Stats))
+    {
+        // 저장 도중 읽으면 실패할 수 있음 (다음 변경 알림에서 다시 시도)
+        UE_LOG(LogTemp, Warning, TEXT("BOM 파일을 다시 읽을 수 없습니다: %s"), *LoadedBomFilePath);
+        return false;
+    }
+    
+    if (!Stats.HasChanges())
+        return false;
+    
+    // 이후 상태 저장은 새 BOM 기준
+    LoadedBomHash = FTreeViewStateStore::ComputeBomHash(LoadedBomFilePath);
+    
+    // 구조가 바뀐 경우에만 계층 기반 캐시 재구성
+    if (Stats.bStructureChanged)
+    {
+        FPartBoundsHierarchy::Get().SetPartTree(AllRootItems);
+        FAssemblyStreamingManager::Get().SetPartTree(AllRootItems);
+    }
+    
+    // 항목이 추가/삭제되거나 파트 번호가 바뀌었을 수 있으므로 하위 트리 파일 플래그 무효화
+    if (FPartFileIndex* CADFileIndex = FServiceLocator::GetCADFileIndex())
+    {
+        CADFileIndex->SetPartTree(AllRootItems);
+    }
+    
+    // 퍼지 검색 인덱스 재구성 (항목 객체와 상위 경로가 바뀌었을 수 있음)
+    if (FuzzyIndex.IsValid())
+    {
+        FuzzyIndex->Build(AllRootItems);
+    }
+    
+    // 새 파트의 이미지 존재 여부 캐싱
+    if (Stats.AddedCount > 0)
+    {
+        FServiceLocator::GetImageManager()->CacheImageExistence(PartNoToItemMap);
+    }
+    
+    // 비교 결과는 이전 모델 기준이므로 해제
+    BomDiffResult.Reset();
+    
+    // 삭제된 항목의 펼침 상태 제거
+    for (const TSharedPtr<FPartTreeItem>& Item : Stats.RemovedItems)
+    {
+        ExpandedItems.Remove(Item);
+    }
+    
+    // 검색 중이면 결과 경로 다시 계산
+    if (bIsSearching && !SearchText.IsEmpty())
+    {
+        RebuildSearchPaths();
+    }
+    
+    // 삭제된 항목을 검색 결과와 선택에서 제거
+    if (Stats.RemovedItems.Num() > 0)
+    {
+        const TSet<TSharedPtr<FPartTreeItem>> RemovedSet(Stats.RemovedItems);
+        SearchResults.RemoveAll([&RemovedSet](const TSharedPtr<FPartTreeItem>& Item)
+        {
+            return RemovedSet.Contains(Item);
+        });
+        
+        for (const TSharedPtr<FPartTreeItem>& Item : TreeView->GetSelectedItems())
+        {
+            if (RemovedSet.Contains(Item))
+            {
+                TreeView->SetItemSelection(Item, false);
+            }
+        }
+        
+        if (RemovedSet.Contains(CachedSelectedItem))
+        {
+            CachedSelectedItem.Reset();
+        }
+    }
+    
+    // 선택 항목 메타데이터와 선택 집계 다시 계산
+    const TSharedPtr<FPartTreeItem> PreviousSelection = CachedSelectedItem;
+    CachedSelectedItem.Reset();
+    UpdateSelectionCache(PreviousSelection);
+    
+    TArray<TSharedPtr<FPartTreeItem>> SelectedItems = TreeView->GetSelectedItems();
+    if (MetadataWidget.IsValid() && SelectedItems.Num() > 0)
+    {
+        if (PreviousSelection.IsValid() && SelectedItems.Remove(PreviousSelection) > 0)
+        {
+            SelectedItems.Insert(PreviousSelection, 0);
+        }
+        MetadataWidget->SetSelectedItems(SelectedItems);
+    }
+    
+    // 구조가 바뀌면 바뀐 하위 트리만 갱신, 값만 바뀌면 행 위젯만 다시 생성 (펼침/스크롤 유지)
+    if (Stats.bStructureChanged)
+    {
+        RefreshVisibleRows(PreviousRootItems);
+    }
+    else
+    {
+        TreeView->RebuildList();
+    }
+    
+    FNotificationInfo Info(FText::FromString(FString::Printf(
+        TEXT("BOM 갱신: 추가 %d, 삭제 %d, 변경 %d (%.0fms)"),
+        Stats.AddedCount, Stats.RemovedCount, Stats.UpdatedCount, Stats.Seconds * 1000.0)));
+    Info.ExpireDuration = 4.0f;
+    FSlateNotificationManager::Get().AddNotification(Info);
+    
+    return true;
+}
+// 트리뷰 상태 저장 함수
+void SLevelBasedTreeView::SaveTreeState()
+{
+    if (!TreeView.IsValid() || LoadedBomHash.IsEmpty())
+        return;
+    
+    const TSet<TSharedPtr<FPartTreeItem>> SelectedItems(TreeView->GetSelectedItems());
+    
+    // 전위 순회 한 번으로 펼침/선택 노드의 행 번호 수집
+    TArray<TSharedPtr<FPartTreeItem>> Rows;
+    FTreeViewStateStore::FlattenPreOrder(AllRootItems, Rows);
+    
+    FTreeViewSavedState State;
+    for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+    {
+        if (ExpandedItems.Contains(Rows[RowIndex]))
+        {
+            State.ExpandedRows.Add(RowIndex);
+        }
+        if (SelectedItems.Contains(Rows[RowIndex]))
+        {
+            State.SelectedRows.Add(RowIndex);
+        }
+    }
+    
+    State.ScrollOffset = TreeView->GetScrollOffset();
+    State.SearchText = bIsSearching ? SearchText : FString();
+    
+    for (const TSharedPtr<IPartTreeViewFilter>& Filter : FilterManager->GetFilters())
+    {
+        if (Filter.IsValid() && Filter->IsEnabled())
+        {
+            State.EnabledFilters.Add(Filter->GetFilterName());
+        }
+    }
+    
+    FTreeViewStateStore::Save(LoadedBomHash, State);
+}
+
+// 트리뷰 상태 복원 함수
+bool SLevelBasedTreeView::RestoreTreeState()
+{
+    if (!TreeView.IsValid())
+        return false;
+    
+    FTreeViewSavedState State;
+    if (!FTreeViewStateStore::Load(LoadedBomHash, State))
+        return false;
+    
+    TArray<TSharedPtr<FPartTreeItem>> Rows;
+    FTreeViewStateStore::FlattenPreOrder(AllRootItems, Rows);
+    
+    TGuardValue<bool> RestoreGuard(bRestoringTreeState, true);
+    
+    // 필터 (체크박스는 검색 위젯 생성 시 필터 상태를 읽음)
+    for (const FString& FilterName : State.EnabledFilters)
+    {
+        FilterManager->SetFilterEnabled(FilterName, true);
+    }
+    
+    // 검색어 (저장된 선택을 유지하도록 첫 번째 결과 자동 선택 없이)
+    if (!State.SearchText.IsEmpty())
+    {
+        SearchText = State.SearchText;
+        bIsSearching = true;
+        PerformSearch(SearchText, false);
+    }
+    
+    // 펼침: 기본 루트 펼침을 지우고 저장된 노드를 한 번에 설정한 뒤 보이는 행은 한 번만 구성
+    ExpandedItems.Empty();
+    TArray<TSharedPtr<FPartTreeItem>> ItemsToExpand;
+    for (int32 RowIndex : State.ExpandedRows)
+    {
+        if (Rows.IsValidIndex(RowIndex))
+        {
+            ItemsToExpand.Add(Rows[RowIndex]);
+        }
+    }
+    SetItemsExpansion(ItemsToExpand, true);
+    
+    // 선택
+    TArray<TSharedPtr<FPartTreeItem>> SelectedItems;
+    for (int32 RowIndex : State.SelectedRows)
+    {
+        if (Rows.IsValidIndex(RowIndex))
+        {
+            SelectedItems.Add(Rows[RowIndex]);
+        }
+    }
+    if (SelectedItems.Num() > 0)
+    {
+        TreeView->SetItemSelection(SelectedItems, true);
+    }
+    
+    TreeView->SetScrollOffset(State.ScrollOffset);
+    
+    UE_LOG(LogTemp, Display, TEXT("트리뷰 상태 복원: 펼침 %d, 선택 %d, 필터 %d, 검색어 '%s'"),
+        State.ExpandedRows.Num(), SelectedItems.Num(), State.EnabledFilters.Num(), *State.SearchText);
+    
+    return true;
+}
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 // 트리뷰 위젯 생성 헬퍼 함수
@@ -0,0 +1,223 @@
+﻿// PartFuzzyFinder.cpp
+// Ctrl+P 파트 찾기 팝업 위젯 구현
+
+#include "UI/PartFuzzyFinder.h"
+
+#include "SlateOptMacros.h"
+#include "Styling/AppStyle.h"
+#include "UI/PartTreeItem.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
+
+void SPartFuzzyFinder::Construct(const FArguments& InArgs)
+{
+	FuzzyIndex = InArgs._FuzzyIndex;
+	MaxResults = InArgs._MaxResults;
+	OnPartChosen = InArgs._OnPartChosen;
+	OnCancelled = InArgs._OnCancelled;
+
+	ChildSlot
+	[
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("Menu.Background"))
+		.Padding(FMargin(4.0f))
+		[
+			SNew(SBox)
+			.WidthOverride(560.0f)
+			.MaxDesiredHeight(520.0f)
+			[
+				SNew(SVerticalBox)
+
+				// 검색창
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(2)
+				[
+					SAssignNew(SearchBox, SSearchBox)
+					.HintText(FText::FromString("Find part by number or name..."))
+					.OnTextChanged(this, &SPartFuzzyFinder::OnQueryChanged)
+					.OnKeyDownHandler(this, &SPartFuzzyFinder::OnSearchBoxKeyDown)
+				]
+
+				// 상태 (결과 수, 질의 시간)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(4, 0, 4, 2)
+				[
+					SNew(STextBlock)
+					.Text(this, &SPartFuzzyFinder::GetStatusText)
+					.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+				]
+
+				// 결과 목록
+				+ SVerticalBox::Slot()
+				.FillHeight(1.0f)
+				.Padding(2)
+				[
+					SAssignNew(ResultListView, SListView<TSharedPtr<FPartFuzzyMatch>>)
+					.ListItemsSource(&Results)
+					.SelectionMode(ESelectionMode::Single)
+					.OnGenerateRow(this, &SPartFuzzyFinder::OnGenerateResultRow)
+					.OnMouseButtonClick(this, &SPartFuzzyFinder::OnResultClicked)
+				]
+			]
+		]
+	];
+}
+
+TSharedPtr<SWidget> SPartFuzzyFinder::GetWidgetToFocus() const
+{
+	return SearchBox;
+}
+
+void SPartFuzzyFinder::OnQueryChanged(const FText& InText)
+{
+	Results.Reset();
+
+	if (FuzzyIndex.IsValid())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<FPartFuzzyMatch> Matches;
+		FuzzyIndex->Query(InText.ToString(), MaxResults, Matches);
+
+		LastQueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		Results.Reserve(Matches.Num());
+		for (FPartFuzzyMatch& Match : Matches)
+		{
+			Results.Add(MakeShared<FPartFuzzyMatch>(MoveTemp(Match)));
+		}
+	}
+
+	ResultListView->RequestListRefresh();
+
+	// 첫 번째 결과를 기본 선택
+	if (Results.Num() > 0)
+	{
+		ResultListView->SetSelection(Results[0], ESelectInfo::Direct);
+		ResultListView->RequestScrollIntoView(Results[0]);
+	}
+}
+
+FReply SPartFuzzyFinder::OnSearchBoxKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey Key = InKeyEvent.GetKey();
+	if (Key == EKeys::Up)
+	{
+		MoveSelection(-1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Down)
+	{
+		MoveSelection(1);
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Enter)
+	{
+		ChooseSelected();
+		return FReply::Handled();
+	}
+	if (Key == EKeys::Escape)
+	{
+		OnCancelled.ExecuteIfBound();
+		return FReply::Handled();
+	}
+	return FReply::Unhandled();
+}
+
+void SPartFuzzyFinder::MoveSelection(int32 Delta)
+{
+	if (Results.Num() == 0)
+		return;
+
+	const TArray<TSharedPtr<FPartFuzzyMatch>> Selected = ResultListView->GetSelectedItems();
+	const int32 CurrentIndex = Selected.Num() > 0 ? Results.Find(Selected[0]) : INDEX_NONE;
+	const int32 NewIndex = FMath::Clamp(CurrentIndex + Delta, 0, Results.Num() - 1);
+
+	ResultListView->SetSelection(Results[NewIndex], ESelectInfo::Direct);
+	ResultListView->RequestScrollIntoView(Results[NewIndex]);
+}
+
+void SPartFuzzyFinder::ChooseSelected()
+{
+	const TArray<TSharedPtr<FPartFuzzyMatch>> Selected = ResultListView->GetSelectedItems();
+	if (Selected.Num() > 0)
+	{
+		OnResultClicked(Selected[0]);
+	}
+}
+
+void SPartFuzzyFinder::OnResultClicked(TSharedPtr<FPartFuzzyMatch> Match)
+{
+	if (Match.IsValid())
+	{
+		OnPartChosen.ExecuteIfBound(Match->Item);
+	}
+}
+
+FText SPartFuzzyFinder::GetStatusText() const
+{
+	if (!FuzzyIndex.IsValid())
+	{
+		return FText::FromString(TEXT("No BOM loaded"));
+	}
+
+	if (SearchBox.IsValid() && SearchBox->GetText().IsEmpty())
+	{
+		return FText::FromString(FString::Printf(TEXT("%d rows indexed"), FuzzyIndex->Num()));
+	}
+
+	return FText::FromString(FString::Printf(TEXT("%d matches (%.1f ms)"), Results.Num(), LastQueryMs));
+}
+
+TSharedRef<ITableRow> SPartFuzzyFinder::OnGenerateResultRow(TSharedPtr<FPartFuzzyMatch> Match, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const FPartTreeItem& Item = *Match->Item;
+	const FString AncestorPath = FuzzyIndex.IsValid() ? FuzzyIndex->GetAncestorPath(&Item) : FString();
+
+	// 파트 번호 + 명칭, 아래 줄에 상위 경로 (인스턴스 구분)
+	return SNew(STableRow<TSharedPtr<FPartFuzzyMatch>>, OwnerTable)
+		.Padding(FMargin(4, 2))
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(Item.PartNo))
+					.Font(FCoreStyle::GetDefaultFontStyle(Match->bMatchedNomenclature ? "Regular" : "Bold", 10))
+				]
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				.Padding(FMargin(8, 0, 0, 0))
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(Item.Nomenclature))
+					.Font(FCoreStyle::GetDefaultFontStyle(Match->bMatchedNomenclature ? "Bold" : "Regular", 9))
+					.OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(AncestorPath.IsEmpty() ? FString(TEXT("(root)")) : AncestorPath))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+				.OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+			]
+		];
+}
+
+END_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -10,6 +10,7 @@
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/Paths.h"
+#include "PartFileIndex.h"
 
 FPartImageManager::FPartImageManager()
     : bIsInitialized(false)
@@ -51,27 +52,24 @@ void FPartImageManager::CacheImageExistence(const TMap<FString, TSharedPtr<FPart
         return;
     }
     
-    // 폴더 내 모든 uasset 파일 찾기
-    TArray<FString> FoundFiles;
-    PlatformFile.FindFilesRecursively(FoundFiles, *PhysicalImageDir, TEXT(".uasset"));
+    // 폴더를 한 번 열거하여 파트 번호 -> uasset 파일 인덱스 구성 (3DXML 파일 인덱스와 같은 규칙)
+    FPartFileIndex ImageFileIndex(PhysicalImageDir, TEXT("*.uasset"), 3, true);
+    const TMap<FString, FString>& IndexedFiles = ImageFileIndex.GetAllFiles();
     
-    UE_LOG(LogTemp, Display, TEXT("이미지 캐싱 시작: 총 %d개 uasset 파일 발견"), FoundFiles.Num());
+    UE_LOG(LogTemp, Display, TEXT("이미지 캐싱 시작: 파트 번호가 있는 uasset 파일 %d개 발견"), IndexedFiles.Num());
     
-    // 모든 uasset 파일 처리
-    for (const FString& FilePath : FoundFiles)
+    const FString ContentDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir());
+    
+    for (const TPair<FString, FString>& Pair : IndexedFiles)
     {
-        // 파일 이름에서 확장자 제거
-        FString FileName = FPaths::GetBaseFilename(FilePath);
-        
-        // TreeViewUtils를 사용하여 파일 이름에서 파트 번호 추출
-        FString PartNo = FTreeViewUtils::ExtractPartNoFromAssetName(FileName);
+        const FString& PartNo = Pair.Key;
         
-        // 파트 번호가 유효하고 맵에 존재하는지 확인
-        if (!PartNo.IsEmpty() && PartNoToItemMap.Contains(PartNo))
+        // 파트 번호가 맵에 존재하는지 확인
+        if (PartNoToItemMap.Contains(PartNo))
         {
             // 상대 에셋 경로 생성 (/Game/...)
-            FString RelativePath = FilePath;
-            FPaths::MakePathRelativeTo(RelativePath, *FPaths::ProjectContentDir());
+            FString RelativePath = Pair.Value;
+            FPaths::MakePathRelativeTo(RelativePath, *ContentDir);
             RelativePath = RelativePath.Replace(TEXT(".uasset"), TEXT(""));
             FString AssetPath = FString::Printf(TEXT("/Game/%s"), *RelativePath);
             AssetPath = AssetPath.Replace(TEXT("\\"), TEXT("/"));
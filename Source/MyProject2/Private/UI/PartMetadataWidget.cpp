@@ -13,7 +13,8 @@ BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SPartMetadataWidget::Construct(const FArguments& InArgs)
 {
-    // 기본 이미지 브러시 초기화
+    // 기본 이미지 브러시 및 메타데이터 캐시 초기화
+    CachedMetadataText = FText::FromString("No item selected");
     CurrentImageBrush = FServiceLocator::GetImageManager()->CreateImageBrush(nullptr);
 
     // 위젯 구성
@@ -74,14 +75,69 @@ void SPartMetadataWidget::Construct(const FArguments& InArgs)
             [
                 GetMetadataWidget()
             ]
+            
+            // 다중 선택 집계 섹션 (2개 이상 선택 시에만 표시)
+            + SScrollBox::Slot()
+            .Padding(0, 16, 0, 2)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString("Selection Summary"))
+                .Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+                .Visibility_Lambda([this]() {
+                    return SelectedItems.Num() > 1 ? EVisibility::Visible : EVisibility::Collapsed;
+                })
+            ]
+            + SScrollBox::Slot()
+            [
+                SAssignNew(SelectionStatsBox, SVerticalBox)
+                .Visibility_Lambda([this]() {
+                    return SelectedItems.Num() > 1 ? EVisibility::Visible : EVisibility::Collapsed;
+                })
+            ]
         ]
     ];
+
+    // 선택 없음 상태의 그리드 구성
+    UpdateMetadata();
+}
+
+void SPartMetadataWidget::SetSelectedItems(const TArray<TSharedPtr<FPartTreeItem>>& InSelectedItems)
+{
+    // 첫 번째 항목은 상세 정보 표시
+    SetSelectedItem(InSelectedItems.Num() > 0 ? InSelectedItems[0] : nullptr);
+    
+    // 선택 목록이 바뀌면 집계 캐시 무효화 후 재계산
+    if (SelectedItems != InSelectedItems)
+    {
+        SelectedItems = InSelectedItems;
+        InvalidateSelectionStats();
+    }
+}
+
+void SPartMetadataWidget::InvalidateSelectionStats()
+{
+    bSelectionStatsValid = false;
+    UpdateSelectionStats();
 }
 
 void SPartMetadataWidget::SetSelectedItem(TSharedPtr<FPartTreeItem> InSelectedItem)
 {
+    // 같은 항목이 다시 전달되면 캐시를 그대로 사용
+    if (SelectedItem == InSelectedItem)
+    {
+        return;
+    }
+    
     SelectedItem = InSelectedItem;
     UpdateImage();
+    UpdateMetadata();
+    
+    // 단일 선택으로 바뀐 경우 다중 선택 목록 정리
+    if (SelectedItems.Num() > 1 && !SelectedItems.Contains(InSelectedItem))
+    {
+        SelectedItems.Reset();
+        InvalidateSelectionStats();
+    }
 }
 
 TSharedRef<SWidget> SPartMetadataWidget::GetImageWidget()
@@ -119,10 +175,8 @@ TSharedRef<SWidget> SPartMetadataWidget::GetImageWidget()
 
 TSharedRef<SWidget> SPartMetadataWidget::GetMetadataWidget()
 {
-    // 메타데이터 표시를 위한 텍스트 블록 생성
-    return SNew(STextBlock)
-        .Text(TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateSP(this, &SPartMetadataWidget::GetSelectedItemMetadata)))
-        .AutoWrapText(true);
+    // 메타데이터 속성 그리드 생성 (행은 UpdateMetadata에서 선택 변경 시에만 구성)
+    return SAssignNew(MetadataGridBox, SVerticalBox);
 }
 
 void SPartMetadataWidget::UpdateImage()
@@ -144,15 +198,114 @@ void SPartMetadataWidget::UpdateImage()
     ItemImageWidget->SetImage(CurrentImageBrush.Get());
 }
 
-FText SPartMetadataWidget::GetSelectedItemMetadata() const
+void SPartMetadataWidget::UpdateMetadata()
 {
+    // 텍스트 캐시 갱신 (선택 변경 시 한 번만 형식화)
+    CachedMetadataText = FTreeViewUtils::GetFormattedMetadata(SelectedItem);
+    
+    if (!MetadataGridBox.IsValid())
+    {
+        return;
+    }
+    
+    MetadataGridBox->ClearChildren();
+    
     if (!SelectedItem.IsValid())
     {
-        return FText::FromString("No item selected");
+        MetadataGridBox->AddSlot()
+        .AutoHeight()
+        [
+            SNew(STextBlock)
+            .Text(CachedMetadataText)
+        ];
+        return;
+    }
+    
+    // 속성 그리드 행 구성 - 모든 텍스트는 정적 값으로 설정되어 페인트마다 다시 계산되지 않음
+    TArray<TPair<FString, FString>> Fields;
+    FTreeViewUtils::GetMetadataFields(SelectedItem, Fields);
+    
+    for (const TPair<FString, FString>& Field : Fields)
+    {
+        AddGridRow(MetadataGridBox, Field.Key, Field.Value);
+    }
+}
+
+void SPartMetadataWidget::UpdateSelectionStats()
+{
+    if (!SelectionStatsBox.IsValid())
+    {
+        return;
     }
     
-    // 유틸 클래스의 함수 사용
-    return FTreeViewUtils::GetFormattedMetadata(SelectedItem);
+    SelectionStatsBox->ClearChildren();
+    
+    // 단일 선택이면 집계 불필요
+    if (SelectedItems.Num() <= 1)
+    {
+        CachedSelectionStats = FPartSelectionStats();
+        bSelectionStatsValid = true;
+        return;
+    }
+    
+    // 캐시가 무효화된 경우에만 병렬 집계 수행
+    if (!bSelectionStatsValid)
+    {
+        FTreeViewUtils::ComputeSelectionStats(SelectedItems, CachedSelectionStats);
+        bSelectionStatsValid = true;
+    }
+    
+    const FPartSelectionStats& Stats = CachedSelectionStats;
+    const float TotalNodes = FMath::Max(1, Stats.TotalNodeCount);
+    
+    AddGridRow(SelectionStatsBox, TEXT("Selected"), FString::FromInt(Stats.SelectedCount));
+    AddGridRow(SelectionStatsBox, TEXT("Nodes (incl. subtrees)"), FString::FromInt(Stats.TotalNodeCount));
+    AddGridRow(SelectionStatsBox, TEXT("Rolled-up Qty"), FString::Printf(TEXT("%.0f"), Stats.TotalRolledUpQty));
+    AddGridRow(SelectionStatsBox, TEXT("Imported"), FString::Printf(TEXT("%d / %d (not imported %d)"),
+        Stats.ImportedCount, Stats.TotalNodeCount, Stats.TotalNodeCount - Stats.ImportedCount));
+    AddGridRow(SelectionStatsBox, TEXT("Image coverage"), FString::Printf(TEXT("%d / %d (%.1f%%)"),
+        Stats.WithImageCount, Stats.TotalNodeCount, Stats.WithImageCount / TotalNodes * 100.0f));
+    
+    for (const TPair<FString, int32>& Pair : Stats.TypeCounts)
+    {
+        AddGridRow(SelectionStatsBox, FString::Printf(TEXT("Type: %s"), *Pair.Key), FString::FromInt(Pair.Value));
+    }
+    
+    for (const TPair<FString, int32>& Pair : Stats.StatusCounts)
+    {
+        AddGridRow(SelectionStatsBox, FString::Printf(TEXT("Status: %s"), *Pair.Key), FString::FromInt(Pair.Value));
+    }
+}
+
+void SPartMetadataWidget::AddGridRow(const TSharedPtr<SVerticalBox>& GridBox, const FString& Label, const FString& Value)
+{
+    if (!GridBox.IsValid())
+    {
+        return;
+    }
+    
+    GridBox->AddSlot()
+    .AutoHeight()
+    .Padding(0, 1)
+    [
+        SNew(SHorizontalBox)
+        + SHorizontalBox::Slot()
+        .FillWidth(0.4f)
+        .VAlign(VAlign_Top)
+        [
+            SNew(STextBlock)
+            .Text(FText::FromString(Label))
+            .Font(FCoreStyle::GetDefaultFontStyle("Bold", 9))
+        ]
+        + SHorizontalBox::Slot()
+        .FillWidth(0.6f)
+        .VAlign(VAlign_Top)
+        [
+            SNew(STextBlock)
+            .Text(FText::FromString(Value))
+            .AutoWrapText(true)
+        ]
+    ];
 }
 
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
\ No newline at end of file
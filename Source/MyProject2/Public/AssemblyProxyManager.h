@@ -0,0 +1,107 @@
+﻿// AssemblyProxyManager.h
+// 임포트된 어셈블리 하위 트리를 병합 프록시 메시(LOD 포함)로 대체하는 관리 클래스
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class AStaticMeshActor;
+class UPrimitiveComponent;
+class UStaticMesh;
+
+/**
+ * 어셈블리 프록시 정보
+ */
+struct FAssemblyProxyInfo
+{
+	/** 프록시 메시 액터 */
+	TWeakObjectPtr<AStaticMeshActor> ProxyActor;
+
+	/** 프록시로 대체된 원본 루트 액터들 */
+	TArray<TWeakObjectPtr<AActor>> SourceRootActors;
+
+	/** 하위 트리 내용 해시 (프록시 에셋 캐시 키) */
+	FString ContentHash;
+
+	/** 현재 프록시 표시 여부 (false면 원본 표시) */
+	bool bProxyShown = false;
+};
+
+/**
+ * 어셈블리 프록시 관리 클래스
+ * 트리 노드 아래 임포트된 액터들의 스태틱 메시를 하나의 메시로 병합하고
+ * LOD를 생성하여 뷰포트 부하를 줄입니다. 원본은 숨겨 두었다가 필요할 때 다시 표시합니다.
+ * 병합 결과는 하위 트리 내용 해시 기준으로 /Game/Proxies 아래에 캐시됩니다.
+ */
+class MYPROJECT2_API FAssemblyProxyManager
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FAssemblyProxyManager& Get();
+
+	/**
+	 * 프록시 생성 (같은 내용 해시의 프록시 에셋이 있으면 재사용)
+	 * @param PartNo - 프록시를 만들 트리 노드의 파트 번호
+	 * @param SourceRootActors - 하위 트리에서 임포트된 루트 액터들
+	 * @return 성공 여부
+	 */
+	bool BuildProxy(const FString& PartNo, const TArray<AActor*>& SourceRootActors);
+
+	/**
+	 * 프록시 존재 여부
+	 * @param PartNo - 파트 번호
+	 * @return 유효한 프록시가 있으면 true
+	 */
+	bool HasProxy(const FString& PartNo) const;
+
+	/**
+	 * 프록시 표시 여부
+	 * @param PartNo - 파트 번호
+	 * @return 프록시가 표시 중이면 true
+	 */
+	bool IsProxyShown(const FString& PartNo) const;
+
+	/**
+	 * 프록시와 원본 전환
+	 * @param PartNo - 파트 번호
+	 * @param bShowProxy - true면 프록시 표시/원본 숨김, false면 원본 표시/프록시 숨김
+	 */
+	void SetProxyShown(const FString& PartNo, bool bShowProxy);
+
+	/**
+	 * 프록시 제거 (원본 표시 후 프록시 액터 삭제, 에셋은 캐시로 유지)
+	 * @param PartNo - 파트 번호
+	 */
+	void RemoveProxy(const FString& PartNo);
+
+	/** 프록시 액터 태그 */
+	static const FName ProxyTag;
+
+private:
+	FAssemblyProxyManager() {}
+
+	/** 루트 액터들과 모든 하위 액터 수집 */
+	static void CollectActorHierarchy(const TArray<AActor*>& RootActors, TArray<AActor*>& OutActors);
+
+	/** 병합 대상 메시 컴포넌트 수집 (숨겨진 컴포넌트 제외) */
+	static void CollectMergeComponents(const TArray<AActor*>& Actors, TArray<UPrimitiveComponent*>& OutComponents);
+
+	/**
+	 * 하위 트리 내용 해시 계산
+	 * 메시/머티리얼 경로와 기준 액터 대비 상대 변환으로 계산하므로 어셈블리를 옮겨도 같은 해시가 나옵니다.
+	 */
+	static FString ComputeContentHash(const TArray<UPrimitiveComponent*>& Components, const FTransform& ReferenceTransform);
+
+	/** 병합 메시에 축소 LOD 생성 */
+	static void GenerateLODs(UStaticMesh* StaticMesh);
+
+	/** 액터들의 에디터/게임 표시 상태 변경 */
+	static void SetActorsHidden(const TArray<AActor*>& Actors, bool bHidden);
+
+	/** 파트 번호 -> 프록시 정보 */
+	TMap<FString, FAssemblyProxyInfo> Proxies;
+
+	/** 싱글톤 인스턴스 */
+	static FAssemblyProxyManager* Instance;
+};
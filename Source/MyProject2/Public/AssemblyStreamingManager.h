@@ -0,0 +1,159 @@
+﻿// AssemblyStreamingManager.h
+// 상위 어셈블리별 스트리밍 서브레벨 관리: 임포트 배치 레벨 결정과 트리뷰에서의 로드/언로드
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ULevel;
+class ULevelStreaming;
+class UWorld;
+struct FPartTreeItem;
+
+/**
+ * 어셈블리 스트리밍 관리 클래스
+ * BOM 트리의 지정 레벨(1 또는 2) 노드를 하나의 셀로 보고, 셀마다 스트리밍 서브레벨
+ * (/Game/Datasmith/Streaming/Cell_<PartNo>)을 만들어 그 아래 파트의 임포트 액터를 배치합니다.
+ * 트리뷰에서 셀을 체크 해제하면 서브레벨을 저장 후 언로드하여 에디터 메모리와 레벨 로드 시간이
+ * 작업 중인 어셈블리에만 비례하도록 합니다.
+ * World Partition 월드는 서브레벨을 지원하지 않으므로 퍼시스턴트 레벨에 그대로 임포트합니다.
+ * 셀 -> 스트리밍 레벨 대응은 캐시하고 월드의 레벨 목록 변경과 맵 열기 때만 다시 계산하므로
+ * 트리뷰 행이 매 프레임 조회해도 해시 조회만 수행합니다.
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+class MYPROJECT2_API FAssemblyStreamingManager
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FAssemblyStreamingManager& Get();
+
+	/** 싱글톤 인스턴스 정리 */
+	static void Shutdown();
+
+	/**
+	 * BOM 트리 구조 설정 (트리뷰 구성 후 호출)
+	 * @param RootItems - 트리 루트 항목 배열
+	 */
+	void SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems);
+
+	/**
+	 * 셀로 나눌 트리 레벨 설정 (1 또는 2, 변경 시 셀 대응 관계 재계산)
+	 * @param InCellLevel - 트리 레벨
+	 */
+	void SetCellLevel(int32 InCellLevel);
+
+	/** 셀로 나누는 트리 레벨 */
+	int32 GetCellLevel() const { return CellLevel; }
+
+	/**
+	 * 파트가 속한 셀(상위 어셈블리) 파트 번호
+	 * @param PartNo - 파트 번호
+	 * @return 셀 파트 번호, 셀 레벨보다 위에 있는 노드면 빈 문자열
+	 */
+	FString FindCellForPart(const FString& PartNo) const;
+
+	/** 셀 노드인지 여부 (트리뷰 체크박스 표시 기준) */
+	bool IsCellNode(const FString& PartNo) const { return CellParts.Contains(PartNo); }
+
+	/**
+	 * 셀의 스트리밍 서브레벨을 찾거나 만들고 로드된 레벨 반환
+	 * 디스크에 이미 있으면 월드에 추가하고, 없으면 새로 만들어 저장합니다.
+	 * @param World - 에디터 월드
+	 * @param CellPartNo - 셀 파트 번호
+	 * @return 로드된 서브레벨, World Partition 월드이거나 실패하면 nullptr
+	 */
+	ULevel* GetOrCreateCellLevel(UWorld* World, const FString& CellPartNo);
+
+	/**
+	 * 셀 서브레벨이 월드에 있는지 여부 (캐시 조회)
+	 * @param CellPartNo - 셀 파트 번호
+	 */
+	bool HasCellLevel(const FString& CellPartNo) const;
+
+	/**
+	 * 셀 서브레벨이 로드되어 있는지 여부 (캐시 조회)
+	 * @param CellPartNo - 셀 파트 번호
+	 */
+	bool IsCellLoaded(const FString& CellPartNo) const;
+
+	/**
+	 * 셀 서브레벨 로드/언로드 (언로드 전에 변경된 레벨은 저장)
+	 * @param CellPartNo - 셀 파트 번호
+	 * @param bLoaded - 로드 여부
+	 * @return 상태를 바꿨는지 여부
+	 */
+	bool SetCellLoaded(const FString& CellPartNo, bool bLoaded);
+
+	/**
+	 * 셀 서브레벨 패키지 이름
+	 * @param CellPartNo - 셀 파트 번호
+	 * @return 예: /Game/Datasmith/Streaming/Cell_PartNo
+	 */
+	static FString GetCellPackageName(const FString& CellPartNo);
+
+private:
+	FAssemblyStreamingManager();
+	~FAssemblyStreamingManager();
+
+	/** 캐시에서 셀의 스트리밍 레벨 찾기 */
+	ULevelStreaming* FindStreamingLevel(const FString& CellPartNo) const;
+
+	/** 에디터 월드의 스트리밍 레벨을 한 번 순회하여 셀 -> 스트리밍 레벨 캐시 재구성 */
+	void RefreshStreamingLevelCache();
+
+	/** 현재 에디터 월드의 레벨 목록 변경 이벤트 구독 (월드가 바뀌면 다시 구독) */
+	void BindToEditorWorld();
+
+	/** 월드 레벨 목록 변경 이벤트 (스트리밍 레벨 추가/제거) */
+	void OnLevelsChanged();
+
+	/** 맵 열기 이벤트 */
+	void OnMapOpened(const FString& Filename, bool bAsTemplate);
+
+	/** 트리 항목에서 셀 대응 관계 다시 계산 */
+	void RebuildCellMap();
+
+	/** 싱글톤 인스턴스 */
+	static FAssemblyStreamingManager* Instance;
+
+	/** 트리 루트 항목 */
+	TArray<TSharedPtr<FPartTreeItem>> TreeRootItems;
+
+	/** 파트 번호 -> 셀 파트 번호 */
+	TMap<FString, FString> PartToCell;
+
+	/** 셀 파트 번호 집합 */
+	TSet<FString> CellParts;
+
+	/** 셀로 나누는 트리 레벨 */
+	int32 CellLevel = 1;
+
+	/** 셀 파트 번호 -> 스트리밍 레벨 (월드에 없는 셀은 항목 없음) */
+	TMap<FString, TWeakObjectPtr<ULevelStreaming>> CellStreamingLevels;
+
+	/** 레벨 목록 변경 이벤트를 구독한 월드 */
+	TWeakObjectPtr<UWorld> BoundWorld;
+
+	// 이벤트 핸들
+	FDelegateHandle LevelsChangedHandle;
+	FDelegateHandle MapOpenedHandle;
+};
+
+/**
+ * 범위 동안 에디터 월드의 현재 레벨을 바꾸고 끝나면 되돌림
+ * 임포트 액터(Datasmith CurrentLevel 배치, 캐시 스폰)가 셀 서브레벨에 생성되도록 합니다.
+ * 서브레벨 생성이 현재 레벨을 바꿀 수 있으므로 생성 전에 만들어 원래 레벨을 기억합니다.
+ */
+class MYPROJECT2_API FScopedCurrentLevel
+{
+public:
+	explicit FScopedCurrentLevel(UWorld* InWorld);
+	~FScopedCurrentLevel();
+
+	/** 현재 레벨 변경 (nullptr이면 무시) */
+	void SetLevel(ULevel* InLevel);
+
+private:
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<ULevel> PreviousLevel;
+};
@@ -0,0 +1,159 @@
+﻿// BatchImportScheduler.h
+// 여러 3DXML 파일을 한 번에 임포트하는 배치 스케줄러
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImportSettings.h"
+#include "ImportTelemetry.h"
+
+class AActor;
+
+/**
+ * 배치 임포트 작업 항목 구조체
+ */
+struct FBatchImportJob
+{
+	/** 파트 번호 */
+	FString PartNo;
+
+	/** 임포트할 3DXML 파일 경로 */
+	FString FilePath;
+
+	/** 파일 크기 (사전 검사에서 채워짐, 없으면 -1) */
+	int64 FileSize = -1;
+
+	/** 워커 스레드 사전 변환 시간 (초, 사전 변환하지 않았으면 0) */
+	double PreTranslateSeconds = 0.0;
+
+	/** 사전 변환 성공 여부 */
+	bool bPreTranslated = false;
+
+	FBatchImportJob() {}
+
+	FBatchImportJob(const FString& InPartNo, const FString& InFilePath)
+		: PartNo(InPartNo)
+		, FilePath(InFilePath)
+	{
+	}
+};
+
+/**
+ * 배치 임포트 결과 구조체
+ */
+struct FBatchImportResult
+{
+	/** 임포트에 성공한 파트 번호 */
+	TArray<FString> ImportedParts;
+
+	/** 임포트에 실패한 파트 번호 */
+	TArray<FString> FailedParts;
+
+	/** 이미 레벨에 임포트되어 건너뛴 파트 번호 */
+	TArray<FString> AlreadyImportedParts;
+
+	/** 사용자 취소로 처리되지 않은 파트 번호 */
+	TArray<FString> CancelledParts;
+
+	/** 비 스태틱 메시 액터 정리에 걸린 총 시간 (초) */
+	double CleanupSeconds = 0.0;
+
+	/** 정리 단계에서 제거된 총 액터 수 */
+	int32 CleanupRemovedActors = 0;
+
+	/** 배치 끝 일괄 저장에 걸린 시간 (초) */
+	double SaveSeconds = 0.0;
+
+	/** 배치 끝에 저장한 패키지 수 */
+	int32 SavedPackageCount = 0;
+
+	/** 동시에 변환한 파일 수 (사전 변환하지 않았으면 0) */
+	int32 ConcurrentTranslations = 0;
+
+	/** 워커 스레드 사전 변환 시간 합 (초, 동시 실행이므로 경과 시간보다 클 수 있음) */
+	double PreTranslateSeconds = 0.0;
+
+	/** 임포트를 시도한 파트별 계측 기록 */
+	TArray<FPartImportRecord> PartRecords;
+
+	/** 배치 보고서 CSV 경로 (기록이 없으면 빈 문자열) */
+	FString ReportCsvPath;
+
+	/** 배치 보고서 JSON 경로 */
+	FString ReportJsonPath;
+
+	/** 마지막으로 임포트된 루트 액터 */
+	TWeakObjectPtr<AActor> LastImportedActor;
+
+	/** 사용자 취소 여부 */
+	bool bCancelled = false;
+};
+
+/**
+ * 3DXML 배치 임포트 스케줄러
+ * 
+ * - 파일 사전 검사(존재/크기)는 워커 스레드에서 병렬로 수행합니다.
+ * - CAD 변환/테셀레이션은 여러 파일을 동시에 워커 스레드에서 시작하며(파일마다 Datasmith CAD 번역기의
+ *   워커 프로세스 사용), 결과는 CAD 캐시에 남습니다. 배치 동안 관련 콘솔 변수를 활성화했다가 끝나면 복원합니다.
+ * - 변환이 끝난 파일은 완료 큐에 들어가고, 게임 스레드는 완료 순서대로 꺼내 캐시에서 에셋 생성,
+ *   액터 스폰과 후처리를 수행합니다. 전체 배치에 대해 하나의 진행 대화상자와 취소 버튼을 제공합니다.
+ * - 콘솔 변수가 없는 엔진에서는 사전 변환 없이 게임 스레드에서 순차 임포트합니다.
+ * - 저장 지연 설정이면 에셋 패키지는 배치가 끝날 때 한 번에 저장합니다 (취소된 경우 포함).
+ */
+class MYPROJECT2_API FBatchImportScheduler
+{
+public:
+	explicit FBatchImportScheduler(const FImportSettings& InSettings);
+
+	/**
+	 * 임포트 작업 추가 (같은 파트 번호는 한 번만 추가됨)
+	 * @param PartNo - 파트 번호
+	 * @param FilePath - 3DXML 파일 경로
+	 */
+	void AddJob(const FString& PartNo, const FString& FilePath);
+
+	/** 대기 중인 작업 수 */
+	int32 GetNumJobs() const { return Jobs.Num(); }
+
+	/**
+	 * 동시에 변환할 최대 파일 수 지정
+	 * @param InMaxConcurrentTranslations - 최대 파일 수 (0 이하면 코어 수 기준 자동)
+	 */
+	void SetMaxConcurrentTranslations(int32 InMaxConcurrentTranslations) { MaxConcurrentTranslations = InMaxConcurrentTranslations; }
+
+	/**
+	 * 배치 실행 (게임 스레드에서 호출)
+	 * @return 배치 임포트 결과
+	 */
+	FBatchImportResult Run();
+
+private:
+	/** 모든 작업 파일을 병렬로 사전 검사하고 누락 파일을 실패 처리 */
+	void PreflightJobs(FBatchImportResult& OutResult);
+
+	/**
+	 * Datasmith CAD 번역기 워커 프로세스 설정 적용 (이전 값 저장)
+	 * 동시에 변환하는 파일 수만큼 워커 프로세스를 나눠 전체가 코어 수를 넘지 않게 합니다.
+	 * @param ConcurrentTranslations - 동시에 변환할 파일 수
+	 * @return 워커 스레드 사전 변환 가능 여부 (워커 프로세스 변환과 CAD 캐시를 모두 지원)
+	 */
+	bool ConfigureCADTranslatorWorkers(int32 ConcurrentTranslations);
+
+	/** 배치 전 CAD 번역기 설정 복원 */
+	void RestoreCADTranslatorWorkers();
+
+	/** 임포트 설정 */
+	FImportSettings ImportSettings;
+
+	/** 작업 목록 */
+	TArray<FBatchImportJob> Jobs;
+
+	/** 중복 방지를 위한 파트 번호 집합 */
+	TSet<FString> QueuedPartNos;
+
+	/** 동시에 변환할 최대 파일 수 (0이면 자동) */
+	int32 MaxConcurrentTranslations = 0;
+
+	/** 배치 전 콘솔 변수 값 (이름 -> 값) */
+	TMap<FString, FString> SavedConsoleVariables;
+};
@@ -0,0 +1,135 @@
+﻿// BomDiff.h
+// 두 BOM CSV 개정판 사이의 노드 변경 비교 (추가/삭제/이동/개정/수량 변경)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPartTreeItem;
+
+/**
+ * BOM 노드 변경 종류 (비트 플래그, 한 노드에 여러 개 가능)
+ */
+enum class EBomDiffFlags : uint8
+{
+	None = 0,
+
+	/** 새 BOM에만 있음 */
+	Added = 1 << 0,
+
+	/** 이전 BOM에만 있음 */
+	Removed = 1 << 1,
+
+	/** 상위 파트가 바뀜 */
+	Moved = 1 << 2,
+
+	/** Part Rev가 바뀜 */
+	Revised = 1 << 3,
+
+	/** Qty가 바뀜 */
+	QuantityChanged = 1 << 4,
+
+	/** 하위 노드 중 삭제된 노드가 있음 (새 BOM 트리 표시용) */
+	ChildRemoved = 1 << 5
+};
+ENUM_CLASS_FLAGS(EBomDiffFlags)
+
+/**
+ * 변경된 BOM 행 하나
+ */
+struct FBomDiffEntry
+{
+	/** 매칭 키 (S/N 또는 파트 번호 + 상위 경로) */
+	FString Key;
+
+	/** 파트 번호 */
+	FString PartNo;
+
+	/** 변경 종류 */
+	EBomDiffFlags Flags = EBomDiffFlags::None;
+
+	/** S/N으로 매칭되었는지 여부 (false면 파트 번호 + 상위 경로) */
+	bool bMatchedBySerial = false;
+
+	/** 이전/새 상위 파트 번호 */
+	FString OldParent;
+	FString NewParent;
+
+	/** 이전/새 Part Rev */
+	FString OldRev;
+	FString NewRev;
+
+	/** 이전/새 Qty */
+	FString OldQty;
+	FString NewQty;
+};
+
+/**
+ * BOM 비교 결과
+ */
+struct FBomDiffResult
+{
+	/** 변경된 행 (변경 없는 행은 포함하지 않음) */
+	TArray<FBomDiffEntry> Entries;
+
+	/** 새 BOM 파트 번호 -> 변경 종류 합 (트리뷰 오버레이용, 삭제는 상위 노드의 ChildRemoved로 표시) */
+	TMap<FString, EBomDiffFlags> PartFlags;
+
+	/** 비교한 행 수 */
+	int32 OldRowCount = 0;
+	int32 NewRowCount = 0;
+
+	/** 비교 시간 (초, BOM 로드 제외) */
+	double Seconds = 0.0;
+
+	/** 새 BOM 파트의 변경 종류 */
+	EBomDiffFlags GetPartFlags(const FString& PartNo) const
+	{
+		const EBomDiffFlags* Flags = PartFlags.Find(PartNo);
+		return Flags ? *Flags : EBomDiffFlags::None;
+	}
+
+	/** 변경 종류를 포함하는 행 수 */
+	int32 Count(EBomDiffFlags Kind) const;
+};
+
+/**
+ * BOM 비교 엔진
+ * 행마다 인스턴스 키(S/N, 없거나 중복이면 파트 번호 + 상위 경로)를 병렬로 계산하고
+ * 이전 BOM 키 해시 맵에 새 BOM 행을 병렬 조회하는 해시 조인으로 선형 시간에 비교합니다.
+ * 경로 키로 매칭되지 않은 추가/삭제 쌍 중 파트 번호가 하나씩만 있는 경우는 이동으로 분류합니다.
+ */
+class MYPROJECT2_API FBomDiff
+{
+public:
+	/**
+	 * 두 BOM CSV 파일 비교 (트리뷰와 같은 로더 사용)
+	 * @param OldFilePath - 이전 BOM CSV
+	 * @param NewFilePath - 새 BOM CSV
+	 * @param OutResult - [출력] 비교 결과
+	 * @return 두 파일을 모두 읽었는지 여부
+	 */
+	static bool DiffFiles(const FString& OldFilePath, const FString& NewFilePath, FBomDiffResult& OutResult);
+
+	/**
+	 * 이미 로드된 두 BOM 비교
+	 * @param OldLevelToItemsMap - 이전 BOM 레벨별 항목 (모든 행)
+	 * @param OldPartNoToItemMap - 이전 BOM 파트 번호별 항목
+	 * @param NewLevelToItemsMap - 새 BOM 레벨별 항목
+	 * @param NewPartNoToItemMap - 새 BOM 파트 번호별 항목
+	 * @param OutResult - [출력] 비교 결과
+	 */
+	static void DiffTrees(
+		const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& OldLevelToItemsMap,
+		const TMap<FString, TSharedPtr<FPartTreeItem>>& OldPartNoToItemMap,
+		const TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& NewLevelToItemsMap,
+		const TMap<FString, TSharedPtr<FPartTreeItem>>& NewPartNoToItemMap,
+		FBomDiffResult& OutResult);
+
+	/**
+	 * 변경 종류 설명 문자열
+	 * @param Flags - 변경 종류
+	 * @return 예: "Moved, Revised"
+	 */
+	static FString DescribeFlags(EBomDiffFlags Flags);
+};
@@ -3,10 +3,27 @@
 
 #include "CoreMinimal.h"
 #include "ImportSettings.h"
+#include "ImportTelemetry.h"
 #include "Materials/MaterialInterface.h"
 
 class UDatasmithImportOptions;
 class UDatasmithImportFactory;
+class FDatasmithTranslatableSceneSource;
+
+/**
+ * 비 스태틱 메시 액터 정리 통계
+ */
+struct FActorCleanupStats
+{
+	/** 루트에 직접 연결된 스태틱 메시 액터 수 */
+	int32 ReparentedCount = 0;
+
+	/** 제거된 액터 수 */
+	int32 RemovedCount = 0;
+
+	/** 정리에 걸린 시간 (초) */
+	double Seconds = 0.0;
+};
 
 /**
  * 데이터스미스 씬과 관련된 작업을 관리하는 클래스
@@ -35,9 +52,9 @@ public:
     
 	/**
 	 * 투명 메터리얼을 사용하는 스태틱 메시 찾기
-	 * @return 투명 메터리얼을 사용하는 스태틱 메시 배열
+	 * @return 투명 메터리얼을 사용하는 스태틱 메시 집합
 	 */
-	TArray<UStaticMesh*> FindMeshesWithTransparentMaterials();
+	TSet<UStaticMesh*> FindMeshesWithTransparentMaterials();
     
 	/**
 	 * 씬의 메시 또는 메터리얼 정보 출력
@@ -113,17 +130,86 @@ public:
 	 */
 	AActor* ImportAndProcessDatasmith(const FString& FilePath, const FString& PartNo, int32 CurrentIndex = 1, int32 TotalCount = 1);
 
+	/**
+	 * 임포트 결과 캐시에서 액터 스폰 (파일 내용과 임포트 설정이 같을 때)
+	 * @param FilePath - 3DXML 파일 경로
+	 * @param PartNo - 파트 번호
+	 * @return 스폰된 루트 액터, 캐시가 없거나 무효하면 nullptr
+	 */
+	AActor* SpawnFromImportCache(const FString& FilePath, const FString& PartNo);
+
+	/**
+	 * 임포트 결과 캐시에서 스폰할 수 있는지 여부 (CAD 변환이 필요 없는 파일)
+	 * @param FilePath - 3DXML 파일 경로
+	 * @return 현재 설정으로 캐시 스폰이 가능하면 true
+	 */
+	bool HasImportCacheEntry(const FString& FilePath);
+
+	/**
+	 * 워커 스레드 CAD 사전 변환용 번역 소스 준비 (게임 스레드에서 호출)
+	 * 현재 품질 단계의 테셀레이션을 번역기 옵션에 적용하므로, 변환 결과가 CAD 캐시에 남으면
+	 * 같은 파일의 ImportAndProcessDatasmith는 CAD 변환 없이 캐시를 읽습니다.
+	 * @param FilePath - 3DXML 파일 경로
+	 * @return 번역 소스, 파일을 변환할 번역기가 없으면 nullptr
+	 */
+	TSharedPtr<FDatasmithTranslatableSceneSource> CreatePreTranslationSource(const FString& FilePath);
+
+	/**
+	 * 워커 스레드 CAD 사전 변환에 필요한 번역기 콘솔 변수 적용 (이전 값 저장)
+	 * 동시에 변환하는 파일 수만큼 번역기 워커 프로세스를 나눠 전체가 코어 수를 넘지 않게 합니다.
+	 * @param ConcurrentTranslations - 동시에 변환할 파일 수
+	 * @param OutSavedConsoleVariables - 바꾸기 전 콘솔 변수 값 (이름 -> 값)
+	 * @return 사전 변환 가능 여부 (워커 프로세스 변환과 CAD 캐시를 모두 지원)
+	 */
+	static bool ConfigureCADPreTranslation(int32 ConcurrentTranslations, TMap<FString, FString>& OutSavedConsoleVariables);
+
+	/**
+	 * ConfigureCADPreTranslation 이전 콘솔 변수 값 복원
+	 * @param SavedConsoleVariables - 저장된 콘솔 변수 값 (복원 후 비움)
+	 */
+	static void RestoreConsoleVariables(TMap<FString, FString>& SavedConsoleVariables);
+
+	/** 임포트 진행 대화상자 표시 여부 설정 (백그라운드 지연 임포트는 대화상자 없이 진행) */
+	void SetShowProgressDialog(bool bShow) { bShowProgressDialog = bShow; }
+
 	/**
 	 * StaticMesh 액터만 유지하고 다른 자식 액터 제거
+	 * 하위 구조를 너비 우선으로 한 번만 평탄화한 뒤, 스태틱 메시 액터를 한 번에 루트로 옮기고
+	 * 나머지 액터는 마지막에 깊은 쪽부터 일괄 제거합니다 (중간 재연결 없음).
 	 * @param RootActor - 루트 액터
+	 * @return 정리 통계
+	 */
+	FActorCleanupStats CleanupNonStaticMeshActors(AActor* RootActor);
+
+	/** 마지막 ImportAndProcessDatasmith 호출의 정리 통계 (정리하지 않았으면 0) */
+	const FActorCleanupStats& GetLastCleanupStats() const { return LastCleanupStats; }
+
+	/** 마지막 ImportAndProcessDatasmith 호출의 단계별 계측 기록 */
+	const FPartImportRecord& GetLastImportRecord() const { return LastImportRecord; }
+
+	/**
+	 * 저장을 미룬 임포트 에셋 패키지를 한 번에 저장 (배치 끝에 호출)
+	 * @return 저장한 패키지 수
+	 */
+	int32 SavePendingPackages();
+
+	/** 저장 대기 중인 패키지 수 */
+	int32 GetNumPendingSavePackages() const { return PendingSavePackages.Num(); }
+
+	/**
+	 * 같은 (스태틱 메시, 머티리얼 조합)의 스태틱 메시 액터들을 인스턴스 컴포넌트로 통합
+	 * 인스턴스별 원래 액터 라벨을 보존하여 파트 번호로 선택할 수 있게 합니다.
+	 * @param RootActor - 루트 액터 (스태틱 메시 액터들이 직접 자식이어야 함)
+	 * @return 인스턴스로 대체된 액터 수
 	 */
-	void CleanupNonStaticMeshActors(AActor* RootActor);
+	int32 ConsolidateInstancedMeshes(AActor* RootActor);
 
 	/**
 	 * 투명 메시 액터들을 제거하는 함수
 	 * @param RootActor - 루트 액터
+	 * @return 제거된 액터 수
 	 */
-	void RemoveTransparentMeshActors(AActor* RootActor);
+	int32 RemoveTransparentMeshActors(AActor* RootActor);
 
 	/**
 	 * 액터의 피벗을 메시 컴포넌트들의 중앙으로 이동시키는 함수
@@ -148,16 +234,30 @@ private:
 	
 	/** Import Settings**/
 	FImportSettings ImportSettings;
+
+	/** 마지막 임포트의 정리 통계 */
+	FActorCleanupStats LastCleanupStats;
+
+	/** 마지막 임포트의 계측 기록 */
+	FPartImportRecord LastImportRecord;
+
+	/** 임포트 진행 대화상자 표시 여부 */
+	bool bShowProgressDialog = true;
+
+	/** 저장을 미룬 임포트 에셋 패키지 */
+	TArray<TWeakObjectPtr<UPackage>> PendingSavePackages;
+
+	/**
+	 * 임포트 결과 객체와 그 객체가 참조하는 에셋 중 변경된 패키지를 저장 대기 목록에 추가
+	 * 로드된 전체 패키지를 순회하지 않고 임포트 태스크 결과와 DatasmithScene의 에셋 맵만 확인합니다.
+	 * @param ImportedObjects - 임포트 태스크가 반환한 객체
+	 * @param ContentPath - 콘텐츠 경로 (로그용, 예: /Game/Datasmith/PartNo)
+	 */
+	void CollectDirtyPackages(const TArray<UObject*>& ImportedObjects, const FString& ContentPath);
     
-	/** 투명도 검사 헬퍼 함수 */
+	/** 투명도 검사 헬퍼 함수 (FMaterialClassificationCache 사용) */
 	bool HasTransparency(UMaterialInterface* Material);
     
-	/** 알파 값 추출 헬퍼 함수 (16진수 문자열에서) */
-	float GetAlphaValue(const FString& AlphaHex);
-    
-	/** 색상 이름에서 알파값 추출 */
-	float ExtractAlphaFromColorName(const FString& ColorName);
-    
 	/** 메터리얼 맵 반환 */
 	TMap<FName, UMaterialInterface*> GetMaterialMap();
     
@@ -175,9 +275,9 @@ private:
 	void FindAllStaticMeshActors(AActor* RootActor, TArray<AStaticMeshActor*>& OutStaticMeshActors);
 
 	/**
-	 * StaticMeshActor를 제외한 자식 액터들을 재귀적으로 제거
-	 * @param Actor - 처리할 액터
-	 * @param OutRemovedCount - 제거된 액터 수
+	 * 액터의 모든 하위 액터를 너비 우선 순서로 하나의 작업 목록에 평탄화
+	 * @param RootActor - 루트 액터 (결과에 포함되지 않음)
+	 * @param OutActors - [출력] 하위 액터 배열 (부모가 항상 자식보다 앞에 옴)
 	 */
-	void RemoveNonStaticMeshChildren(AActor* Actor, int32& OutRemovedCount);
+	static void GatherDescendantsBreadthFirst(AActor* RootActor, TArray<AActor*>& OutActors);
 };
\ No newline at end of file
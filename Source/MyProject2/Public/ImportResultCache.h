@@ -0,0 +1,175 @@
+﻿// ImportResultCache.h
+// 3DXML 임포트 결과 캐시 (파일 내용 해시 + 임포트 설정 기준)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImportSettings.h"
+
+class AActor;
+class AStaticMeshActor;
+class UWorld;
+
+/**
+ * 캐시된 스태틱 메시 액터 정보
+ * 루트 액터 기준 상대 변환과 사용된 에셋 경로를 저장합니다.
+ */
+struct FImportCacheMeshEntry
+{
+	/** 액터 라벨 */
+	FString ActorLabel;
+
+	/** 스태틱 메시 에셋 경로 */
+	FString StaticMeshPath;
+
+	/** 슬롯별 머티리얼 에셋 경로 */
+	TArray<FString> MaterialPaths;
+
+	/** 루트 액터 기준 상대 변환 */
+	FTransform RelativeTransform;
+};
+
+/**
+ * 임포트 결과 캐시 항목
+ * 한 번의 임포트(후처리 포함)로 만들어진 결과를 다시 스폰할 수 있을 만큼 저장합니다.
+ */
+struct FImportCacheEntry
+{
+	/** 파트 번호 */
+	FString PartNo;
+
+	/** 원본 3DXML 파일 경로 */
+	FString SourceFilePath;
+
+	/** 원본 파일 내용 해시 (MD5) */
+	FString FileHash;
+
+	/** 임포트 설정 해시 */
+	uint32 SettingsHash = 0;
+
+	/** 루트 액터 월드 변환 */
+	FTransform RootTransform;
+
+	/** 루트 아래 스태틱 메시 액터 목록 */
+	TArray<FImportCacheMeshEntry> Meshes;
+};
+
+/**
+ * 임포트 결과 캐시 클래스
+ * 같은 3DXML 파일을 같은 설정으로 다시 임포트할 때 CAD 변환 없이
+ * 이전에 생성된 스태틱 메시/머티리얼 에셋으로 액터를 스폰합니다.
+ * 캐시는 Saved/ImportCache 폴더에 JSON으로 저장되어 세션 간에 유지됩니다.
+ */
+class MYPROJECT2_API FImportResultCache
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FImportResultCache& Get();
+
+	/**
+	 * 파일 내용 해시 계산 (경로/크기/수정 시간이 같으면 이전 결과 재사용)
+	 * @param FilePath - 파일 경로
+	 * @return MD5 해시 문자열, 실패 시 빈 문자열
+	 */
+	FString GetFileHash(const FString& FilePath);
+
+	/**
+	 * 캐시 키 생성
+	 * @param FileHash - 파일 내용 해시
+	 * @param Settings - 임포트 설정
+	 * @return 캐시 키
+	 */
+	static FString MakeCacheKey(const FString& FileHash, const FImportSettings& Settings);
+
+	/**
+	 * 캐시 항목에 저장된 해시로 캐시 키 생성
+	 * @param Entry - 캐시 항목
+	 * @return 캐시 키
+	 */
+	static FString MakeCacheKeyFromEntry(const FImportCacheEntry& Entry);
+
+	/**
+	 * 캐시 항목 찾기
+	 * @param FilePath - 3DXML 파일 경로
+	 * @param Settings - 임포트 설정
+	 * @return 캐시 항목, 없으면 nullptr
+	 */
+	const FImportCacheEntry* FindEntry(const FString& FilePath, const FImportSettings& Settings);
+
+	/**
+	 * 후처리가 끝난 임포트 결과를 캐시에 기록
+	 * @param FilePath - 3DXML 파일 경로
+	 * @param PartNo - 파트 번호
+	 * @param Settings - 임포트 설정
+	 * @param RootActor - 후처리가 끝난 루트 액터
+	 * @param MeshActors - 루트 아래 스태틱 메시 액터 목록
+	 * @return 기록 성공 여부
+	 */
+	bool RecordImport(const FString& FilePath, const FString& PartNo, const FImportSettings& Settings,
+		AActor* RootActor, const TArray<AStaticMeshActor*>& MeshActors);
+
+	/**
+	 * 캐시 항목으로부터 액터 계층 스폰
+	 * 에셋 중 하나라도 로드할 수 없으면 캐시 항목을 제거하고 nullptr을 반환합니다.
+	 * @param World - 스폰할 월드
+	 * @param Entry - 캐시 항목
+	 * @return 스폰된 루트 액터, 실패 시 nullptr
+	 */
+	AActor* SpawnFromCache(UWorld* World, const FImportCacheEntry& Entry);
+
+	/**
+	 * 캐시 항목 제거
+	 * @param CacheKey - 캐시 키
+	 */
+	void RemoveEntry(const FString& CacheKey);
+
+	/**
+	 * 같은 파트 번호나 같은 대상 경로의 에셋을 가리키는 캐시 항목 제거
+	 * 재임포트는 같은 경로의 에셋을 덮어쓰므로 다른 파일 내용/설정의 항목이 새 에셋을 스폰하지 않도록 합니다.
+	 * @param PartNo - 파트 번호
+	 * @param DestinationPath - 임포트 대상 콘텐츠 경로 (예: /Game/Datasmith/<PartNo>)
+	 * @return 제거한 항목 수
+	 */
+	int32 RemoveEntriesForDestination(const FString& PartNo, const FString& DestinationPath);
+
+	/** 캐시 전체 삭제 */
+	void Clear();
+
+	/** 캐시 항목 수 */
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	FImportResultCache();
+
+	/** 캐시 파일 경로 */
+	static FString GetCacheFilePath();
+
+	/** 캐시 파일 로드 */
+	void LoadFromDisk();
+
+	/** 캐시 파일 저장 */
+	void SaveToDisk() const;
+
+	/**
+	 * 새 항목과 파트 번호가 같거나 같은 메시 에셋을 가리키는 다른 항목 제거 (디스크 저장은 호출자가 수행)
+	 * @param NewEntry - 기록할 항목
+	 * @param KeepKey - 유지할 캐시 키
+	 * @return 제거한 항목 수
+	 */
+	int32 EvictConflictingEntries(const FImportCacheEntry& NewEntry, const FString& KeepKey);
+
+	/** 캐시 키 -> 항목 */
+	TMap<FString, FImportCacheEntry> Entries;
+
+	/** 파일 해시 메모 (크기/수정 시간이 같으면 재계산하지 않음) */
+	struct FFileHashMemo
+	{
+		int64 FileSize = 0;
+		FDateTime TimeStamp;
+		FString Hash;
+	};
+	TMap<FString, FFileHashMemo> FileHashMemos;
+
+	/** 싱글톤 인스턴스 */
+	static FImportResultCache* Instance;
+};
@@ -29,10 +29,56 @@ struct FImportSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings", meta = (ClampMin = "0", ClampMax = "2"))
 	int32 MaterialUpdatePolicy = 0;
 
+	/** 테셀레이션/라이트맵/재질 품질 단계
+	 * 0 = 미리보기 (거친 테셀레이션, 라이트맵 UV 없음), 1 = 표준, 2 = 고품질 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings", meta = (ClampMin = "0", ClampMax = "2"))
+	int32 QualityTier = 1;
+
+	/** 같은 메시/머티리얼 조합의 반복 메시 액터를 인스턴스 컴포넌트로 통합 여부
+	 * (StaticMesh 정리 옵션이 켜져 있을 때만 적용) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings")
+	bool bConsolidateInstancedMeshes = true;
+
+	/** 인스턴스로 통합할 최소 반복 횟수 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings", meta = (ClampMin = "2"))
+	int32 MinInstancesPerGroup = 2;
+
+	/** 파트마다 저장하지 않고 배치가 끝날 때 변경된 에셋 패키지를 한 번에 저장 여부 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings")
+	bool bDeferAssetSaving = true;
+
+	/** 임포트한 에셋을 디스크에 저장하지 않음 (검토용 임시 세션, 임포트 결과 캐시도 기록하지 않음) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings")
+	bool bSkipAssetSaving = false;
+
+	/** 상위 어셈블리마다 스트리밍 서브레벨을 만들어 그 아래 파트를 배치 여부
+	 * (트리뷰에서 어셈블리 체크박스로 로드/언로드) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings")
+	bool bStreamAssembliesToSubLevels = false;
+
+	/** 서브레벨로 나눌 어셈블리의 트리 레벨 (1 또는 2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import Settings", meta = (ClampMin = "1", ClampMax = "2"))
+	int32 StreamingCellLevel = 1;
+
 	/** 기본 생성자 */
 	FImportSettings()
 	{
 	}
+
+	/**
+	 * 임포트 결과(생성되는 에셋과 액터 구성)에 영향을 주는 설정의 해시
+	 * 임포트 결과 캐시 키로 사용되며, 선택 여부처럼 결과와 무관한 설정은 제외합니다.
+	 * 인스턴스 통합은 캐시에서 스폰한 뒤에도 다시 적용되므로 제외합니다.
+	 * @return 설정 해시
+	 */
+	uint32 GetImportResultHash() const
+	{
+		uint32 Hash = GetTypeHash(bRemoveTransparentMeshes);
+		Hash = HashCombine(Hash, GetTypeHash(bCleanupNonStaticMeshActors));
+		Hash = HashCombine(Hash, GetTypeHash(MaterialUpdatePolicy));
+		Hash = HashCombine(Hash, GetTypeHash(QualityTier));
+		return Hash;
+	}
 };
 
 /** 임포트 설정 저장 클래스 */
@@ -0,0 +1,165 @@
+﻿// ImportTelemetry.h
+// 3DXML 임포트 단계별 계측 기록과 배치 보고서
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class AActor;
+
+/**
+ * 3DXML 임포트 단계
+ */
+enum class EImportStage : uint8
+{
+	/** CAD 변환 및 에셋 생성 (Datasmith 임포트 태스크) */
+	Translate,
+
+	/** 씬 액터 탐색, 이름 변경 또는 캐시에서 스폰 */
+	Spawn,
+
+	/** 투명 메시 액터 제거 */
+	Transparency,
+
+	/** 비 스태틱 메시 액터 정리 */
+	Cleanup,
+
+	/** 피벗 중앙화 */
+	Pivot,
+
+	/** 임포트 결과 캐시 기록 */
+	CacheRecord,
+
+	/** 인스턴스 통합 */
+	Consolidate,
+
+	/** 트랜잭션 플래그 설정, 노드 등록, 씬 액터 제거 */
+	Finalize,
+
+	/** 배치 워커 스레드의 CAD 사전 변환 (게임 스레드 시간과 겹치므로 전체 시간에 포함되지 않음) */
+	PreTranslate,
+
+	Count
+};
+
+/**
+ * 파트 하나의 임포트 계측 기록
+ */
+struct FPartImportRecord
+{
+	/** 파트 번호 */
+	FString PartNo;
+
+	/** 3DXML 파일 경로 */
+	FString FilePath;
+
+	/** 임포트 성공 여부 */
+	bool bSucceeded = false;
+
+	/** 임포트 결과 캐시에서 스폰했는지 여부 (CAD 변환 생략) */
+	bool bFromCache = false;
+
+	/** 단계별 경과 시간 (초) */
+	double StageSeconds[static_cast<int32>(EImportStage::Count)] = {};
+
+	/** 전체 경과 시간 (초) */
+	double TotalSeconds = 0.0;
+
+	/** 최종 결과의 삼각형 수 (LOD 0, 인스턴스 포함) */
+	int64 TriangleCount = 0;
+
+	/** 임포트로 생성된 액터 수 */
+	int32 ActorsCreated = 0;
+
+	/** 후처리로 제거된 액터 수 */
+	int32 ActorsDestroyed = 0;
+
+	/** 파트 에셋 폴더의 디스크 크기 (바이트, 저장을 미루면 배치 저장 후 기록) */
+	int64 BytesWritten = 0;
+
+	FPartImportRecord() {}
+
+	FPartImportRecord(const FString& InPartNo, const FString& InFilePath)
+		: PartNo(InPartNo)
+		, FilePath(InFilePath)
+	{
+	}
+
+	/** 단계 경과 시간 조회 */
+	double GetStageSeconds(EImportStage Stage) const
+	{
+		return StageSeconds[static_cast<int32>(Stage)];
+	}
+};
+
+/**
+ * 임포트 단계 시간 측정 범위
+ * 소멸 시 경과 시간을 기록의 해당 단계에 누적합니다.
+ */
+class FScopedImportStage
+{
+public:
+	FScopedImportStage(FPartImportRecord& InRecord, EImportStage InStage)
+		: Record(InRecord)
+		, Stage(InStage)
+		, StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FScopedImportStage()
+	{
+		Record.StageSeconds[static_cast<int32>(Stage)] += FPlatformTime::Seconds() - StartTime;
+	}
+
+private:
+	FPartImportRecord& Record;
+	EImportStage Stage;
+	double StartTime;
+};
+
+/** 임포트 단계 범위: Unreal Insights CPU 이벤트와 파트 기록 시간을 함께 남김 */
+#define IMPORT_STAGE_SCOPE(Record, Stage) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Import_##Stage); \
+	FScopedImportStage PREPROCESSOR_JOIN(ImportStageScope_, __LINE__)(Record, EImportStage::Stage)
+
+/**
+ * 임포트 계측 유틸리티
+ */
+class MYPROJECT2_API FImportTelemetry
+{
+public:
+	/** 단계 이름 (보고서 열 이름) */
+	static const TCHAR* GetStageName(EImportStage Stage);
+
+	/**
+	 * 액터와 모든 하위 액터의 스태틱 메시 삼각형 수 (LOD 0, 인스턴스 수 반영)
+	 * @param RootActor - 루트 액터
+	 * @return 삼각형 수
+	 */
+	static int64 CountTriangles(AActor* RootActor);
+
+	/**
+	 * 액터와 모든 하위 액터 수
+	 * @param RootActor - 루트 액터
+	 * @return 액터 수 (루트 포함)
+	 */
+	static int32 CountActors(AActor* RootActor);
+
+	/**
+	 * 콘텐츠 폴더 아래 패키지 파일의 디스크 크기 합
+	 * @param ContentPath - 콘텐츠 경로 (예: /Game/Datasmith/PartNo)
+	 * @return 바이트 수
+	 */
+	static int64 GetContentFolderSize(const FString& ContentPath);
+
+	/**
+	 * 배치 보고서를 Saved/ImportReports 아래에 CSV와 JSON으로 저장
+	 * @param Records - 파트별 기록
+	 * @param OutCsvPath - [출력] CSV 파일 경로
+	 * @param OutJsonPath - [출력] JSON 파일 경로
+	 * @param BatchSaveSeconds - 배치 끝 일괄 저장 시간 (파트별 기록에 포함되지 않음)
+	 * @return 두 파일 모두 저장했는지 여부
+	 */
+	static bool WriteBatchReport(const TArray<FPartImportRecord>& Records, FString& OutCsvPath, FString& OutJsonPath, double BatchSaveSeconds = 0.0);
+};
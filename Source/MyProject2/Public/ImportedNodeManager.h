@@ -3,10 +3,20 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+
+class UPartInstancedMeshComponent;
+class ULevel;
+struct FPropertyChangedEvent;
+
+/** 임포트 노드 변경 델리게이트 (파트 번호가 비어 있으면 전체 재구성) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnImportedNodeChanged, const FString& /*PartNo*/);
 
 /**
  * 임포트된 노드 관리 클래스
  * 파트 번호와 해당하는 액터 참조를 관리합니다.
+ * 레벨 액터 추가/삭제, 라벨 변경, 태그 변경 이벤트로 인덱스를 갱신하므로
+ * 파트 -> 액터, 액터 -> 파트 조회는 월드 검색 없이 해시 조회로 처리됩니다.
  */
 class MYPROJECT2_API FImportedNodeManager
 {
@@ -14,6 +24,9 @@ public:
 	/** 싱글턴 인스턴스 가져오기 */
 	static FImportedNodeManager& Get();
     
+	/** 싱글턴 정리 (에디터 이벤트 구독 해제, 모듈 종료 시 호출) */
+	static void Shutdown();
+    
 	/** 임포트된 노드 등록 */
 	void RegisterImportedNode(const FString& PartNo, AActor* Actor);
     
@@ -32,9 +45,49 @@ public:
 	/** 모든 임포트된 노드 가져오기 */
 	const TMap<FString, TWeakObjectPtr<AActor>>& GetAllImportedNodes() const { return ImportedNodes; }
     
-	/** 모든 레벨 액터에서 임포트된 노드 초기화 */
+	/**
+	 * 액터가 속한 임포트 파트 번호 찾기 (부착 부모를 따라 올라가며 조회)
+	 * @param Actor - 확인할 액터
+	 * @return 파트 번호, 임포트된 파트에 속하지 않으면 빈 문자열
+	 */
+	FString GetPartNoForActor(const AActor* Actor) const;
+    
+	/**
+	 * 라벨로 레벨 액터 찾기 (대소문자 무시, 같은 라벨이 여러 개면 그중 유효한 액터 하나)
+	 * @param Label - 액터 라벨
+	 * @return 찾은 액터, 없으면 nullptr
+	 */
+	AActor* FindActorByLabel(const FString& Label) const;
+    
+	/**
+	 * 레벨에 있는 DatasmithSceneActor 찾기
+	 * @param NameHint - 이름에 포함되어야 하는 문자열 (비어 있으면 가장 최근에 추가된 액터)
+	 * @return 찾은 액터, 없으면 nullptr
+	 */
+	AActor* FindDatasmithSceneActor(const FString& NameHint = FString()) const;
+    
+	/**
+	 * 인스턴스 메시 컴포넌트의 인스턴스별 파트 라벨 등록
+	 * @param Component - 등록할 파트 인스턴스 메시 컴포넌트
+	 */
+	void RegisterInstancedParts(UPartInstancedMeshComponent* Component);
+    
+	/**
+	 * 파트 번호에 해당하는 인스턴스 찾기 (해시 조회만 수행)
+	 * 라벨이 정확히 일치하는 인스턴스를 먼저, 없으면 라벨의 구분자 경계 구간이 일치하는 인스턴스를 찾습니다.
+	 * @param PartNo - 파트 번호
+	 * @param OutComponent - [출력] 인스턴스를 가진 컴포넌트
+	 * @param OutInstanceIndex - [출력] 인스턴스 인덱스
+	 * @return 찾았으면 true
+	 */
+	bool FindImportedInstance(const FString& PartNo, UPartInstancedMeshComponent*& OutComponent, int32& OutInstanceIndex) const;
+    
+	/** 모든 레벨 액터에서 인덱스 재구성 (초기화와 맵 열기 시에만 호출) */
 	void InitializeFromLevelActors();
     
+	/** 임포트 노드 등록/해제, 인스턴스 파트 등록 시 호출되는 델리게이트 */
+	FOnImportedNodeChanged& OnImportedNodeChanged() { return ImportedNodeChangedEvent; }
+    
 	/** 임포트 태그 상수 */
 	static const FName ImportedTag;
     
@@ -42,9 +95,99 @@ private:
 	/** 생성자 (싱글턴) */
 	FImportedNodeManager();
     
+	/** 소멸자 (이벤트 구독 해제) */
+	~FImportedNodeManager();
+    
+	/** 에디터 이벤트 구독 */
+	void RegisterEditorHooks();
+    
+	/** 에디터 이벤트 구독 해제 */
+	void UnregisterEditorHooks();
+    
+	/** 액터 하나를 인덱스에 추가 (라벨, 임포트 태그, DatasmithSceneActor, 인스턴스 파트) */
+	void IndexActor(AActor* Actor);
+    
+	/** 액터 하나를 인덱스에서 제거 */
+	void UnindexActor(AActor* Actor);
+    
+	/** 레벨의 모든 액터를 인덱스에 추가 */
+	void IndexLevel(ULevel* Level);
+    
+	/** 파트 번호 <-> 루트 액터 항목 추가 (이전 액터나 이전 파트 번호의 항목 정리) */
+	void AddImportedNodeEntry(const FString& PartNo, AActor* Actor);
+    
+	/** 인스턴스 메시 컴포넌트의 파트 인덱스 항목 제거 */
+	void UnregisterInstancedParts(UPartInstancedMeshComponent* Component);
+    
+	/**
+	 * 인스턴스 라벨에서 부분 일치 조회 키 생성
+	 * 영숫자가 아닌 문자를 구분자로 보고, 구분자 경계에서 시작하고 끝나는 모든 구간(소문자)을 만듭니다.
+	 * 예: "ab-12.3" -> ab, ab-12, ab-12.3, 12, 12.3, 3
+	 * @param LowerLabel - 소문자 라벨
+	 * @param OutKeys - [출력] 조회 키 (라벨 전체 제외)
+	 */
+	static void GetLabelSegmentKeys(const FString& LowerLabel, TArray<FString>& OutKeys);
+    
+	/** 태그에서 파트 번호 추출 ("ImportedPart_" 접두사) */
+	static FString GetPartNoFromTags(const AActor* Actor);
+    
+	// 에디터 이벤트 핸들러
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void OnMapOpened(const FString& Filename, bool bAsTemplate);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+    
 	/** 싱글턴 인스턴스 */
 	static FImportedNodeManager* Instance;
     
 	/** 임포트된 노드 맵 (파트 번호 -> 액터) */
 	TMap<FString, TWeakObjectPtr<AActor>> ImportedNodes;
-};
\ No newline at end of file
+    
+	/** 임포트된 루트 액터 -> 파트 번호 */
+	TMap<TObjectKey<AActor>, FString> ActorToPartNo;
+    
+	/** 소문자 라벨 -> 액터 (같은 라벨의 액터가 여러 개일 수 있음) */
+	TMultiMap<FString, TWeakObjectPtr<AActor>> ActorsByLabel;
+    
+	/** 액터 -> 인덱싱된 소문자 라벨 (라벨 변경 시 이전 키 제거용) */
+	TMap<TObjectKey<AActor>, FString> IndexedLabels;
+    
+	/** 레벨에 있는 DatasmithSceneActor 목록 (추가된 순서) */
+	TArray<TWeakObjectPtr<AActor>> DatasmithSceneActors;
+    
+	/** 인스턴스 파트 참조 (컴포넌트, 인스턴스 인덱스) */
+	struct FInstancedPartRef
+	{
+		TWeakObjectPtr<UPartInstancedMeshComponent> Component;
+		int32 InstanceIndex = INDEX_NONE;
+        
+		bool operator==(const FInstancedPartRef& Other) const
+		{
+			return Component == Other.Component && InstanceIndex == Other.InstanceIndex;
+		}
+	};
+    
+	/** 소문자 인스턴스 라벨 -> 인스턴스 (정확히 일치) */
+	TMultiMap<FString, FInstancedPartRef> InstancedPartsByLabel;
+    
+	/** 소문자 라벨 구간 -> 인스턴스 (부분 일치) */
+	TMultiMap<FString, FInstancedPartRef> InstancedPartsBySegment;
+    
+	/** 컴포넌트 -> 등록한 (라벨 키, 구간 키) (재등록과 제거용) */
+	TMap<TObjectKey<UPartInstancedMeshComponent>, TPair<TArray<FString>, TArray<FString>>> InstancedPartKeys;
+    
+	/** 임포트 노드 변경 이벤트 */
+	FOnImportedNodeChanged ImportedNodeChangedEvent;
+    
+	// 에디터 이벤트 핸들
+	FDelegateHandle LevelActorAddedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+	FDelegateHandle MapOpenedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
@@ -0,0 +1,245 @@
+﻿// LazyGeometryManager.h
+// 지연 형상 관리: 노드를 바운딩 박스 플레이스홀더로 등록해 두고 필요할 때 실제 3DXML 임포트
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+class AActor;
+class FDatasmithSceneManager;
+struct FPartTreeItem;
+
+/**
+ * 지연 형상 노드 상태
+ */
+enum class ELazyGeometryState : uint8
+{
+	/** 플레이스홀더만 있음 */
+	Placeholder,
+
+	/** 임포트 대기 중 */
+	Queued,
+
+	/** 실제 형상 임포트됨 */
+	Loaded
+};
+
+/**
+ * 지연 형상 관리 클래스
+ * 등록된 노드는 실제 임포트 대신 CAD 파일의 바운딩 박스만 표시하는 플레이스홀더 액터로 둡니다.
+ * 노드가 펼쳐지거나 선택되거나 뷰포트 절두체에 들어오면 임포트 대기열에 넣습니다.
+ * CAD 변환은 워커 스레드에서 미리 해 두고(CAD 캐시), 게임 스레드는 틱마다 변환이 끝난 파트 하나만
+ * 진행 대화상자 없이 스폰/마무리하여 에디터가 계속 반응하도록 합니다.
+ * 추정 메시 메모리가 예산을 넘으면 가장 오래 보지 않은 파트를 다시 플레이스홀더로 되돌립니다.
+ * 바운딩 박스는 한 번 임포트된 파트에서 기록해 두고 파일 크기/수정 시각이 같으면 재사용합니다.
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+class MYPROJECT2_API FLazyGeometryManager
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FLazyGeometryManager& Get();
+
+	/** 싱글톤 인스턴스 정리 */
+	static void Shutdown();
+
+	/**
+	 * 하위 트리에서 CAD 파일이 있고 아직 임포트되지 않은 노드를 지연 형상으로 등록
+	 * 기록된 바운딩 박스가 있는 노드는 플레이스홀더 액터를 스폰합니다.
+	 * @param RootItem - 하위 트리 루트 항목
+	 * @return 등록된 노드 수
+	 */
+	int32 RegisterSubtree(const TSharedPtr<FPartTreeItem>& RootItem);
+
+	/** 모든 지연 형상 등록 해제 (플레이스홀더 제거, 임포트된 형상은 유지) */
+	void UnregisterAll();
+
+	/** 지연 형상으로 등록된 노드인지 여부 */
+	bool IsRegistered(const FString& PartNo) const { return Parts.Contains(PartNo); }
+
+	/** 등록된 노드가 있는지 여부 */
+	bool HasRegisteredParts() const { return Parts.Num() > 0; }
+
+	/** 노드 상태 (등록되지 않았으면 Loaded로 간주) */
+	ELazyGeometryState GetState(const FString& PartNo) const;
+
+	/**
+	 * 노드 임포트 요청 (등록된 플레이스홀더 노드만 대기열에 추가, 이미 임포트되었으면 최근 사용 시각만 갱신)
+	 * @param PartNo - 파트 번호
+	 */
+	void RequestLoad(const FString& PartNo);
+
+	/**
+	 * 펼쳐진 노드와 직접 자식 노드 임포트 요청
+	 * @param Item - 펼쳐진 항목
+	 */
+	void RequestLoadExpanded(const TSharedPtr<FPartTreeItem>& Item);
+
+	/** 메시 메모리 예산 (MB) */
+	int32 GetMemoryBudgetMB() const { return MemoryBudgetMB; }
+
+	/** 메시 메모리 예산 설정 (MB, 초과 시 즉시 정리) */
+	void SetMemoryBudgetMB(int32 InBudgetMB);
+
+	/** 현재 임포트된 지연 형상의 추정 메모리 (바이트) */
+	int64 GetLoadedMemoryBytes() const;
+
+	/** 플레이스홀더 액터 태그 */
+	static const FName PlaceholderTag;
+
+private:
+	/** 지연 형상 노드 */
+	struct FLazyPart
+	{
+		/** 3DXML 파일 경로 */
+		FString FilePath;
+
+		/** 플레이스홀더 액터 (바운딩 박스가 없으면 없음) */
+		TWeakObjectPtr<AActor> Placeholder;
+
+		/** 상태 */
+		ELazyGeometryState State = ELazyGeometryState::Placeholder;
+
+		/** 월드 바운딩 박스 (기록이 없으면 무효) */
+		FBox Bounds = FBox(EForceInit::ForceInit);
+
+		/** 마지막으로 보거나 요청한 시각 */
+		double LastViewedTime = 0.0;
+
+		/** 임포트된 형상의 추정 메모리 (바이트) */
+		int64 MemoryBytes = 0;
+
+		/** 임포트 실패 여부 (절두체 검사로 반복 시도하지 않음) */
+		bool bLoadFailed = false;
+	};
+
+	/** 기록된 바운딩 박스 (파일이 바뀌면 무효) */
+	struct FRecordedBounds
+	{
+		FBox Bounds = FBox(EForceInit::ForceInit);
+		int64 FileSize = -1;
+		FDateTime FileTimestamp;
+	};
+
+	FLazyGeometryManager();
+	~FLazyGeometryManager();
+
+	/** 워커 스레드에서 CAD 변환 중인 노드 */
+	struct FPendingTranslation
+	{
+		/** 파트 번호 */
+		FString PartNo;
+
+		/** 변환 결과 (성공 여부) */
+		TFuture<bool> Result;
+	};
+
+	/** 에디터 틱: 절두체 검사, 변환이 끝난 한 항목 임포트, 바운딩 박스 기록 저장 */
+	bool Tick(float DeltaTime);
+
+	/** 변환이 끝난 노드 하나를 임포트하고, 남은 자리만큼 대기열의 다음 노드 변환 시작 */
+	void ProcessNextLoad();
+
+	/**
+	 * 게임 스레드에서 노드 임포트 후 플레이스홀더 정리 (변환 결과는 CAD 캐시에서 재사용)
+	 * @param PartNo - 파트 번호
+	 */
+	void FinishLoad(const FString& PartNo);
+
+	/** 임포트 대기열 끝에 추가 */
+	void EnqueueLoad(const FString& PartNo);
+
+	/**
+	 * 임포트 대기열 앞에서 꺼내기
+	 * @param OutPartNo - 꺼낸 파트 번호
+	 * @return 대기열이 비어 있지 않았는지 여부
+	 */
+	bool DequeueLoad(FString& OutPartNo);
+
+	/** 임포트 대기열에 남은 노드 수 */
+	int32 GetNumQueuedLoads() const { return LoadQueue.Num() - LoadQueueHead; }
+
+	/** 변환 중인 작업이 모두 끝날 때까지 대기 후 번역기 콘솔 변수 복원 */
+	void WaitForPendingTranslations();
+
+	/** 활성 뷰포트 절두체에 들어온 플레이스홀더 요청 및 보이는 형상의 사용 시각 갱신 */
+	void UpdateViewportVisibility();
+
+	/** 메모리 예산을 넘으면 오래 보지 않은 노드부터 플레이스홀더로 되돌림 */
+	void EnforceMemoryBudget();
+
+	/** 임포트된 노드를 플레이스홀더로 되돌림 */
+	void EvictToPlaceholder(const FString& PartNo, FLazyPart& Part);
+
+	/** 바운딩 박스 플레이스홀더 액터 스폰 */
+	static AActor* SpawnPlaceholder(const FString& PartNo, const FBox& Bounds);
+
+	/** 액터 하위 구조의 고유 스태틱 메시 메모리 추정 */
+	static int64 EstimateMemoryBytes(AActor* RootActor);
+
+	/** 파일과 일치하는 기록된 바운딩 박스 조회 */
+	FBox FindRecordedBounds(const FString& PartNo, const FString& FilePath) const;
+
+	/** 임포트된 액터의 바운딩 박스 기록 */
+	void RecordBounds(const FString& PartNo, const FString& FilePath, AActor* RootActor);
+
+	/** 바운딩 박스 기록 파일 경로 */
+	static FString GetBoundsFilePath();
+
+	/** 바운딩 박스 기록 로드 */
+	void LoadRecordedBounds();
+
+	/** 바운딩 박스 기록 저장 */
+	void SaveRecordedBounds();
+
+	/** 임포트 노드 변경 이벤트 (직접 임포트한 파트의 바운딩 박스 기록) */
+	void OnImportedNodeChanged(const FString& PartNo);
+
+	/** 싱글톤 인스턴스 */
+	static FLazyGeometryManager* Instance;
+
+	/** 파트 번호 -> 지연 형상 노드 */
+	TMap<FString, FLazyPart> Parts;
+
+	/** 임포트 대기열 (파트 번호, LoadQueueHead부터 유효) */
+	TArray<FString> LoadQueue;
+
+	/** 임포트 대기열의 다음 항목 인덱스 */
+	int32 LoadQueueHead = 0;
+
+	/** 워커 스레드에서 변환 중인 노드 */
+	TArray<FPendingTranslation> PendingTranslations;
+
+	/** 지연 임포트 동안 바꾼 번역기 콘솔 변수의 이전 값 */
+	TMap<FString, FString> SavedConsoleVariables;
+
+	/** 번역기 콘솔 변수 적용 여부 */
+	bool bTranslatorConfigured = false;
+
+	/** 워커 스레드 사전 변환 가능 여부 (불가능하면 게임 스레드에서 변환) */
+	bool bCanPreTranslate = false;
+
+	/** 파트 번호 -> 기록된 바운딩 박스 */
+	TMap<FString, FRecordedBounds> RecordedBounds;
+
+	/** 바운딩 박스 기록 변경 여부 */
+	bool bRecordedBoundsDirty = false;
+
+	/** 지연 임포트용 씬 매니저 */
+	TUniquePtr<FDatasmithSceneManager> SceneManager;
+
+	/** 메시 메모리 예산 (MB) */
+	int32 MemoryBudgetMB = 2048;
+
+	/** 마지막 절두체 검사 시각 */
+	double LastVisibilityCheckTime = 0.0;
+
+	/** 지연 임포트 진행 중 여부 (임포트 중 발생하는 노드 변경 이벤트 무시) */
+	bool bLoadingPart = false;
+
+	// 이벤트 핸들
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle ImportedNodeChangedHandle;
+};
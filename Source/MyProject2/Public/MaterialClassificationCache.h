@@ -0,0 +1,78 @@
+﻿// MaterialClassificationCache.h
+// 머티리얼 투명도 분류 캐시 (머티리얼 경로 기준, 프로세스 전역)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMaterialInterface;
+
+/**
+ * 머티리얼 분류 캐시 클래스
+ * 배치 임포트에서 같은 Datasmith 머티리얼이 반복해서 분류되지 않도록
+ * 머티리얼 경로별 투명도 분류 결과를 한 번만 계산해 보관합니다.
+ * 머티리얼 속성이 에디터에서 변경되면 해당 항목을 무효화합니다.
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+class MYPROJECT2_API FMaterialClassificationCache
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FMaterialClassificationCache& Get();
+
+	/** 싱글톤 인스턴스 정리 */
+	static void Shutdown();
+
+	/**
+	 * 머티리얼의 투명도 여부 반환 (캐시에 없으면 분류 후 저장)
+	 * 블렌드 모드가 불투명이 아니거나 "color_RRGGBBAA" 이름의 알파가 1 미만이면 투명으로 분류합니다.
+	 * @param Material - 확인할 머티리얼
+	 * @return 투명 머티리얼이면 true
+	 */
+	bool IsTransparent(UMaterialInterface* Material);
+
+	/**
+	 * 머티리얼 배열 중 투명 머티리얼이 하나라도 있는지 확인
+	 * @param Materials - 확인할 머티리얼 배열
+	 * @return 투명 머티리얼이 있으면 true
+	 */
+	bool HasAnyTransparent(const TArray<UMaterialInterface*>& Materials);
+
+	/**
+	 * 머티리얼 분류 항목 무효화
+	 * @param Material - 무효화할 머티리얼
+	 */
+	void Invalidate(const UMaterialInterface* Material);
+
+	/** 모든 분류 결과 제거 */
+	void Clear();
+
+	/** 캐시된 머티리얼 수 */
+	int32 Num() const { return TransparencyByPath.Num(); }
+
+	/**
+	 * "color_RRGGBBAA" 형식 이름에서 알파값 추출
+	 * @param ColorName - 머티리얼 이름
+	 * @return 0~1 알파값, 형식이 아니면 1.0
+	 */
+	static float ExtractAlphaFromColorName(const FString& ColorName);
+
+private:
+	FMaterialClassificationCache();
+	~FMaterialClassificationCache();
+
+	/** 캐시 없이 투명도 분류 */
+	static bool ClassifyTransparency(UMaterialInterface* Material);
+
+	/** 머티리얼 속성 변경 시 캐시 무효화 */
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& PropertyChangedEvent);
+
+	/** 싱글톤 인스턴스 */
+	static FMaterialClassificationCache* Instance;
+
+	/** 머티리얼 경로 -> 투명 여부 */
+	TMap<FString, bool> TransparencyByPath;
+
+	/** 속성 변경 델리게이트 핸들 */
+	FDelegateHandle ObjectPropertyChangedHandle;
+};
@@ -0,0 +1,91 @@
+﻿// MeshBoundsEngine.h
+// 임포트된 어셈블리의 메시 바운딩 박스 계산 엔진 (SoA + 병렬 SIMD 축약)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UStaticMeshComponent;
+
+/**
+ * 메시 바운딩 박스 SoA 버퍼
+ * 컴포넌트(또는 인스턴스)별 월드 바운딩 박스를 축별 float 배열로 저장합니다.
+ * 같은 인덱스의 원소들이 하나의 박스를 구성합니다.
+ */
+struct MYPROJECT2_API FMeshBoundsSoA
+{
+	/** 최소 좌표 (축별) */
+	TArray<float> MinX;
+	TArray<float> MinY;
+	TArray<float> MinZ;
+
+	/** 최대 좌표 (축별) */
+	TArray<float> MaxX;
+	TArray<float> MaxY;
+	TArray<float> MaxZ;
+
+	/** 박스를 제공한 컴포넌트 (보고서 출력용) */
+	TArray<TWeakObjectPtr<UStaticMeshComponent>> Components;
+
+	/** 인스턴스 인덱스 (인스턴스 컴포넌트가 아니면 INDEX_NONE) */
+	TArray<int32> InstanceIndices;
+
+	/** 버퍼 비우기 */
+	void Reset();
+
+	/**
+	 * 박스 추가
+	 * @param Box - 월드 바운딩 박스
+	 * @param Component - 박스를 제공한 컴포넌트
+	 * @param InstanceIndex - 인스턴스 인덱스
+	 */
+	void Add(const FBox& Box, UStaticMeshComponent* Component, int32 InstanceIndex = INDEX_NONE);
+
+	/** 저장된 박스 수 */
+	int32 Num() const { return MinX.Num(); }
+
+	/** 인덱스의 박스 반환 */
+	FBox GetBox(int32 Index) const;
+};
+
+/**
+ * 메시 바운딩 박스 계산 엔진
+ * 컴포넌트 박스를 평탄한 SoA 배열로 한 번 수집한 뒤,
+ * 워커 스레드에서 청크 단위로 SIMD 최소/최대 축약과 체적 계산을 수행합니다.
+ * 수집은 게임 스레드에서 호출해야 합니다.
+ */
+class MYPROJECT2_API FMeshBoundsEngine
+{
+public:
+	/**
+	 * 루트 액터와 부착된 모든 하위 액터의 스태틱 메시 박스 수집
+	 * 인스턴스 컴포넌트는 인스턴스별 박스로 펼쳐서 수집합니다.
+	 * @param RootActor - 루트 액터
+	 * @param OutBounds - [출력] 박스 버퍼 (기존 내용에 추가)
+	 * @return 추가된 박스 수
+	 */
+	static int32 CollectFromActor(AActor* RootActor, FMeshBoundsSoA& OutBounds);
+
+	/**
+	 * 전체 박스의 합집합 계산 (병렬 SIMD 축약)
+	 * @param Bounds - 박스 버퍼
+	 * @return 합집합 박스, 비어 있으면 무효 박스
+	 */
+	static FBox ReduceTotalBounds(const FMeshBoundsSoA& Bounds);
+
+	/**
+	 * 박스별 체적 계산 (병렬)
+	 * @param Bounds - 박스 버퍼
+	 * @param OutVolumes - [출력] 박스별 체적
+	 */
+	static void ComputeVolumes(const FMeshBoundsSoA& Bounds, TArray<float>& OutVolumes);
+
+	/**
+	 * 체적이 큰 순서로 상위 N개 인덱스 선택 (숫자 키 정렬)
+	 * @param Volumes - 박스별 체적
+	 * @param TopN - 선택할 개수 (0 이하이면 전체)
+	 * @param OutIndices - [출력] 체적 내림차순 인덱스
+	 */
+	static void SelectLargestByVolume(const TArray<float>& Volumes, int32 TopN, TArray<int32>& OutIndices);
+};
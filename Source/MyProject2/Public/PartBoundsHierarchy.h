@@ -0,0 +1,232 @@
+﻿// PartBoundsHierarchy.h
+// 트리 노드별 월드 바운딩 박스 계층 (임포트된 어셈블리 BVH)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class FPartBoundsHierarchy;
+class UInstancedStaticMeshComponent;
+struct FPartTreeItem;
+
+/** 잎 옥트리 원소 (잎 인덱스와 월드 박스) */
+struct FPartBoundsOctreeElement
+{
+	/** 원소 ID를 기록할 계층 */
+	FPartBoundsHierarchy* Owner = nullptr;
+
+	/** 잎 인덱스 */
+	int32 LeafIndex = INDEX_NONE;
+
+	/** 잎 월드 박스 */
+	FBoxCenterAndExtent Bounds;
+};
+
+/** 잎 옥트리 규칙 */
+struct FPartBoundsOctreeSemantics
+{
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FPartBoundsOctreeElement& Element)
+	{
+		return Element.Bounds;
+	}
+
+	FORCEINLINE static bool AreElementsEqual(const FPartBoundsOctreeElement& A, const FPartBoundsOctreeElement& B)
+	{
+		return A.LeafIndex == B.LeafIndex;
+	}
+
+	/** 원소가 옥트리 안에서 옮겨질 때 잎에 새 ID 기록 */
+	static void SetElementId(const FPartBoundsOctreeElement& Element, FOctreeElementId2 Id);
+};
+
+/**
+ * 파트 바운딩 박스 계층 클래스
+ * 임포트된 어셈블리의 메시 액터/인스턴스를 BOM 트리 노드에 대응시키고,
+ * 노드마다 자기 형상 박스와 하위 트리 합집합 박스를 캐시합니다.
+ * 액터 이동/삭제 시에는 해당 잎과 조상 노드만 다시 맞추므로
+ * 임의 트리 노드의 바운딩 박스 조회는 해시 조회 한 번으로 끝납니다.
+ * 잎 박스는 옥트리에도 등록되어 공간 질의(겹침/근접 파트)에 사용됩니다.
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+class MYPROJECT2_API FPartBoundsHierarchy
+{
+public:
+	/** 싱글톤 인스턴스 가져오기 */
+	static FPartBoundsHierarchy& Get();
+
+	/** 싱글톤 인스턴스 정리 */
+	static void Shutdown();
+
+	/**
+	 * BOM 트리 구조 설정 (트리뷰 구성 후 호출)
+	 * 기존 계층을 비우고 임포트된 모든 어셈블리를 다시 구성하도록 표시합니다.
+	 * @param RootItems - 트리 루트 항목 배열
+	 */
+	void SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems);
+
+	/**
+	 * 트리 노드의 하위 트리 전체 월드 바운딩 박스
+	 * @param PartNo - 파트 번호
+	 * @return 합집합 박스, 임포트된 형상이 없으면 무효 박스
+	 */
+	FBox GetBounds(const FString& PartNo);
+
+	/**
+	 * 박스와 겹치거나 반경 안에 있는 형상을 가진 트리 노드 찾기 (잎 옥트리 질의)
+	 * @param QueryBox - 월드 공간 질의 박스
+	 * @param OutPartNos - [출력] 해당 노드의 파트 번호 (중복 없음)
+	 * @param Radius - 박스 간 거리 허용치 (언리얼 단위 cm, 0이면 겹침만)
+	 */
+	void FindPartsIntersecting(const FBox& QueryBox, TArray<FString>& OutPartNos, float Radius = 0.0f);
+
+	/** 계층에 포함된 노드 수 */
+	int32 NumNodes() const { return Nodes.Num(); }
+
+private:
+	/** 형상 잎 (메시 액터 하나 또는 인스턴스 하나) */
+	struct FBoundsLeaf
+	{
+		/** 형상을 가진 액터 */
+		TWeakObjectPtr<AActor> Actor;
+
+		/** 액터 키 (삭제 중인 액터도 조회할 수 있도록 별도 보관) */
+		TObjectKey<AActor> ActorKey;
+
+		/** 인스턴스 컴포넌트 (인스턴스 잎일 때만) */
+		TWeakObjectPtr<UInstancedStaticMeshComponent> InstancedComponent;
+
+		/** 인스턴스 인덱스 */
+		int32 InstanceIndex = INDEX_NONE;
+
+		/** 대응된 트리 노드 파트 번호 */
+		FString NodePartNo;
+
+		/** 잎을 만든 어셈블리 파트 번호 */
+		FString AssemblyPartNo;
+
+		/** 월드 바운딩 박스 */
+		FBox Bounds = FBox(EForceInit::ForceInit);
+
+		/** 옥트리 원소 ID (박스가 무효이면 미등록) */
+		FOctreeElementId2 OctreeId;
+	};
+
+	/** 계층 노드 (BOM 트리 노드 하나) */
+	struct FBoundsNode
+	{
+		/** 부모 노드 파트 번호 (루트이면 빈 문자열) */
+		FString ParentPartNo;
+
+		/** 계층에 포함된 자식 노드 */
+		TArray<FString> Children;
+
+		/** 이 노드에 직접 대응된 잎 */
+		TArray<int32> LeafIndices;
+
+		/** BOM 루트로부터의 깊이 */
+		int32 Depth = 0;
+
+		/** 직접 대응된 형상의 박스 */
+		FBox OwnBounds = FBox(EForceInit::ForceInit);
+
+		/** 하위 트리 전체 박스 */
+		FBox SubtreeBounds = FBox(EForceInit::ForceInit);
+	};
+
+	/** 어셈블리 (임포트된 루트 액터 하나) */
+	struct FBoundsAssembly
+	{
+		TWeakObjectPtr<AActor> RootActor;
+		TArray<int32> LeafIndices;
+	};
+
+	FPartBoundsHierarchy();
+	~FPartBoundsHierarchy();
+
+	/** 대기 중인 어셈블리 재구성 처리 */
+	void FlushPendingAssemblies();
+
+	/** 전체 계층 비우기 */
+	void ResetHierarchy();
+
+	/** 어셈블리 잎 수집 및 노드 등록 */
+	void BuildAssembly(const FString& AssemblyPartNo, AActor* RootActor, TSet<FString>& DirtyNodes);
+
+	/** 어셈블리 잎 제거 */
+	void RemoveAssembly(const FString& AssemblyPartNo, TSet<FString>& DirtyNodes);
+
+	/** 잎 하나 제거 (노드/액터/어셈블리 목록에서도 제거) */
+	void RemoveLeaf(int32 LeafIndex, TSet<FString>& DirtyNodes);
+
+	/** 노드와 BOM 조상 노드 생성 */
+	FBoundsNode& EnsureNode(const FString& PartNo);
+
+	/** 더러운 노드의 자기 박스와 조상 하위 트리 박스를 깊은 노드부터 다시 계산 */
+	void Refit(const TSet<FString>& DirtyNodes);
+
+	/** 잎 박스 계산 */
+	static FBox ComputeLeafBounds(const FBoundsLeaf& Leaf);
+
+	/** 잎을 옥트리에 등록 (박스가 유효할 때만) */
+	void AddLeafToOctree(int32 LeafIndex);
+
+	/** 잎을 옥트리에서 제거 */
+	void RemoveLeafFromOctree(int32 LeafIndex);
+
+	/** 라벨을 어셈블리 하위 트리의 노드로 대응 (없으면 Fallback) */
+	static FString ResolveNodePartNo(const FString& Label, const TSet<FString>& SubtreeParts, const FString& Fallback);
+
+	// 이벤트 핸들러
+	void OnImportedNodeChanged(const FString& PartNo);
+	void OnActorMoved(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+
+	/** 싱글톤 인스턴스 */
+	static FPartBoundsHierarchy* Instance;
+
+	/** BOM 부모 (파트 번호 -> 부모 파트 번호) */
+	TMap<FString, FString> BomParents;
+
+	/** BOM 항목 (하위 트리 파트 수집용) */
+	TMap<FString, TWeakPtr<FPartTreeItem>> BomItems;
+
+	/** 계층 노드 */
+	TMap<FString, FBoundsNode> Nodes;
+
+	/** 부모가 없는 노드 */
+	TSet<FString> RootNodes;
+
+	/** 형상 잎 */
+	TSparseArray<FBoundsLeaf> Leaves;
+
+	/** 액터 -> 잎 인덱스 */
+	TMap<TObjectKey<AActor>, TArray<int32>> ActorLeaves;
+
+	/** 어셈블리 파트 번호 -> 어셈블리 */
+	TMap<FString, FBoundsAssembly> Assemblies;
+
+	/** 잎 박스 옥트리 */
+	TOctree2<FPartBoundsOctreeElement, FPartBoundsOctreeSemantics> LeafOctree;
+
+	/** 다시 구성할 어셈블리 파트 번호 */
+	TSet<FString> PendingAssemblies;
+
+	/** 모든 어셈블리 재구성 대기 여부 */
+	bool bPendingFullRebuild = true;
+
+	friend struct FPartBoundsOctreeSemantics;
+
+	// 이벤트 핸들
+	FDelegateHandle ImportedNodeChangedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+};
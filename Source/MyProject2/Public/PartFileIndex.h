@@ -0,0 +1,140 @@
+﻿// PartFileIndex.h
+// 파트 번호 -> 파일 경로 인덱스 (디렉토리 한 번 열거 후 재사용)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+// 전방 선언
+struct FPartTreeItem;
+struct FFileChangeData;
+
+/**
+ * 파트 파일 인덱스 클래스
+ * 디렉토리를 한 번만 열거하여 파일명에서 추출한 파트 번호로 파일 경로를 조회합니다.
+ * 디렉토리 감시를 켜면 파일 추가/삭제 시 인덱스가 자동으로 갱신됩니다.
+ */
+class MYPROJECT2_API FPartFileIndex
+{
+public:
+	/**
+	 * 생성자
+	 * @param InDirectoryPath - 인덱싱할 디렉토리 경로
+	 * @param InFilePattern - 파일 패턴 (예: "*.3dxml")
+	 * @param InPartIndexInFileName - 파일명을 언더바로 분리했을 때 파트번호가 위치한 인덱스
+	 * @param bInRecursive - 하위 디렉토리 포함 여부
+	 */
+	FPartFileIndex(const FString& InDirectoryPath, const FString& InFilePattern, int32 InPartIndexInFileName = 3, bool bInRecursive = false);
+	~FPartFileIndex();
+
+	/** 3DXML 파일 기본 디렉토리 (프로젝트 루트의 3DXML 폴더) */
+	static FString GetDefaultCADDirectory();
+
+	/** 디렉토리를 한 번 열거하여 인덱스 재구성 */
+	void Rebuild();
+
+	/** 디렉토리 변경 감시 시작 (파일 추가/변경/삭제 시 인덱스 갱신, 디렉토리가 없으면 생길 때까지 상위 디렉토리 감시) */
+	void StartWatching();
+
+	/** 디렉토리 변경 감시 중지 */
+	void StopWatching();
+
+	/**
+	 * 파트 번호에 해당하는 파일 경로 찾기
+	 * @param PartNo - 파트 번호
+	 * @return 파일 전체 경로, 없으면 nullptr
+	 */
+	const FString* FindFile(const FString& PartNo);
+
+	/**
+	 * 파트 번호에 해당하는 파일 존재 여부
+	 * @param PartNo - 파트 번호
+	 * @return 파일이 있으면 true
+	 */
+	bool HasFile(const FString& PartNo);
+
+	/**
+	 * 항목 또는 하위 항목 중 파일이 있는 항목이 있는지 확인
+	 * SetPartTree로 등록한 트리의 항목은 미리 계산한 하위 트리 플래그로 조회합니다.
+	 * @param Item - 확인할 항목
+	 * @return 파일이 있으면 true
+	 */
+	bool HasChildWithFile(const TSharedPtr<FPartTreeItem>& Item);
+
+	/**
+	 * 하위 트리 파일 플래그를 계산할 파트 트리 설정 (인덱스나 트리가 바뀌면 다음 조회 때 한 번 재계산)
+	 * @param RootItems - 루트 항목 배열
+	 */
+	void SetPartTree(const TArray<TSharedPtr<FPartTreeItem>>& RootItems);
+
+	/**
+	 * 같은 디렉토리/패턴/인덱스 규칙을 사용하는지 확인
+	 * @return 규칙이 일치하면 true
+	 */
+	bool Matches(const FString& InDirectoryPath, const FString& InFilePattern, int32 InPartIndexInFileName) const;
+
+	/** 인덱스 디렉토리 경로 */
+	const FString& GetDirectoryPath() const { return DirectoryPath; }
+
+	/** 전체 인덱스 (파트 번호 -> 파일 경로) */
+	const TMap<FString, FString>& GetAllFiles();
+
+	/** 인덱싱된 파일 수 */
+	int32 Num() { EnsureBuilt(); return PartNoToFilePath.Num(); }
+
+private:
+	/** 인덱스가 없거나 무효화되었으면 재구성 */
+	void EnsureBuilt();
+
+	/** 파일 하나를 인덱스에 추가 (이미 있는 파트 번호는 먼저 발견된 파일 유지) */
+	void AddFile(const FString& FullPath);
+
+	/** 디렉토리 변경 콜백 */
+	void OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+
+	/** 상위 디렉토리 변경 콜백 (인덱스 디렉토리가 생기면 감시 대상 전환) */
+	void OnParentDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+
+	/** 지정 디렉토리에 변경 콜백 등록 */
+	void RegisterWatch(const FString& InWatchedPath, bool bIncludeDirectoryChanges, void (FPartFileIndex::*Callback)(const TArray<FFileChangeData>&));
+
+	/** 등록된 트리의 항목별 하위 트리 파일 여부 재계산 (후위 순회 한 번) */
+	void RebuildSubtreeFlags();
+
+	/** 인덱싱할 디렉토리 경로 */
+	FString DirectoryPath;
+
+	/** 파일 패턴 */
+	FString FilePattern;
+
+	/** 파일명 내 파트 번호 위치 */
+	int32 PartIndexInFileName;
+
+	/** 하위 디렉토리 포함 여부 */
+	bool bRecursive;
+
+	/** 인덱스 유효 여부 */
+	bool bIsBuilt;
+
+	/** 파트 번호 -> 파일 전체 경로 */
+	TMap<FString, FString> PartNoToFilePath;
+
+	/** 디렉토리 감시 핸들 */
+	FDelegateHandle WatcherHandle;
+
+	/** 감시 중인 디렉토리 (인덱스 디렉토리가 없으면 상위 디렉토리) */
+	FString WatchedPath;
+
+	/** 감시 대상 전환 예약 핸들 (콜백 안에서는 등록 해제하지 않음) */
+	FTSTicker::FDelegateHandle WatchSwitchHandle;
+
+	/** 하위 트리 플래그를 계산할 트리의 루트 항목 */
+	TArray<TSharedPtr<FPartTreeItem>> PartTreeRoots;
+
+	/** 항목별 하위 트리 파일 여부 (등록된 트리의 모든 항목) */
+	TMap<const FPartTreeItem*, bool> SubtreeHasFile;
+
+	/** 인덱스나 트리가 바뀌어 하위 트리 플래그를 다시 계산해야 하는지 여부 */
+	bool bSubtreeFlagsDirty = true;
+};
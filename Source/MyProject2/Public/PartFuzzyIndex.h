@@ -0,0 +1,85 @@
+﻿// PartFuzzyIndex.h
+// 파트 번호/명칭 퍼지 검색 인덱스 (Ctrl+P 파트 찾기)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPartTreeItem;
+
+/**
+ * 퍼지 검색 결과 하나
+ */
+struct FPartFuzzyMatch
+{
+	/** 일치한 BOM 행 (인스턴스) */
+	TSharedPtr<FPartTreeItem> Item;
+
+	/** 점수 (높을수록 좋음) */
+	int32 Score = 0;
+
+	/** 명칭으로 일치했는지 여부 (false면 파트 번호) */
+	bool bMatchedNomenclature = false;
+};
+
+/**
+ * 파트 퍼지 검색 인덱스
+ * BOM 로드 시 모든 행을 전위 순서로 한 번 나열하면서 소문자 파트 번호/명칭, 문자 포함 비트마스크,
+ * 상위 행 인덱스를 준비해 두고, 질의마다 접두사/세그먼트/부분 문자열/편집 거리/부분 수열 일치로 점수를 매겨
+ * 상위 N개만 반환합니다. 채점은 행 묶음 단위로 병렬 수행하며 묶음마다 상위 N개만 유지합니다.
+ */
+class MYPROJECT2_API FPartFuzzyIndex
+{
+public:
+	/**
+	 * 인덱스 구성
+	 * @param RootItems - BOM 루트 항목
+	 */
+	void Build(const TArray<TSharedPtr<FPartTreeItem>>& RootItems);
+
+	/**
+	 * 질의 실행
+	 * @param Query - 검색어 (대소문자 무시, 공백/하이픈 등으로 구분된 여러 토큰 가능)
+	 * @param MaxResults - 최대 결과 수
+	 * @param OutMatches - [출력] 점수 내림차순 결과
+	 */
+	void Query(const FString& Query, int32 MaxResults, TArray<FPartFuzzyMatch>& OutMatches) const;
+
+	/**
+	 * 행의 상위 항목 목록 (루트부터 직접 부모까지)
+	 * @param Item - 대상 행
+	 * @param OutAncestors - [출력] 상위 항목
+	 */
+	void GetAncestors(const FPartTreeItem* Item, TArray<TSharedPtr<FPartTreeItem>>& OutAncestors) const;
+
+	/**
+	 * 행의 상위 경로 문자열
+	 * @param Item - 대상 행
+	 * @return 예: "FA50 > WING-ASSY > SPAR-01" (루트 행이면 빈 문자열)
+	 */
+	FString GetAncestorPath(const FPartTreeItem* Item) const;
+
+	/** 인덱스에 포함된 행 수 */
+	int32 Num() const { return Candidates.Num(); }
+
+private:
+	/** 미리 준비된 검색 후보 (BOM 행 하나) */
+	struct FCandidate
+	{
+		TSharedPtr<FPartTreeItem> Item;
+		FString PartNoLower;
+		FString NomenclatureLower;
+
+		/** 파트 번호와 명칭에 포함된 문자 비트마스크 (부분 수열 일치 사전 배제용) */
+		uint64 CharMask = 0;
+
+		/** 부모 행 인덱스 (루트면 INDEX_NONE) */
+		int32 ParentIndex = INDEX_NONE;
+	};
+
+	/** 전위 순서 후보 */
+	TArray<FCandidate> Candidates;
+
+	/** 항목 -> 후보 인덱스 */
+	TMap<const FPartTreeItem*, int32> ItemToIndex;
+};
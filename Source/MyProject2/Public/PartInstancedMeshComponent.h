@@ -0,0 +1,39 @@
+﻿// PartInstancedMeshComponent.h
+// 반복 파트(체결류/표준품)를 인스턴스로 묶는 컴포넌트
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "PartInstancedMeshComponent.generated.h"
+
+/**
+ * 파트 인스턴스 메시 컴포넌트
+ * 같은 메시/머티리얼 조합의 스태틱 메시 액터들을 대체하며,
+ * 인스턴스별로 원래 액터 라벨(파트 번호)을 보존하여 트리 선택과 연결합니다.
+ */
+UCLASS(ClassGroup = Rendering)
+class MYPROJECT2_API UPartInstancedMeshComponent : public UHierarchicalInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** 인스턴스별 원래 액터 라벨 (인스턴스 인덱스와 같은 순서) */
+	UPROPERTY(VisibleAnywhere, Category = "Part Instances")
+	TArray<FString> InstancePartLabels;
+
+	/**
+	 * 파트 번호와 일치하는 인스턴스 찾기
+	 * 라벨이 정확히 일치하는 인스턴스를 먼저 찾고, 없으면 라벨에 파트 번호가 포함된 인스턴스를 찾습니다.
+	 * @param PartNo - 파트 번호
+	 * @return 인스턴스 인덱스, 없으면 INDEX_NONE
+	 */
+	int32 FindInstanceByPartNo(const FString& PartNo) const;
+
+	/**
+	 * 인스턴스의 월드 바운딩 박스
+	 * @param InstanceIndex - 인스턴스 인덱스
+	 * @return 월드 바운딩 박스 (잘못된 인덱스면 무효 박스)
+	 */
+	FBox GetInstanceWorldBounds(int32 InstanceIndex) const;
+};
@@ -84,6 +84,20 @@ public:
     virtual bool PassesFilter(const TSharedPtr<FPartTreeItem>& Item) const override;
 };
 
+/**
+ * CAD 파일 필터 - 3DXML 파일이 있는 노드만 표시
+ */
+class FCADFileFilter : public IPartTreeViewFilter
+{
+public:
+    FCADFileFilter() {}
+
+    virtual FString GetFilterName() const override { return TEXT("CADFileFilter"); }
+    virtual FString GetFilterDescription() const override { return TEXT("Show only nodes with 3DXML files"); }
+
+    virtual bool PassesFilter(const TSharedPtr<FPartTreeItem>& Item) const override;
+};
+
 /**
  * 중복 노드 필터 - 중복된 파트 번호를 필터링
  */
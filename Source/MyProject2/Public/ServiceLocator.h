@@ -16,6 +16,11 @@ public:
 	static void RegisterImageManager(class FPartImageManager* Manager);
 	static class FPartImageManager* GetImageManager();
 
+	// 3DXML 파일 인덱스 관련 (등록되지 않았으면 nullptr, 호출 측에서 디렉토리 직접 검색으로 대체)
+	static void RegisterCADFileIndex(class FPartFileIndex* Index);
+	static class FPartFileIndex* GetCADFileIndex();
+
 private:
 	static class FPartImageManager* ImageManagerInstance;
+	static class FPartFileIndex* CADFileIndexInstance;
 };
\ No newline at end of file
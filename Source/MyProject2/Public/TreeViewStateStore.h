@@ -0,0 +1,74 @@
+﻿// TreeViewStateStore.h
+// BOM별 트리뷰 상태(펼침/선택/스크롤/필터/검색어) 저장 및 복원
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPartTreeItem;
+
+/**
+ * 저장된 트리뷰 상태
+ * 노드는 BOM 트리 전위 순회 순번(행 번호)으로 식별합니다.
+ * 상태는 BOM 파일 내용 해시별로 저장되므로 같은 BOM이면 행 번호가 같은 노드를 가리킵니다.
+ */
+struct FTreeViewSavedState
+{
+	/** 펼친 노드 행 번호 (오름차순) */
+	TArray<int32> ExpandedRows;
+
+	/** 선택된 노드 행 번호 (오름차순) */
+	TArray<int32> SelectedRows;
+
+	/** 스크롤 위치 (행 단위) */
+	float ScrollOffset = 0.0f;
+
+	/** 활성화된 필터 이름 */
+	TArray<FString> EnabledFilters;
+
+	/** 검색어 */
+	FString SearchText;
+};
+
+/**
+ * 트리뷰 상태 저장소
+ * Saved/TreeViewState/<BOM 해시>.json 에 상태를 저장합니다.
+ * 행 번호 배열은 정렬 후 이전 값과의 차이로 기록하여 펼친 노드가 많아도 파일이 작게 유지됩니다.
+ */
+class MYPROJECT2_API FTreeViewStateStore
+{
+public:
+	/**
+	 * BOM 파일 내용 해시 계산
+	 * @param BomFilePath - BOM CSV 경로
+	 * @return MD5 해시 문자열, 실패 시 빈 문자열
+	 */
+	static FString ComputeBomHash(const FString& BomFilePath);
+
+	/**
+	 * BOM 트리를 전위 순회 순서로 나열 (행 번호 = 배열 인덱스)
+	 * @param RootItems - 루트 항목
+	 * @param OutRows - [출력] 전위 순회 순서의 모든 항목
+	 */
+	static void FlattenPreOrder(const TArray<TSharedPtr<FPartTreeItem>>& RootItems, TArray<TSharedPtr<FPartTreeItem>>& OutRows);
+
+	/**
+	 * 저장된 상태 읽기
+	 * @param BomHash - BOM 파일 내용 해시
+	 * @param OutState - [출력] 저장된 상태
+	 * @return 저장된 상태가 있는지 여부
+	 */
+	static bool Load(const FString& BomHash, FTreeViewSavedState& OutState);
+
+	/**
+	 * 상태 저장
+	 * @param BomHash - BOM 파일 내용 해시
+	 * @param State - 저장할 상태
+	 * @return 저장 성공 여부
+	 */
+	static bool Save(const FString& BomHash, const FTreeViewSavedState& State);
+
+private:
+	/** 상태 파일 경로 */
+	static FString GetStateFilePath(const FString& BomHash);
+};
@@ -7,6 +7,8 @@
 
 // FPartTreeItem 구조체 전방 선언
 struct FPartTreeItem;
+class AActor;
+class AStaticMeshActor;
 
 /**
  * 파일 일치 결과 구조체
@@ -36,6 +38,85 @@ struct FFileMatchResult
     }
 };
 
+/**
+ * 다중 선택 집계 결과 구조체
+ * 선택된 항목들과 그 하위 트리 전체에 대한 통계를 저장합니다.
+ */
+struct FPartSelectionStats
+{
+    /** 선택된 항목 수 */
+    int32 SelectedCount = 0;
+    
+    /** 하위 트리를 포함한 전체 노드 수 (중복 경로 제외) */
+    int32 TotalNodeCount = 0;
+    
+    /** 선택 항목을 1개로 보고 Qty를 곱해 내려간 누적 수량의 합 */
+    double TotalRolledUpQty = 0.0;
+    
+    /** 임포트된 노드 수 */
+    int32 ImportedCount = 0;
+    
+    /** 이미지가 있는 노드 수 */
+    int32 WithImageCount = 0;
+    
+    /** 유형별 노드 수 */
+    TMap<FString, int32> TypeCounts;
+    
+    /** 파트 상태별 노드 수 */
+    TMap<FString, int32> StatusCounts;
+    
+    /** 다른 부분 집계 결과 병합 */
+    void Merge(const FPartSelectionStats& Other)
+    {
+        TotalNodeCount += Other.TotalNodeCount;
+        TotalRolledUpQty += Other.TotalRolledUpQty;
+        ImportedCount += Other.ImportedCount;
+        WithImageCount += Other.WithImageCount;
+        for (const TPair<FString, int32>& Pair : Other.TypeCounts)
+        {
+            TypeCounts.FindOrAdd(Pair.Key) += Pair.Value;
+        }
+        for (const TPair<FString, int32>& Pair : Other.StatusCounts)
+        {
+            StatusCounts.FindOrAdd(Pair.Key) += Pair.Value;
+        }
+    }
+};
+
+/**
+ * BOM 증분 갱신 결과 구조체
+ * 다시 읽은 BOM을 로드된 모델에 반영한 행 단위 변경 내역을 저장합니다.
+ */
+struct FBomPatchStats
+{
+    /** 새로 추가된 행 수 */
+    int32 AddedCount = 0;
+    
+    /** 삭제된 행 수 */
+    int32 RemovedCount = 0;
+    
+    /** 필드 값이 바뀐 행 수 */
+    int32 UpdatedCount = 0;
+    
+    /** 부모-자식 연결이 바뀌었는지 여부 */
+    bool bStructureChanged = false;
+    
+    /** 필드 값이 바뀌었거나 자식 목록이 바뀐 기존 항목 */
+    TArray<TSharedPtr<FPartTreeItem>> ChangedItems;
+    
+    /** 삭제된 항목 */
+    TArray<TSharedPtr<FPartTreeItem>> RemovedItems;
+    
+    /** 갱신 시간 (초, CSV 읽기 포함) */
+    double Seconds = 0.0;
+    
+    /** 변경 사항이 있는지 여부 */
+    bool HasChanges() const
+    {
+        return AddedCount > 0 || RemovedCount > 0 || UpdatedCount > 0 || bStructureChanged;
+    }
+};
+
 /**
  * 트리뷰 유틸리티 클래스
  * CSV 파일 처리 및 일반 유틸리티 함수들을 제공합니다.
@@ -93,6 +174,32 @@ public:
 	 */
 	static FText GetFormattedMetadata(const TSharedPtr<FPartTreeItem>& Item);
 
+	/**
+	 * 항목의 메타데이터를 (라벨, 값) 쌍 목록으로 반환하는 함수
+	 * 메타데이터 패널의 속성 그리드 행 구성에 사용됩니다.
+	 * @param Item - 메타데이터를 가져올 항목
+	 * @param OutFields - [출력] (라벨, 값) 쌍 배열
+	 */
+	static void GetMetadataFields(const TSharedPtr<FPartTreeItem>& Item, TArray<TPair<FString, FString>>& OutFields);
+
+	/**
+	 * 선택된 항목들과 하위 트리 전체의 집계 통계 계산
+	 * 선택 루트마다 워커 스레드에서 하위 트리 순회와 집계를 수행하고 병합합니다.
+	 * 선택 루트 아래의 다른 선택 루트는 한 번만 집계되며, 누적 수량은 가장 가까운 선택 조상의 배수를 따릅니다.
+	 * 게임 스레드에서 호출해야 합니다 (임포트 상태 스냅샷 생성).
+	 * @param SelectedItems - 선택된 트리 항목 배열
+	 * @param OutStats - [출력] 집계 결과
+	 */
+	static void ComputeSelectionStats(const TArray<TSharedPtr<FPartTreeItem>>& SelectedItems, FPartSelectionStats& OutStats);
+
+	/**
+	 * 항목과 하위 트리에서 임포트된 루트 액터 수집
+	 * 이미 수집된 액터의 하위에 붙어 있는 액터는 제외합니다.
+	 * @param Item - 시작 항목
+	 * @param OutActors - [출력] 임포트된 루트 액터 배열
+	 */
+	static void CollectImportedActorsInSubtree(const TSharedPtr<FPartTreeItem>& Item, TArray<AActor*>& OutActors);
+
 	/**
 	 * 안전한 문자열 반환 함수
 	 * @param InStr - 입력 문자열
@@ -122,6 +229,56 @@ public:
 		int32& OutMaxLevel,
 		TArray<TSharedPtr<FPartTreeItem>>& OutRootItems);
 
+	/**
+	 * 레벨별 항목을 NextPart 기준으로 부모-자식 연결하여 트리 구조 구축
+	 * 루트 항목이 비어 있으면 레벨 0 항목을 루트로 설정합니다.
+	 * @param PartNoToItemMap - 파트 번호별 항목 맵
+	 * @param LevelToItemsMap - 레벨별 항목 맵
+	 * @param MaxLevel - 최대 레벨 깊이
+	 * @param InOutRootItems - [입출력] 루트 항목 배열
+	 */
+	static void BuildTreeStructure(
+		const TMap<FString, TSharedPtr<FPartTreeItem>>& PartNoToItemMap,
+		TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& LevelToItemsMap,
+		int32 MaxLevel,
+		TArray<TSharedPtr<FPartTreeItem>>& InOutRootItems);
+
+	/**
+	 * BOM CSV 파일을 읽어 항목 생성부터 트리 구조 구축까지 수행 (트리뷰와 커맨드렛 공용, Slate 불필요)
+	 * @param FilePath - BOM CSV 파일 경로
+	 * @param OutPartNoToItemMap - [출력] 파트 번호별 항목 맵
+	 * @param OutLevelToItemsMap - [출력] 레벨별 항목 맵
+	 * @param OutMaxLevel - [출력] 최대 레벨 깊이
+	 * @param OutRootItems - [출력] 루트 항목 배열
+	 * @return CSV 파일을 읽었는지 여부 (데이터 행이 없으면 false)
+	 */
+	static bool LoadBomTree(
+		const FString& FilePath,
+		TMap<FString, TSharedPtr<FPartTreeItem>>& OutPartNoToItemMap,
+		TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& OutLevelToItemsMap,
+		int32& OutMaxLevel,
+		TArray<TSharedPtr<FPartTreeItem>>& OutRootItems);
+
+	/**
+	 * BOM CSV를 다시 읽어 로드된 모델에 행 단위 변경만 반영
+	 * 레벨/파트 번호/상위 파트가 같은 행은 기존 항목 객체를 그대로 유지하고 값만 갱신하므로
+	 * 트리뷰의 펼침/선택/스크롤 상태가 보존됩니다. 추가된 행만 새 항목을 만들고 삭제된 행은 제거합니다.
+	 * @param FilePath - BOM CSV 파일 경로
+	 * @param InOutPartNoToItemMap - [입출력] 파트 번호별 항목 맵
+	 * @param InOutLevelToItemsMap - [입출력] 레벨별 항목 맵
+	 * @param InOutMaxLevel - [입출력] 최대 레벨 깊이
+	 * @param InOutRootItems - [입출력] 루트 항목 배열
+	 * @param OutStats - [출력] 변경 내역
+	 * @return CSV 파일을 읽었는지 여부 (실패하면 모델은 바뀌지 않음)
+	 */
+	static bool PatchBomTree(
+		const FString& FilePath,
+		TMap<FString, TSharedPtr<FPartTreeItem>>& InOutPartNoToItemMap,
+		TMap<int32, TArray<TSharedPtr<FPartTreeItem>>>& InOutLevelToItemsMap,
+		int32& InOutMaxLevel,
+		TArray<TSharedPtr<FPartTreeItem>>& InOutRootItems,
+		FBomPatchStats& OutStats);
+
     /**
      * 특정 디렉토리에서 PartNo와 일치하는 파일 찾기
      * @param DirectoryPath - 검색할 디렉토리 경로
@@ -147,14 +304,30 @@ public:
 	// 바운딩 박스 계산 함수 선언 추가
 	/**
 	 * 선택된 액터와 자식의 모든 스태틱 메시 컴포넌트의 바운딩 박스 계산
+	 * 전체 박스는 병렬로 계산하고, 컴포넌트별 정보는 체적 상위 N개만 로그로 출력합니다.
 	 * @param ActorName - 선택적 액터 이름 필터 (비어있으면 모든 액터에 대해 계산)
+	 * @param TopN - 로그로 출력할 컴포넌트 수 (0 이하이면 전체)
 	 * @return 성공 여부
 	 */
-	static bool CalculateSelectedActorMeshBounds(const FString& ActorName = TEXT(""));
+	static bool CalculateSelectedActorMeshBounds(const FString& ActorName = TEXT(""), int32 TopN = 20);
 
 	/**
 	 * 선택된 액터의 피벗을 바운딩 박스 중심으로 이동
+	 * 첫 번째 선택 액터가 메시 액터가 아니면 그 액터의 피벗을 옮기고,
+	 * 메시 액터만 선택된 경우에만 중심에 새 부모 액터를 만듭니다.
 	 * @return 성공 여부
 	 */
 	static bool SetActorPivotToCenter();
+
+	/**
+	 * 액터의 피벗을 옮기고 메시 액터들을 월드 위치 그대로 직접 자식으로 연결 (일괄 처리)
+	 * 새 상대 변환을 한 번에 계산해 변환 전파 없이 기록한 뒤, 피벗 이동 한 번으로
+	 * 직접 자식의 월드 변환을 갱신하고 다른 부모 아래 있던 액터만 상대 변환 유지로 붙입니다.
+	 * 호출자가 트랜잭션을 열어야 합니다.
+	 * @param PivotActor - 피벗을 옮길 액터 (루트 컴포넌트가 없으면 생성)
+	 * @param MeshActors - 피벗 액터 아래에 둘 메시 액터 배열
+	 * @param PivotLocation - 새 피벗 월드 위치
+	 * @return 연결된 메시 액터 수
+	 */
+	static int32 MovePivotAndReparent(AActor* PivotActor, const TArray<AStaticMeshActor*>& MeshActors, const FVector& PivotLocation);
 };
\ No newline at end of file
@@ -59,12 +59,18 @@ private:
 
     /** 재질 업데이트 정책 옵션 */
     TArray<TSharedPtr<FString>> MaterialUpdateOptions;
+
+    /** 품질 단계 옵션 */
+    TArray<TSharedPtr<FString>> QualityTierOptions;
     
     /** 체크박스 위젯 레퍼런스 */
     TArray<TWeakPtr<SCheckBox>> CheckboxWidgets;
     
     /** 콤보박스 위젯 레퍼런스 */
     TWeakPtr<SComboBox<TSharedPtr<FString>>> MaterialPolicyComboBox;
+
+    /** 품질 단계 콤보박스 */
+    TWeakPtr<SComboBox<TSharedPtr<FString>>> QualityTierComboBox;
 };
 
 /**
@@ -4,18 +4,25 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
-#include "Widgets/Views/STreeView.h"
+#include "Widgets/Views/SListView.h"
 #include "Widgets/Images/SImage.h"
 #include "PartTreeViewFilter.h"
+#include "PartFuzzyIndex.h"
 #include "UI/PartTreeItem.h"
 
 // 전방 선언
 class SPartMetadataWidget;
+class IMenu;
 class FPartTreeViewFilterManager;
+class FActiveTimerHandle;
+struct FBomDiffResult;
+struct FFileChangeData;
 
 /**
  * 레벨 기반 트리뷰 위젯 클래스
  * CSV 파일에서 로드한 파트 정보를 계층 구조로 표시합니다.
+ * 보이는 행은 전위 순서로 평탄화한 배열을 직접 유지하여 리스트뷰에 들여쓰기로 표시하며,
+ * 펼침/접힘 시에는 바뀐 하위 행만 삽입/삭제하고 필터나 검색이 바뀔 때만 전체를 다시 구성합니다.
  */
 class MYPROJECT2_API SLevelBasedTreeView : public SCompoundWidget
 {
@@ -42,8 +49,24 @@ public:
     /** 위젯 생성 함수 */
     void Construct(const FArguments& InArgs);
     
+    /** 소멸자 (BOM 파일 감시 해제) */
+    virtual ~SLevelBasedTreeView();
+    
     /** CSV 파일 로드 및 트리뷰 구성 */
     bool BuildTreeView(const FString& FilePath);
+    
+    /**
+     * 로드된 BOM CSV를 다시 읽어 바뀐 행만 트리에 반영
+     * 기존 항목 객체를 유지하므로 펼침/선택/스크롤 위치가 그대로 남습니다.
+     * @return 변경 사항이 반영되었는지 여부
+     */
+    bool ReloadBomIncremental();
+    
+    /**
+     * 현재 트리뷰 상태(펼침/선택/스크롤/필터/검색어)를 BOM 해시별로 저장
+     * 탭을 닫을 때와 위젯이 소멸될 때 호출됩니다.
+     */
+    void SaveTreeState();
 
     //===== 검색 및 필터링 기능 =====//
     
@@ -53,6 +76,16 @@ public:
     /** 항목과 하위 항목을 재귀적으로 펼치거나 접기 */
     void ExpandItemRecursively(TSharedPtr<FPartTreeItem> Item, bool bExpand);
     
+    /**
+     * 항목 펼침/접힘 (보이는 행 배열에서 해당 하위 행만 삽입/삭제)
+     * @param Item - 대상 항목
+     * @param bExpand - 펼칠지 여부
+     */
+    void SetItemExpansion(const TSharedPtr<FPartTreeItem>& Item, bool bExpand);
+    
+    /** 항목이 펼쳐져 있는지 여부 */
+    bool IsItemExpanded(const TSharedPtr<FPartTreeItem>& Item) const { return ExpandedItems.Contains(Item); }
+    
     /** 검색 UI 위젯 반환 */
     TSharedRef<SWidget> GetSearchWidget();
     
@@ -67,8 +100,8 @@ public:
     /** 메타데이터 위젯 반환 */
     TSharedRef<SWidget> GetMetadataWidget();
     
-    /** 선택된 항목 메타데이터 텍스트 반환 */
-    FText GetSelectedItemMetadata() const;
+    /** 선택된 항목 메타데이터 텍스트 반환 (선택 변경 시 캐시된 값) */
+    FText GetSelectedItemMetadata() const { return CachedSelectedMetadata; }
     
     /** 설정 핸들러 **/
     FReply OnSettingsButtonClicked();
@@ -87,6 +120,40 @@ public:
 	 * @return 노드 선택 성공 여부
 	 */
 	bool SelectNodeByPartNo(const FString& PartNo);
+	
+	/**
+	 * 특정 인스턴스 노드 선택 (같은 파트 번호의 다른 인스턴스와 구분)
+	 * 퍼지 인덱스의 정확한 상위 경로를 위에서부터 펼친 뒤 선택합니다.
+	 * @param Item - 선택할 항목
+	 * @return 노드 선택 성공 여부
+	 */
+	bool SelectItemInstance(const TSharedPtr<FPartTreeItem>& Item);
+	
+	/** Ctrl+P 파트 찾기 팝업 열기 */
+	void OpenFuzzyFinder();
+	
+	/**
+	 * 기준 노드의 형상과 겹치거나 반경 안에 있는 파트 노드 선택 및 강조
+	 * 기준 노드와 그 하위 노드는 결과에서 제외합니다.
+	 * @param SourceItem - 기준 노드
+	 * @param RadiusMm - 거리 허용치 (mm, 0이면 겹침만)
+	 * @return 선택된 노드 수
+	 */
+	int32 SelectPartsNear(const TSharedPtr<FPartTreeItem>& SourceItem, float RadiusMm);
+	
+	/** 근접 파트 강조 해제 */
+	void ClearProximityHighlight();
+	
+	/**
+	 * 현재 BOM을 이전 BOM CSV와 비교하여 변경 노드를 색상으로 표시
+	 * 추가/이동/개정/수량 변경 노드와 삭제된 하위 노드가 있는 노드까지 경로를 펼칩니다.
+	 * @param OldFilePath - 이전 BOM CSV 경로
+	 * @return 비교 성공 여부
+	 */
+	bool CompareWithBom(const FString& OldFilePath);
+	
+	/** BOM 비교 표시 해제 */
+	void ClearBomDiff();
 
 private:
 	// 싱글톤 인스턴스
@@ -104,6 +171,7 @@ private:
     TSharedPtr<SCheckBox> ImageFilterCheckbox;
     TSharedPtr<SCheckBox> ImportedNodesFilterCheckbox;
     TSharedPtr<SCheckBox> DuplicateFilterCheckbox;
+    TSharedPtr<SCheckBox> CADFileFilterCheckbox;
     
     // 필터 버튼 클릭 이벤트 핸들러
     FReply OnFilterButtonClicked();
@@ -120,17 +188,23 @@ private:
 	// 중복 노드 필터 체크박스 변경 이벤트 핸들러
 	void OnDuplicateFilterCheckedChanged(ECheckBoxState NewState);
     
+	// CAD 파일 필터 체크박스 변경 이벤트 핸들러
+	void OnCADFileFilterCheckedChanged(ECheckBoxState NewState);
+    
 	// 임포트된 노드 필터 활성화/비활성화
 	void ToggleImportedNodesFiltering(bool bEnable);
     
 	// 중복 노드 필터 활성화/비활성화
 	void ToggleDuplicateFiltering(bool bEnable);
     
+	// CAD 파일 필터 활성화/비활성화
+	void ToggleCADFileFiltering(bool bEnable);
+    
     /** 레벨 0 항목들을 접는 헬퍼 함수 */
     void FoldLevelZeroItems();
     
-    /** 검색 실행 */
-    void PerformSearch(const FString& InSearchText);
+    /** 검색 실행 (bSelectFirstResult면 잠시 후 첫 번째 결과로 이동) */
+    void PerformSearch(const FString& InSearchText, bool bSelectFirstResult = true);
     
     /** 항목까지의 경로 펼치기 */
     void ExpandPathToItem(const TSharedPtr<FPartTreeItem>& Item);
@@ -143,14 +217,145 @@ private:
 	TSharedPtr<FPartTreeViewFilterManager> FilterManager;
     
     //===== 트리뷰 및 데이터 관련 변수 =====//
-    TSharedPtr<STreeView<TSharedPtr<FPartTreeItem>>> TreeView; // 트리뷰 위젯
+    TSharedPtr<SListView<TSharedPtr<FPartTreeItem>>> TreeView; // 보이는 행을 표시하는 리스트뷰 위젯
     TArray<TSharedPtr<FPartTreeItem>> AllRootItems;            // 모든 루트 항목
     TMap<FString, TSharedPtr<FPartTreeItem>> PartNoToItemMap;  // 파트 번호별 항목 맵
     TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> LevelToItemsMap; // 레벨별 항목 맵
     int32 MaxLevel;                                            // 최대 레벨 깊이
     
-    /** 트리 구조 구축 (부모-자식 관계 설정) */
-    void BuildTreeStructure();
+    //===== 평탄화된 보이는 행 =====//
+    /** 전위 순서의 보이는 행 (리스트뷰 항목 소스, 들여쓰기 깊이는 항목 레벨) */
+    TArray<TSharedPtr<FPartTreeItem>> VisibleRows;
+    
+    /** 펼쳐진 항목 */
+    TSet<TSharedPtr<FPartTreeItem>> ExpandedItems;
+    
+    /** 항목별 필터/검색을 통과한 자식 (필터나 검색이 바뀌면 비움) */
+    TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>> VisibleChildrenCache;
+    
+    /** 검색 결과와 그 상위 경로의 항목 (검색 중 자식 표시 판정) */
+    TSet<const FPartTreeItem*> SearchPathItems;
+    
+    /** 보이는 행의 항목별 행 인덱스 (행을 잘라 붙일 때마다 갱신) */
+    TMap<const FPartTreeItem*, int32> RowIndexMap;
+    
+    /** 보이는 행 편집 단위 (이전 행 인덱스 기준) */
+    struct FRowSplice
+    {
+        int32 Index = 0;                                 // 편집 위치
+        int32 RemovedCount = 0;                          // 위치부터 삭제할 행 수
+        TArray<TSharedPtr<FPartTreeItem>> InsertedRows;  // 위치에 삽입할 행
+    };
+    
+    /** 보이는 행 전체 재구성 (트리 구성, 여러 항목 펼침 시) */
+    void RebuildVisibleRows();
+    
+    /**
+     * 필터/검색/BOM 구조 변경 후 보이는 자식이 바뀐 하위 트리만 잘라 붙임
+     * @param PreviousRootItems - 현재 보이는 행을 구성할 때의 루트 항목
+     */
+    void RefreshVisibleRows(const TArray<TSharedPtr<FPartTreeItem>>& PreviousRootItems);
+    
+    /**
+     * 이전 자식 목록과 새 자식 목록을 비교하여 바뀐 자식의 하위 트리 편집을 수집
+     * @param OldChildren - 보이는 행에 있는 이전 자식
+     * @param NewChildren - 새로 필터/검색을 통과한 자식
+     * @param FirstRowIndex - 첫 자식의 행 인덱스
+     * @param EndRowIndex - 부모 하위 행 범위의 끝 (포함하지 않음)
+     * @param PreviousChildren - 이전 보이는 자식 캐시
+     * @param OutSplices - 행 인덱스 오름차순으로 추가되는 편집 목록
+     */
+    void DiffVisibleChildren(const TArray<TSharedPtr<FPartTreeItem>>& OldChildren, const TArray<TSharedPtr<FPartTreeItem>>& NewChildren,
+        int32 FirstRowIndex, int32 EndRowIndex, const TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>>& PreviousChildren,
+        TArray<FRowSplice>& OutSplices);
+    
+    /** 유지되는 항목 아래의 하위 행 편집 수집 (행 범위는 [RowIndex, EndRowIndex)) */
+    void DiffVisibleSubtree(const TSharedPtr<FPartTreeItem>& Item, int32 RowIndex, int32 EndRowIndex,
+        const TMap<const FPartTreeItem*, TArray<TSharedPtr<FPartTreeItem>>>& PreviousChildren, TArray<FRowSplice>& OutSplices);
+    
+    /** 편집 목록을 보이는 행에 적용하고 첫 편집 위치부터 행 인덱스 갱신 */
+    void ApplyRowSplices(TArray<FRowSplice>& Splices);
+    
+    /** 시작 위치부터 끝까지 행 인덱스 맵 갱신 */
+    void ReindexRows(int32 StartIndex);
+    
+    /** 항목의 보이는 행 인덱스 (보이지 않으면 INDEX_NONE) */
+    int32 FindRowIndex(const TSharedPtr<FPartTreeItem>& Item) const;
+    
+    /** 여러 항목을 한 번에 펼치거나 접고 보이는 행은 한 번만 재구성 */
+    void SetItemsExpansion(const TArray<TSharedPtr<FPartTreeItem>>& Items, bool bExpand);
+    
+    /** 항목의 보이는 자식 (캐시) */
+    const TArray<TSharedPtr<FPartTreeItem>>& GetVisibleChildren(const TSharedPtr<FPartTreeItem>& Item);
+    
+    /** 항목 아래에서 보이는 하위 행을 전위 순서로 추가 */
+    void AppendVisibleDescendants(const TSharedPtr<FPartTreeItem>& Item, TArray<TSharedPtr<FPartTreeItem>>& OutRows);
+    
+    /** 검색 결과의 상위 경로 집합 재구성 */
+    void RebuildSearchPaths();
+
+    //===== 선택 캐시 =====//
+    /** 마지막으로 선택된 항목 (선택 변경 시 갱신) */
+    TSharedPtr<FPartTreeItem> CachedSelectedItem;
+    
+    /** 선택된 항목의 형식화된 메타데이터 (선택 변경 시 한 번만 계산) */
+    FText CachedSelectedMetadata;
+    
+    /** 선택 캐시 갱신 */
+    void UpdateSelectionCache(TSharedPtr<FPartTreeItem> Item);
+    
+    //===== 근접 파트 강조 =====//
+    /** 근접 파트 질의 결과로 강조 중인 파트 번호 */
+    TSet<FString> ProximityHighlightPartNos;
+    
+    //===== BOM 비교 =====//
+    /** 현재 로드된 BOM CSV 경로 */
+    FString LoadedBomFilePath;
+    
+    /** BOM 비교 결과 (비교 중이 아니면 없음) */
+    TSharedPtr<FBomDiffResult> BomDiffResult;
+    
+    /** 이전 BOM 파일 선택 대화상자를 열어 비교 */
+    void PromptCompareWithBom();
+    
+    //===== 트리뷰 상태 저장 =====//
+    /** 로드된 BOM 파일 내용 해시 (상태 저장 키) */
+    FString LoadedBomHash;
+    
+    //===== 파트 찾기 =====//
+    /** 로드 시 한 번 구성하는 퍼지 검색 인덱스 */
+    TSharedPtr<FPartFuzzyIndex> FuzzyIndex;
+    
+    /** 열려 있는 파트 찾기 팝업 */
+    TWeakPtr<IMenu> FuzzyFinderMenu;
+    
+    /** 저장된 상태 복원 중 여부 (복원 중에는 지연 형상 임포트를 요청하지 않음) */
+    bool bRestoringTreeState = false;
+    
+    /** 저장된 트리뷰 상태를 한 번에 복원 */
+    bool RestoreTreeState();
+    
+    //===== BOM 파일 감시 =====//
+    /** 감시 중인 BOM 디렉토리 */
+    FString WatchedBomDirectory;
+    
+    /** 디렉토리 감시 핸들 */
+    FDelegateHandle BomWatcherHandle;
+    
+    /** 증분 갱신 지연 타이머 (파일 저장 중 여러 번 오는 변경 알림을 한 번으로 묶음) */
+    TSharedPtr<FActiveTimerHandle> BomReloadTimerHandle;
+    
+    /** 로드된 BOM 파일의 디렉토리 감시 시작 */
+    void StartWatchingBomFile();
+    
+    /** BOM 파일 감시 해제 */
+    void StopWatchingBomFile();
+    
+    /** BOM 디렉토리 변경 콜백 */
+    void OnBomDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+    
+    /** 지연 타이머 만료 시 증분 갱신 */
+    EActiveTimerReturnType OnBomReloadTimer(double InCurrentTime, float InDeltaTime);
 
     //===== 이벤트 핸들러 =====//
     
@@ -160,16 +365,28 @@ private:
     /** 트리뷰 항목 더블클릭 이벤트 */
     void OnTreeItemDoubleClick(TSharedPtr<FPartTreeItem> Item);
     
+    /** 트리뷰 항목 펼침/접힘 이벤트 (지연 형상 임포트 요청) */
+    void OnItemExpansionChanged(TSharedPtr<FPartTreeItem> Item, bool bExpanded);
+    
+    /** 행의 펼침 화살표 클릭 이벤트 */
+    FReply OnExpanderClicked(TSharedPtr<FPartTreeItem> Item);
+    
+    /** 키 입력 이벤트 (좌/우 화살표로 선택 항목 접기/펼치기, Ctrl+P로 파트 찾기) */
+    FReply OnTreeKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent);
+    
     /** 컨텍스트 메뉴 생성 */
     TSharedPtr<SWidget> OnContextMenuOpening();
+    
+    /** 어셈블리 서브레벨 체크박스 상태 (로드 여부) */
+    ECheckBoxState GetCellCheckState(TSharedPtr<FPartTreeItem> Item) const;
+    
+    /** 어셈블리 서브레벨 체크박스 변경 이벤트 (서브레벨 로드/언로드) */
+    void OnCellCheckStateChanged(ECheckBoxState NewState, TSharedPtr<FPartTreeItem> Item);
 
     //===== 트리뷰 델리게이트 =====//
     
     /** 트리뷰 행 생성 델리게이트 */
     TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FPartTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
-    
-    /** 트리뷰 자식 항목 반환 델리게이트 */
-    void OnGetChildren(TSharedPtr<FPartTreeItem> Item, TArray<TSharedPtr<FPartTreeItem>>& OutChildren);
 };
 
 /**
@@ -0,0 +1,74 @@
+﻿// PartFuzzyFinder.h
+// Ctrl+P 파트 찾기 팝업 위젯
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "PartFuzzyIndex.h"
+
+class SSearchBox;
+class STextBlock;
+struct FPartTreeItem;
+
+DECLARE_DELEGATE_OneParam(FOnPartFuzzyMatchChosen, TSharedPtr<FPartTreeItem>);
+
+/**
+ * 파트 퍼지 찾기 위젯
+ * 입력할 때마다 퍼지 인덱스에서 상위 결과를 받아 파트 번호, 명칭, 상위 경로를 함께 표시하므로
+ * 같은 파트의 여러 인스턴스 중 원하는 위치를 고를 수 있습니다.
+ * 위/아래 키로 결과를 이동하고 Enter로 선택, Esc로 닫습니다.
+ */
+class MYPROJECT2_API SPartFuzzyFinder : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SPartFuzzyFinder)
+		: _MaxResults(50)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<const FPartFuzzyIndex>, FuzzyIndex) // 퍼지 검색 인덱스
+		SLATE_ARGUMENT(int32, MaxResults)                             // 최대 결과 수
+		SLATE_EVENT(FOnPartFuzzyMatchChosen, OnPartChosen)            // 결과 선택 이벤트
+		SLATE_EVENT(FSimpleDelegate, OnCancelled)                     // 취소(Esc) 이벤트
+	SLATE_END_ARGS()
+
+	/** 위젯 생성 함수 */
+	void Construct(const FArguments& InArgs);
+
+	/** 키보드 포커스를 받을 검색창 */
+	TSharedPtr<SWidget> GetWidgetToFocus() const;
+
+private:
+	/** 검색어 변경 시 질의 실행 */
+	void OnQueryChanged(const FText& InText);
+
+	/** 검색창 키 입력 (위/아래/Enter/Esc) */
+	FReply OnSearchBoxKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent);
+
+	/** 결과 행 생성 */
+	TSharedRef<ITableRow> OnGenerateResultRow(TSharedPtr<FPartFuzzyMatch> Match, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** 결과 클릭 */
+	void OnResultClicked(TSharedPtr<FPartFuzzyMatch> Match);
+
+	/** 선택 결과 이동 */
+	void MoveSelection(int32 Delta);
+
+	/** 현재 선택 결과 확정 */
+	void ChooseSelected();
+
+	/** 상태 표시 문자열 (결과 수와 질의 시간) */
+	FText GetStatusText() const;
+
+	TSharedPtr<const FPartFuzzyIndex> FuzzyIndex;
+	int32 MaxResults = 50;
+	FOnPartFuzzyMatchChosen OnPartChosen;
+	FSimpleDelegate OnCancelled;
+
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SListView<TSharedPtr<FPartFuzzyMatch>>> ResultListView;
+	TArray<TSharedPtr<FPartFuzzyMatch>> Results;
+
+	/** 마지막 질의 시간 (ms) */
+	double LastQueryMs = 0.0;
+};
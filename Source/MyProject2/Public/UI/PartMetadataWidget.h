@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/SBoxPanel.h"
 #include "Engine/Texture2D.h"
+#include "TreeViewUtils.h"
 
 // 전방 선언
 struct FPartTreeItem;
@@ -33,6 +35,18 @@ public:
      */
     void SetSelectedItem(TSharedPtr<FPartTreeItem> InSelectedItem);
 
+    /**
+     * 선택된 파트 항목 목록 설정 (다중 선택)
+     * 첫 번째 항목은 상세 정보로, 전체 선택은 집계 통계로 표시합니다.
+     * @param InSelectedItems - 선택된 파트 트리 항목 배열
+     */
+    void SetSelectedItems(const TArray<TSharedPtr<FPartTreeItem>>& InSelectedItems);
+
+    /**
+     * 다중 선택 집계 캐시 무효화 (임포트 상태 변경 등)
+     */
+    void InvalidateSelectionStats();
+
     /**
      * 이미지 위젯 반환 함수
      * @return 이미지 표시 위젯
@@ -51,11 +65,30 @@ private:
      */
     void UpdateImage();
 
+    /**
+     * 선택된 항목 메타데이터 캐시 및 속성 그리드 행 재구성
+     * 선택이 바뀔 때만 호출되며, 페인트마다 다시 계산하지 않습니다.
+     */
+    void UpdateMetadata();
+
     /**
      * 선택된 항목 메타데이터 텍스트 반환
-     * @return 메타데이터 텍스트
+     * @return 캐시된 메타데이터 텍스트
      */
-    FText GetSelectedItemMetadata() const;
+    FText GetSelectedItemMetadata() const { return CachedMetadataText; }
+
+    /**
+     * 다중 선택 집계 계산 및 요약 그리드 재구성
+     */
+    void UpdateSelectionStats();
+
+    /**
+     * 속성 그리드에 라벨/값 행 추가
+     * @param GridBox - 행을 추가할 그리드
+     * @param Label - 라벨
+     * @param Value - 값
+     */
+    static void AddGridRow(const TSharedPtr<SVerticalBox>& GridBox, const FString& Label, const FString& Value);
 
 private:
     /** 선택된 파트 항목 */
@@ -66,4 +99,22 @@ private:
 
     /** 현재 이미지 브러시 */
     TSharedPtr<FSlateBrush> CurrentImageBrush;
+
+    /** 메타데이터 속성 그리드 (라벨/값 행 목록) */
+    TSharedPtr<SVerticalBox> MetadataGridBox;
+
+    /** 선택 변경 시 계산해 둔 메타데이터 텍스트 */
+    FText CachedMetadataText;
+
+    /** 현재 선택된 항목 목록 (다중 선택) */
+    TArray<TSharedPtr<FPartTreeItem>> SelectedItems;
+
+    /** 다중 선택 집계 요약 그리드 */
+    TSharedPtr<SVerticalBox> SelectionStatsBox;
+
+    /** 다중 선택 집계 캐시 */
+    FPartSelectionStats CachedSelectionStats;
+
+    /** 집계 캐시 유효 여부 */
+    bool bSelectionStatsValid = false;
 };
\ No newline at end of file
@@ -30,6 +30,7 @@ public class MyProject2Editor : ModuleRules
 				"WorkspaceMenuStructure",
 				"InputCore",             // 추가: 입력 처리 모듈
 				"LevelEditor",           // 추가: 레벨 에디터 모듈
+				"Json",                  // 커맨드렛 JSON 요약
 			}
 		);
 	}
@@ -0,0 +1,267 @@
+﻿// BomImportCommandlet.cpp
+// BOM 일괄 임포트 커맨드렛 구현
+
+#include "BomImportCommandlet.h"
+
+#include "BatchImportScheduler.h"
+#include "Dom/JsonObject.h"
+#include "EditorLoadingAndSavingUtils.h"
+#include "ImportSettings.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PartFileIndex.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "TreeViewUtils.h"
+#include "UI/PartTreeItem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBomImportCommandlet, Log, All);
+
+namespace BomImportCommandlet
+{
+	/** 문자열 배열을 JSON 배열로 변환 */
+	TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<FString>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(Values.Num());
+		for (const FString& Value : Values)
+		{
+			JsonValues.Add(MakeShared<FJsonValueString>(Value));
+		}
+		return JsonValues;
+	}
+}
+
+UBomImportCommandlet::UBomImportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("BOM CSV를 읽어 매칭되는 3DXML 파일을 일괄 사전 임포트하고 JSON 요약을 저장합니다.");
+	HelpUsage = TEXT("-run=BomImport -Bom=<csv> [-CadDir=<dir>] [-Recursive] [-Parts=<PartNo>+<PartNo>] [-Quality=0|1|2] [-Concurrency=<n>] [-Map=<level>] [-SaveMap] [-Summary=<json>]");
+	HelpParamNames = { TEXT("Bom"), TEXT("CadDir"), TEXT("Recursive"), TEXT("Parts"), TEXT("Quality"), TEXT("Concurrency"), TEXT("Map"), TEXT("SaveMap"), TEXT("Summary") };
+	HelpParamDescriptions = {
+		TEXT("BOM CSV 파일 경로 (필수)"),
+		TEXT("3DXML 파일 디렉토리 (기본: 프로젝트 3DXML 폴더)"),
+		TEXT("3DXML 하위 디렉토리 포함"),
+		TEXT("임포트할 하위 트리 루트 파트 번호 ('+' 또는 ',' 구분, 없으면 전체 BOM)"),
+		TEXT("품질 단계 (0 미리보기, 1 표준, 2 고품질)"),
+		TEXT("동시에 CAD 변환할 최대 파일 수 (기본: 코어 수 기준)"),
+		TEXT("임포트 전에 열 레벨 (없으면 빈 에디터 월드)"),
+		TEXT("임포트 후 -Map 레벨 저장"),
+		TEXT("요약 JSON 경로 (기본: Saved/ImportReports/CommandletSummary_<시각>.json)")
+	};
+}
+
+int32 UBomImportCommandlet::Main(const FString& Params)
+{
+	const double CommandletStartTime = FPlatformTime::Seconds();
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const FString BomPath = ParamVals.FindRef(TEXT("Bom"));
+	if (BomPath.IsEmpty())
+	{
+		UE_LOG(LogBomImportCommandlet, Error, TEXT("-Bom=<csv> 인자가 필요합니다. 사용법: %s"), *HelpUsage);
+		return 1;
+	}
+
+	const FString* CadDirParam = ParamVals.Find(TEXT("CadDir"));
+	const FString CadDir = CadDirParam ? *CadDirParam : FPartFileIndex::GetDefaultCADDirectory();
+	const bool bRecursive = Switches.Contains(TEXT("Recursive"));
+
+	// 저장된 임포트 설정에 커맨드렛 인자 적용 (선택은 사용하지 않음)
+	FImportSettings Settings = UImportSettingsManager::Get()->GetSettings();
+	Settings.bSelectActorAfterImport = false;
+	Settings.bSkipAssetSaving = false;
+	if (const FString* QualityParam = ParamVals.Find(TEXT("Quality")))
+	{
+		Settings.QualityTier = FMath::Clamp(FCString::Atoi(**QualityParam), 0, 2);
+	}
+
+	// 1. BOM 구성 (트리뷰와 같은 경로)
+	double StepStartTime = FPlatformTime::Seconds();
+	TMap<FString, TSharedPtr<FPartTreeItem>> PartNoToItemMap;
+	TMap<int32, TArray<TSharedPtr<FPartTreeItem>>> LevelToItemsMap;
+	TArray<TSharedPtr<FPartTreeItem>> RootItems;
+	int32 MaxLevel = 0;
+	if (!FTreeViewUtils::LoadBomTree(BomPath, PartNoToItemMap, LevelToItemsMap, MaxLevel, RootItems))
+	{
+		UE_LOG(LogBomImportCommandlet, Error, TEXT("BOM 파일을 읽을 수 없습니다: %s"), *BomPath);
+		return 1;
+	}
+	const double LoadBomSeconds = FPlatformTime::Seconds() - StepStartTime;
+
+	// 2. 3DXML 디렉토리 한 번 열거
+	StepStartTime = FPlatformTime::Seconds();
+	FPartFileIndex FileIndex(CadDir, TEXT("*.3dxml"), 3, bRecursive);
+	FileIndex.Rebuild();
+	const double IndexFilesSeconds = FPlatformTime::Seconds() - StepStartTime;
+
+	// 3. 하위 트리 선택 및 작업 수집
+	StepStartTime = FPlatformTime::Seconds();
+	TArray<TSharedPtr<FPartTreeItem>> SubtreeRoots;
+	TArray<FString> SubtreeRootParts;
+	TArray<FString> MissingRootParts;
+	if (const FString* PartsParam = ParamVals.Find(TEXT("Parts")))
+	{
+		TArray<FString> RequestedParts;
+		PartsParam->Replace(TEXT(","), TEXT("+")).ParseIntoArray(RequestedParts, TEXT("+"), true);
+		for (const FString& PartNo : RequestedParts)
+		{
+			if (const TSharedPtr<FPartTreeItem>* Item = PartNoToItemMap.Find(PartNo.TrimStartAndEnd()))
+			{
+				SubtreeRoots.Add(*Item);
+				SubtreeRootParts.Add((*Item)->PartNo);
+			}
+			else
+			{
+				MissingRootParts.Add(PartNo);
+				UE_LOG(LogBomImportCommandlet, Warning, TEXT("BOM에 없는 파트 번호: %s"), *PartNo);
+			}
+		}
+	}
+	else
+	{
+		SubtreeRoots = RootItems;
+	}
+
+	FBatchImportScheduler Scheduler(Settings);
+	int32 VisitedNodeCount = 0;
+	int32 UnmatchedNodeCount = 0;
+	{
+		TSet<FString> VisitedParts;
+		TArray<FPartTreeItem*> Stack;
+		for (const TSharedPtr<FPartTreeItem>& Root : SubtreeRoots)
+		{
+			Stack.Add(Root.Get());
+		}
+
+		while (Stack.Num() > 0)
+		{
+			FPartTreeItem* Item = Stack.Pop(EAllowShrinking::No);
+			bool bAlreadyVisited = false;
+			VisitedParts.Add(Item->PartNo, &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			++VisitedNodeCount;
+			if (const FString* FilePath = FileIndex.FindFile(Item->PartNo))
+			{
+				Scheduler.AddJob(Item->PartNo, *FilePath);
+			}
+			else
+			{
+				++UnmatchedNodeCount;
+			}
+
+			for (const TSharedPtr<FPartTreeItem>& Child : Item->Children)
+			{
+				if (Child.IsValid())
+				{
+					Stack.Add(Child.Get());
+				}
+			}
+		}
+	}
+	const double CollectJobsSeconds = FPlatformTime::Seconds() - StepStartTime;
+
+	UE_LOG(LogBomImportCommandlet, Display, TEXT("BOM %d개 노드 중 %d개 대상, 3DXML 매칭 %d개 (인덱스 파일 %d개)"),
+		PartNoToItemMap.Num(), VisitedNodeCount, Scheduler.GetNumJobs(), FileIndex.Num());
+
+	// 4. 대상 레벨 열기 (없으면 빈 에디터 월드에 임포트)
+	const FString MapPath = ParamVals.FindRef(TEXT("Map"));
+	if (!MapPath.IsEmpty() && !UEditorLoadingAndSavingUtils::LoadMap(MapPath))
+	{
+		UE_LOG(LogBomImportCommandlet, Error, TEXT("레벨을 열 수 없습니다: %s"), *MapPath);
+		return 1;
+	}
+
+	// 5. 배치 임포트 (여러 파일의 CAD 변환을 동시에 시작하고 끝난 순서대로 스폰/후처리, 저장은 배치 끝에 한 번)
+	if (const FString* ConcurrencyParam = ParamVals.Find(TEXT("Concurrency")))
+	{
+		Scheduler.SetMaxConcurrentTranslations(FCString::Atoi(**ConcurrencyParam));
+	}
+
+	StepStartTime = FPlatformTime::Seconds();
+	const int32 JobCount = Scheduler.GetNumJobs();
+	FBatchImportResult BatchResult = Scheduler.Run();
+	const double ImportSeconds = FPlatformTime::Seconds() - StepStartTime;
+
+	// 6. 레벨 저장
+	double SaveMapSeconds = 0.0;
+	if (!MapPath.IsEmpty() && Switches.Contains(TEXT("SaveMap")))
+	{
+		StepStartTime = FPlatformTime::Seconds();
+		if (!UEditorLoadingAndSavingUtils::SaveDirtyPackages(true, false))
+		{
+			UE_LOG(LogBomImportCommandlet, Warning, TEXT("레벨 저장 실패: %s"), *MapPath);
+		}
+		SaveMapSeconds = FPlatformTime::Seconds() - StepStartTime;
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - CommandletStartTime;
+
+	// 7. JSON 요약
+	TSharedPtr<FJsonObject> TimingsObject = MakeShared<FJsonObject>();
+	TimingsObject->SetNumberField(TEXT("LoadBom"), LoadBomSeconds);
+	TimingsObject->SetNumberField(TEXT("IndexFiles"), IndexFilesSeconds);
+	TimingsObject->SetNumberField(TEXT("CollectJobs"), CollectJobsSeconds);
+	TimingsObject->SetNumberField(TEXT("Import"), ImportSeconds);
+	TimingsObject->SetNumberField(TEXT("PreTranslateSum"), BatchResult.PreTranslateSeconds);
+	TimingsObject->SetNumberField(TEXT("BatchSave"), BatchResult.SaveSeconds);
+	TimingsObject->SetNumberField(TEXT("Cleanup"), BatchResult.CleanupSeconds);
+	TimingsObject->SetNumberField(TEXT("SaveMap"), SaveMapSeconds);
+	TimingsObject->SetNumberField(TEXT("Total"), TotalSeconds);
+
+	TSharedPtr<FJsonObject> CountsObject = MakeShared<FJsonObject>();
+	CountsObject->SetNumberField(TEXT("BomNodes"), PartNoToItemMap.Num());
+	CountsObject->SetNumberField(TEXT("TargetNodes"), VisitedNodeCount);
+	CountsObject->SetNumberField(TEXT("IndexedFiles"), FileIndex.Num());
+	CountsObject->SetNumberField(TEXT("Jobs"), JobCount);
+	CountsObject->SetNumberField(TEXT("UnmatchedNodes"), UnmatchedNodeCount);
+	CountsObject->SetNumberField(TEXT("Imported"), BatchResult.ImportedParts.Num());
+	CountsObject->SetNumberField(TEXT("Failed"), BatchResult.FailedParts.Num());
+	CountsObject->SetNumberField(TEXT("AlreadyImported"), BatchResult.AlreadyImportedParts.Num());
+	CountsObject->SetNumberField(TEXT("SavedPackages"), BatchResult.SavedPackageCount);
+	CountsObject->SetNumberField(TEXT("ConcurrentTranslations"), BatchResult.ConcurrentTranslations);
+
+	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetStringField(TEXT("CreatedAt"), FDateTime::Now().ToIso8601());
+	RootObject->SetStringField(TEXT("Bom"), FPaths::ConvertRelativePathToFull(BomPath));
+	RootObject->SetStringField(TEXT("CadDir"), FileIndex.GetDirectoryPath());
+	RootObject->SetNumberField(TEXT("QualityTier"), Settings.QualityTier);
+	RootObject->SetArrayField(TEXT("SubtreeRoots"), BomImportCommandlet::ToJsonArray(SubtreeRootParts));
+	RootObject->SetArrayField(TEXT("MissingRootParts"), BomImportCommandlet::ToJsonArray(MissingRootParts));
+	RootObject->SetObjectField(TEXT("Timings"), TimingsObject);
+	RootObject->SetObjectField(TEXT("Counts"), CountsObject);
+	RootObject->SetArrayField(TEXT("FailedParts"), BomImportCommandlet::ToJsonArray(BatchResult.FailedParts));
+	RootObject->SetStringField(TEXT("ImportReportCsv"), BatchResult.ReportCsvPath);
+	RootObject->SetStringField(TEXT("ImportReportJson"), BatchResult.ReportJsonPath);
+
+	const FString* SummaryParam = ParamVals.Find(TEXT("Summary"));
+	const FString SummaryPath = SummaryParam ? *SummaryParam : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ImportReports"),
+		FString::Printf(TEXT("CommandletSummary_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+	if (!FFileHelper::SaveStringToFile(JsonString, *SummaryPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogBomImportCommandlet, Error, TEXT("요약 파일 저장 실패: %s"), *SummaryPath);
+		return 1;
+	}
+
+	UE_LOG(LogBomImportCommandlet, Display, TEXT("BOM 일괄 임포트 완료: 성공 %d, 실패 %d, 건너뜀 %d, %.1f초 -> %s"),
+		BatchResult.ImportedParts.Num(), BatchResult.FailedParts.Num(), BatchResult.AlreadyImportedParts.Num(),
+		TotalSeconds, *SummaryPath);
+
+	return (BatchResult.FailedParts.Num() > 0 || MissingRootParts.Num() > 0) ? 1 : 0;
+}
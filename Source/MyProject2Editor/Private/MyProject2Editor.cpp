@@ -9,13 +9,18 @@
 #include "ToolMenus.h"
 #include "UI/LevelBasedTreeView.h"
 #include "ServiceLocator.h"
+#include "PartFileIndex.h"
 #include "WorkspaceMenuStructure.h"
 #include "WorkspaceMenuStructureModule.h"
 #include "TreeViewUtils.h"            // 명시적으로 추가
 #include "Editor.h"                   // GEditor 및 UEditorEngine 참조를 위해 필요
 #include "Editor/UnrealEdEngine.h"    // 추가 에디터 기능 참조를 위해 필요
 #include "EngineUtils.h"
+#include "AssemblyStreamingManager.h" // 어셈블리 서브레벨 관리자
 #include "ImportedNodeManager.h"      // 임포트된 노드 관리자
+#include "LazyGeometryManager.h"      // 지연 형상 관리자
+#include "MaterialClassificationCache.h" // 머티리얼 분류 캐시
+#include "PartBoundsHierarchy.h"  // 노드 바운딩 박스 계층
 #include "Selection.h"
 #include "Framework/Notifications/NotificationManager.h" // 알림 기능 사용을 위해 필요
 #include "Widgets/Notifications/SNotificationList.h"     // 알림 위젯 사용을 위해 필요
@@ -38,6 +43,11 @@ void FMyProject2EditorModule::StartupModule()
     ImageManager->Initialize();
     FServiceLocator::RegisterImageManager(ImageManager);
 
+    // 3DXML 파일 인덱스 생성 및 등록 (첫 조회 시 구성, 이후 디렉토리 감시로 갱신)
+    FPartFileIndex* CADFileIndex = new FPartFileIndex(FPartFileIndex::GetDefaultCADDirectory(), TEXT("*.3dxml"));
+    CADFileIndex->StartWatching();
+    FServiceLocator::RegisterCADFileIndex(CADFileIndex);
+
     // 탭 매니저에 도킹 탭 등록
     FGlobalTabmanager::Get()->RegisterNomadTabSpawner(PartsTreeTabId, 
         FOnSpawnTab::CreateRaw(this, &FMyProject2EditorModule::SpawnPartsTreeTab))
@@ -55,6 +65,21 @@ void FMyProject2EditorModule::ShutdownModule()
     // 트리뷰 싱글톤 인스턴스 정리
     SLevelBasedTreeView::Shutdown();
     
+    // 지연 형상 관리자 정리 (임포트 노드 관리자보다 먼저, 바운딩 박스 기록 저장)
+    FLazyGeometryManager::Shutdown();
+    
+    // 어셈블리 서브레벨 관리자 정리
+    FAssemblyStreamingManager::Shutdown();
+    
+    // 노드 바운딩 박스 계층 정리 (임포트 노드 관리자보다 먼저)
+    FPartBoundsHierarchy::Shutdown();
+    
+    // 임포트 노드 인덱스 정리 (에디터 이벤트 구독 해제)
+    FImportedNodeManager::Shutdown();
+    
+    // 머티리얼 분류 캐시 정리
+    FMaterialClassificationCache::Shutdown();
+    
     // 도구 메뉴 등록 해제
     UToolMenus::UnregisterOwner(this);
     
@@ -68,6 +93,13 @@ void FMyProject2EditorModule::ShutdownModule()
         FServiceLocator::RegisterImageManager(nullptr);
         delete ImageManager;
     }
+
+    FPartFileIndex* CADFileIndex = FServiceLocator::GetCADFileIndex();
+    if (CADFileIndex)
+    {
+        FServiceLocator::RegisterCADFileIndex(nullptr);
+        delete CADFileIndex;
+    }
     
     // 에디터 메뉴 확장 훅 제거
     RemoveHooks();
@@ -151,9 +183,16 @@ TSharedRef<SDockTab> FMyProject2EditorModule::SpawnPartsTreeTab(const FSpawnTabA
             MetadataWidget.ToSharedRef()
         ];
     
-    // 도킹 탭 생성 및 반환
+    // 도킹 탭 생성 및 반환 (닫을 때 트리뷰 상태 저장)
     return SNew(SDockTab)
         .TabRole(ETabRole::NomadTab)
+        .OnTabClosed_Lambda([](TSharedRef<SDockTab>)
+        {
+            if (TSharedPtr<SLevelBasedTreeView> TreeViewInstance = SLevelBasedTreeView::Get())
+            {
+                TreeViewInstance->SaveTreeState();
+            }
+        })
         [
             ContentWidget
         ];
@@ -255,18 +294,8 @@ void FMyProject2EditorModule::ShowSelectedActorMetadata()
     if (!SelectedActor)
         return;
     
-    // 파트 번호 찾기
-    FString PartNo;
-    for (const FName& Tag : SelectedActor->Tags)
-    {
-        FString TagStr = Tag.ToString();
-        if (TagStr.StartsWith(TEXT("ImportedPart_")))
-        {
-            // "ImportedPart_" 접두사 제거하여 파트 번호 추출
-            PartNo = TagStr.RightChop(13); // "ImportedPart_" 길이는 13
-            break;
-        }
-    }
+    // 파트 번호 찾기 (선택된 액터 또는 부착 부모가 임포트된 루트인지 인덱스 조회)
+    FString PartNo = FImportedNodeManager::Get().GetPartNoForActor(SelectedActor);
     
     // 파트 번호를 찾지 못한 경우 액터 이름 사용
     if (PartNo.IsEmpty())
@@ -354,17 +383,8 @@ void FMyProject2EditorModule::SelectTreeNodeForActor()
     if (!Actor)
         return;
     
-    // 임포트된 파트 번호 찾기
-    FString PartNo;
-    for (const FName& Tag : Actor->Tags)
-    {
-        FString TagStr = Tag.ToString();
-        if (TagStr.StartsWith(TEXT("ImportedPart_")))
-        {
-            PartNo = TagStr.RightChop(13); // "ImportedPart_" 길이는 13
-            break;
-        }
-    }
+    // 임포트된 파트 번호 찾기 (선택된 액터 또는 부착 부모가 임포트된 루트인지 인덱스 조회)
+    FString PartNo = FImportedNodeManager::Get().GetPartNoForActor(Actor);
     
     if (PartNo.IsEmpty())
     {
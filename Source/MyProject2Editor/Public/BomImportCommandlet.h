@@ -0,0 +1,31 @@
+﻿// BomImportCommandlet.h
+// 트리뷰 없이 BOM CSV를 읽어 3DXML 파일을 일괄 사전 임포트하는 커맨드렛
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BomImportCommandlet.generated.h"
+
+/**
+ * BOM 일괄 임포트 커맨드렛
+ * 트리뷰와 같은 코드(FTreeViewUtils::LoadBomTree)로 BOM을 구성하고, 3DXML 디렉토리를 한 번만 열거하여
+ * 파트 번호를 매칭한 뒤 선택한 하위 트리(또는 전체 BOM)를 배치 스케줄러로 임포트합니다.
+ * 스케줄러가 여러 파일의 CAD 변환을 동시에 진행하므로 -Concurrency로 동시 변환 수를 조절할 수 있습니다.
+ * Slate나 에디터 선택을 사용하지 않으므로 -unattended -nullrhi 로 빌드 에이전트에서 실행할 수 있으며,
+ * 단계별 시간과 결과를 JSON 요약 파일로 남깁니다.
+ *
+ * 예: UnrealEditor-Cmd MyProject2.uproject -run=BomImport -Bom=/data/data.csv -Parts=ABC123+DEF456 -unattended -nullrhi
+ */
+UCLASS()
+class UBomImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBomImportCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};